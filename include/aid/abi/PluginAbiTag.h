@@ -59,7 +59,10 @@ constexpr std::uint64_t computeLayoutTag() noexcept {
     hash = foldType<aid::NewTicket>(hash);
     hash = foldType<aid::Contact>(hash);
     hash = foldType<aid::DashboardEntry>(hash);
+    hash = foldType<aid::ViewerOverlay>(hash);
+    hash = foldType<aid::SharedDashboardEntry>(hash);
     hash = foldType<aid::DashboardView>(hash);
+    hash = foldType<aid::DashboardListing>(hash);
     hash = foldType<aid::ActiveCall>(hash);
     hash = foldType<aid::WebhookDecode>(hash);
     hash = foldType<aid::plumbing::Error>(hash);
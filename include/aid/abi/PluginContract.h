@@ -45,6 +45,32 @@
 //       bumping lets deploy.sh/main() reject the stale `.so` up front. Layout is
 //       unchanged (enum-member removal does not alter any struct sizeof), so the
 //       PluginAbiTag deliberately does NOT move.
+//   5 — event deadlines: plugins export aid_plugin_bind_deadline_slot so their
+//       HttpClient clamps upstream requests to the daemon's per-event budget,
+//       and ErrorCode gained DeadlineExceeded (shifting the numeric value of
+//       every later enumerator an Error carries across the boundary). A
+//       contract-4 `.so` would ignore budgets and mis-decode error codes.
+//   6 — TicketStore gained createAndGet() / addCallHandlerAndGet(), which the
+//       incoming/outgoing/accept/transfer use cases now CALL in place of a
+//       write followed by fetchById. New vtable slots, so a contract-5 `.so`
+//       must be rejected for the same reason as level 3.
+//   7 — TicketStore gained findOpenByCallerNumberInProjects(), the batch
+//       known-contact routing lookup HandleIncoming/OutgoingCall now CALL.
+//       Another vtable slot; a contract-6 `.so` must be rejected.
+//   8 — TicketStore gained listDashboardStamped(), which GetDashboard now CALLS
+//       to carry the listing's consistency stamp. Another vtable slot; a
+//       contract-7 `.so` must be rejected.
+//   9 — AddressBook gained flushContactCache(), which POST
+//       /admin/contacts/flush CALLS after address-book edits. Another vtable
+//       slot; a contract-8 `.so` must be rejected.
+//   10 — AddressBook gained refreshContacts(), which the daemon's
+//       AddressBookRefresher CALLS on a timer to keep the plugin's local
+//       address-book mirror current. Another vtable slot; a contract-9 `.so`
+//       must be rejected.
+//   11 — TicketStore gained buildEntries(), which the ticket-upsert push now
+//       CALLS to build one shared entry plus a per-viewer overlay instead of
+//       a buildEntry() per recipient. Another vtable slot, inserted mid-vtable
+//       (shifting every later one); a contract-10 `.so` must be rejected.
 //
 // Header has no dependencies beyond <cstring>'s declarations indirectly; it is
 // includable by a plugin `.so` (which links only aid_ports) and by the daemon.
@@ -56,6 +82,6 @@ namespace aid::abi {
 // `inline constexpr` gives it a single definition across every TU; it is
 // odr-used (returned by the plugin factory symbol, logged by main) so the
 // literal is guaranteed to land in the binary's `.rodata` for `strings`.
-inline constexpr char kPluginContractTag[] = "AID_PLUGIN_CONTRACT=4";
+inline constexpr char kPluginContractTag[] = "AID_PLUGIN_CONTRACT=11";
 
 } // namespace aid::abi
@@ -7,19 +7,33 @@
 // DcHttp wraps the daemon's shared HttpClient (Basic auth + Depth: 1),
 // DcVCardParser turns the multistatus body into Contact, and this
 // facade orchestrates canonicalize → exact lookup → prefix lookup →
-// nullopt.
+// nullopt. Both lookups are answered from a ContactMirror of the two books
+// once refreshContacts() has downloaded them; until then they go to DaviCal,
+// with a ContactCache in front. With a snapshotPath the mirror is saved to
+// disk after every change and reloaded at construction, so a restart starts
+// warm.
 //
 // canonicalize() is the single authority on "is this a phone number?";
 // delegated to libphonenumber.
 
+#include <coroutine>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
+#include "aid/adapters/davical/internal/CanonicalMemo.h"
+#include "aid/adapters/davical/internal/ContactCache.h"
+#include "aid/adapters/davical/internal/ContactMirror.h"
 #include "aid/adapters/davical/internal/DcHttp.h"
+#include "aid/adapters/davical/internal/SnapshotWriter.h"
 #include "aid/adapters/davical/internal/DcVCardParser.h"
 #include "aid/infrastructure/HttpClient.h"
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Result.h"
 #include "aid/plumbing/Task.h"
 #include "aid/ports/AddressBook.h"
@@ -39,6 +53,12 @@ struct DaviCalConfig {
     std::string user;
     std::string password;
     std::string defaultRegion;
+    // Optional ContactSnapshot file; empty keeps the mirror in memory only.
+    std::string snapshotPath;
+    // Send the two cold-path REPORTs together instead of the company one
+    // only after a person miss: one round trip instead of two for callers
+    // that are not in bookAddresses, one extra REPORT for those who are.
+    bool concurrentLookups{false};
 };
 
 class DaviCalAdapter final : public aid::ports::AddressBook {
@@ -59,19 +79,76 @@ public:
     // during the graceful drain.
     void cancelPendingRequests() noexcept override;
 
+    // Admin hook: empties the ContactCache and the ContactMirror; the mirror
+    // is cold again until the next refreshContacts().
+    void flushContactCache() noexcept override;
+
+    // Per book: PROPFIND its CTag and, when that differs from the mirrored
+    // one, download the whole book and install it in the ContactMirror.
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<void>> refreshContacts() override;
+
+    // Memoised per raw string (CanonicalMemo); libphonenumber runs on a miss.
     [[nodiscard]] aid::PhoneNumber canonicalize(aid::PhoneNumber raw) const noexcept override;
 
+    // Served from the ContactMirror once it is warm, else from the
+    // ContactCache when it holds the number; otherwise one lookupRemote per
+    // number, shared by every caller that misses meanwhile.
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Contact>>>
     lookup(aid::PhoneNumber number) override;
 
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<void>> ping() override;
 
+    // ─── Diagnostics (not part of the port) ─────────────────────────────
+
+    // canonicalize() memo hits and misses since construction.
+    [[nodiscard]] internal::CanonicalMemo::Stats canonicalizeStats() const noexcept;
+
 private:
+    using LookupResult = aid::plumbing::Result<std::optional<aid::Contact>>;
+
+    // A lookupRemote in flight for one number, and the callers waiting on it.
+    struct Flight {
+        // A parked caller and its own deadline, reinstalled around its resume
+        // (see plumbing/Deadline.h) — the leader's is in scope at that point.
+        struct Waiter {
+            std::coroutine_handle<> handle;
+            std::optional<aid::plumbing::Deadline> deadline;
+        };
+        std::optional<LookupResult> result;
+        std::vector<Waiter> waiters;
+    };
+    // Parks a caller until its number's Flight has a result.
+    struct FlightWait;
+
+    // canonicalize() without the memo: libphonenumber Parse, IsPossibleNumber,
+    // Format(E164). May throw; canonicalize() catches.
+    [[nodiscard]] aid::PhoneNumber canonicalizeUncached(const std::string& raw) const;
+
+    // The two CardDAV passes: exact match on bookAddresses, then prefix match
+    // on bookCompanies. Serial, or both at once with concurrentLookups.
+    [[nodiscard]] aid::plumbing::Task<LookupResult> lookupRemote(aid::PhoneNumber number);
+    [[nodiscard]] aid::plumbing::Task<LookupResult> lookupRemoteConcurrent(aid::PhoneNumber number);
+
+    // refreshContacts() for one book; `since` is the mirror generation read
+    // before the first request. True when it installed a new download.
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<bool>>
+    refreshBook(internal::ContactMirror::Book book, std::string url, std::uint64_t since);
+
     // Construction order: http_ first (DcHttp borrows it by reference).
     std::unique_ptr<aid::infrastructure::HttpClient> httpClient_;
     DaviCalConfig cfg_;
     internal::DcHttp http_;
     // DcVCardParser is stateless (static methods) — no member needed.
+    // mutable: canonicalize() is const on the port.
+    mutable internal::CanonicalMemo canonicalMemo_;
+    internal::ContactCache contactCache_;
+    internal::ContactMirror mirror_;
+    // Saves mirror_ after each change; null without a snapshotPath.
+    std::unique_ptr<internal::SnapshotWriter> snapshotWriter_;
+
+    // Canonical number → its lookupRemote in flight.
+    std::mutex flightMtx_;
+    std::unordered_map<std::string, std::shared_ptr<Flight>> flights_;
 };
 
 } // namespace aid::adapters::davical
@@ -0,0 +1,77 @@
+#pragma once
+
+// CanonicalMemo — raw caller string → canonicalize() result, so the PBX's
+// few recurring spellings of a number pay for libphonenumber's Parse +
+// IsPossibleNumber + Format once instead of on every Incoming/Outgoing event
+// and dashboard load.
+//
+// Keyed per defaultRegion: a national-format string means a different number
+// under another region. Both outcomes are kept — an E.164 number and the
+// empty "not a phone number" — since libphonenumber's answer for a given
+// (region, string) never changes. record() also stores a non-empty result as
+// its own canonical form, which is the fast path for already-E.164 input: the
+// number the daemon canonicalised on an incoming call comes back canonical on
+// the dashboard and is answered without libphonenumber.
+//
+// Bounded LRU, like ContactCache. hits/misses count lookup() outcomes.
+// Guarded by a mutex: canonicalize() is called from the domain loop and from
+// the dashboard's request threads.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "aid/value-types/Ids.h"
+
+namespace aid::adapters::davical::internal {
+
+class CanonicalMemo {
+public:
+    // Distinct raw spellings of a busy day's callers, with room to spare.
+    static constexpr std::size_t kMaxEntries = 4096;
+
+    struct Stats {
+        std::uint64_t hits{0};
+        std::uint64_t misses{0};
+    };
+
+    CanonicalMemo() = default;
+    CanonicalMemo(const CanonicalMemo&) = delete;
+    CanonicalMemo& operator=(const CanonicalMemo&) = delete;
+    CanonicalMemo(CanonicalMemo&&) = delete;
+    CanonicalMemo& operator=(CanonicalMemo&&) = delete;
+    ~CanonicalMemo() = default;
+
+    // The remembered canonical form of `raw` under `region` (possibly the
+    // empty PhoneNumber); nullopt on a miss.
+    [[nodiscard]] std::optional<aid::PhoneNumber> lookup(std::string_view region,
+                                                         std::string_view raw);
+
+    // Remember that `raw` canonicalises to `canonical` under `region`.
+    void record(std::string_view region, std::string_view raw, const aid::PhoneNumber& canonical);
+
+    [[nodiscard]] Stats stats() const noexcept;
+    [[nodiscard]] std::size_t size();
+
+private:
+    struct Entry {
+        aid::PhoneNumber canonical;
+        std::list<std::string>::iterator lru; // position in lru_
+    };
+
+    void insertLocked(std::string key, const aid::PhoneNumber& canonical);
+
+    std::mutex mtx_;
+    std::unordered_map<std::string, Entry> byKey_;
+    std::list<std::string> lru_; // most recently used first
+    std::atomic<std::uint64_t> hits_{0};
+    std::atomic<std::uint64_t> misses_{0};
+};
+
+} // namespace aid::adapters::davical::internal
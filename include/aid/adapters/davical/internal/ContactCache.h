@@ -0,0 +1,88 @@
+#pragma once
+
+// ContactCache — canonical E.164 → lookup outcome, so a repeat caller (or the
+// dashboard re-resolving an active call) is answered without two CardDAV
+// REPORTs and two multistatus parses.
+//
+// Both outcomes are cached: a Contact for kPositiveTtl, "no such contact" for
+// the shorter kNegativeTtl, so a number added to an address book is picked up
+// within a minute even without a flush. Transport errors are never cached.
+// Bounded LRU: past kMaxEntries the least recently used number goes.
+//
+// clear() is the flush behind AddressBook::flushContactCache (POST
+// /admin/contacts/flush) after address-book edits. A lookup already in flight
+// when the flush lands must not write its pre-edit answer back, so record()
+// takes the generation() read before the REPORTs and drops a result from an
+// older one.
+//
+// Guarded by a mutex: the plugin-ABI contract is that port methods are safe
+// to call concurrently.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "aid/value-types/Contact.h"
+#include "aid/value-types/Ids.h"
+
+namespace aid::adapters::davical::internal {
+
+class ContactCache {
+public:
+    using Clock = std::function<std::chrono::steady_clock::time_point()>;
+
+    // A known contact rarely changes number; ten minutes bounds how long a
+    // renamed one shows its old name.
+    static constexpr std::chrono::minutes kPositiveTtl{10};
+    // Unknown numbers are the bulk of the traffic but may be added any time.
+    static constexpr std::chrono::seconds kNegativeTtl{60};
+    // Well above the distinct callers of a busy day.
+    static constexpr std::size_t kMaxEntries = 4096;
+
+    // `clock` defaults to steady_clock::now; tests inject a fake one.
+    explicit ContactCache(Clock clock = {});
+
+    ContactCache(const ContactCache&) = delete;
+    ContactCache& operator=(const ContactCache&) = delete;
+    ContactCache(ContactCache&&) = delete;
+    ContactCache& operator=(ContactCache&&) = delete;
+    ~ContactCache() = default;
+
+    // The cached outcome for `number`: nullopt on a miss (never seen, or
+    // expired), otherwise the Contact or the cached "no contact".
+    [[nodiscard]] std::optional<std::optional<aid::Contact>> lookup(const aid::PhoneNumber& number);
+
+    // Read before a lookup's REPORTs and hand back to record().
+    [[nodiscard]] std::uint64_t generation();
+
+    // Remember the outcome of a lookup that started at `since`; dropped when
+    // the cache was cleared in between.
+    void record(const aid::PhoneNumber& number, std::optional<aid::Contact> contact,
+                std::uint64_t since);
+
+    // Forget everything and advance the generation.
+    void clear();
+
+    [[nodiscard]] std::size_t size();
+
+private:
+    struct Entry {
+        std::optional<aid::Contact> contact;
+        std::chrono::steady_clock::time_point expiresAt{};
+        std::list<std::string>::iterator lru; // position in lru_
+    };
+
+    Clock clock_;
+    std::mutex mtx_;
+    std::unordered_map<std::string, Entry> byNumber_;
+    std::list<std::string> lru_; // most recently used first
+    std::uint64_t generation_{0};
+};
+
+} // namespace aid::adapters::davical::internal
@@ -0,0 +1,107 @@
+#pragma once
+
+// ContactMirror — an in-memory copy of both CardDAV books, indexed so that
+// lookup() answers the two passes without a REPORT: the Person pass is a hash
+// hit on the trimmed TEL, the Company pass a walk down a digit trie.
+//
+// The answers match the remote path exactly. Person: the first contact (in
+// download order) with a TEL equal to the number. Company: among contacts
+// with a TEL that starts with the number minus its extension, the one sharing
+// the longest prefix with the full number, the first on a tie — what
+// pickLongestCommonPrefix picks from the REPORT's hits. A TEL that is not
+// '+' and digits only is indexed up to its first other character, which is
+// as far as the remote "contains" filter would match it too.
+//
+// Each book is replaced wholesale by install() (DaviCalAdapter::refreshContacts
+// after a CTag change). The index is built outside the lock and swapped in, so
+// a lookup never waits on a rebuild. Until both books are installed the
+// mirror is cold and lookup() defers to the remote path.
+//
+// clear() empties it (POST /admin/contacts/flush) and advances the
+// generation, so a download that was in flight when the flush landed is not
+// installed — the same rule as ContactCache::record().
+//
+// exportBook() hands an installed book back out for the on-disk
+// ContactSnapshot, which install() takes in again on the next start.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "aid/adapters/davical/internal/ContactSnapshot.h"
+#include "aid/value-types/Contact.h"
+#include "aid/value-types/Ids.h"
+
+namespace aid::adapters::davical::internal {
+
+class ContactMirror {
+public:
+    enum class Book { Addresses, Companies };
+
+    ContactMirror() = default;
+    ContactMirror(const ContactMirror&) = delete;
+    ContactMirror& operator=(const ContactMirror&) = delete;
+    ContactMirror(ContactMirror&&) = delete;
+    ContactMirror& operator=(ContactMirror&&) = delete;
+    ~ContactMirror() = default;
+
+    // The outcome for a canonical number: nullopt while cold, otherwise the
+    // Contact (kind stamped by book) or "no contact". The Company pass trims
+    // `extensionLength` trailing digits and is skipped for numbers no longer
+    // than that.
+    [[nodiscard]] std::optional<std::optional<aid::Contact>>
+    lookup(const aid::PhoneNumber& number, std::size_t extensionLength) const;
+
+    // Read before a refresh's downloads and hand back to install().
+    [[nodiscard]] std::uint64_t generation() const;
+
+    // Replace `book` with a fresh download; `ctag` is the CTag it was read
+    // under (nullopt when the server reports none). Dropped when the mirror
+    // was cleared since `since`.
+    void install(Book book, std::vector<aid::Contact> contacts, std::optional<std::string> ctag,
+                 std::uint64_t since);
+
+    // The CTag `book` was last installed under; nullopt before the first
+    // install, after clear(), or when the server reported none.
+    [[nodiscard]] std::optional<std::string> ctag(Book book) const;
+
+    // `book` as last installed (contacts in download order, with its CTag);
+    // nullopt before the first install or after clear().
+    [[nodiscard]] std::optional<SnapshotBook> exportBook(Book book) const;
+
+    // Forget both books and advance the generation.
+    void clear();
+
+private:
+    // One downloaded book, immutable once built.
+    struct Index {
+        std::vector<aid::Contact> contacts;
+        std::optional<std::string> ctag;
+        // Addresses: trimmed TEL → first contact carrying it.
+        std::unordered_map<std::string, std::size_t> byTel;
+        // Companies: trie over '+' and '0'..'9'. nodes[0] is the root; a
+        // child index of 0 means "none". `first` is the lowest contact index
+        // with a TEL passing through the node.
+        struct Node {
+            std::array<std::uint32_t, 11> child{};
+            std::size_t first{0};
+        };
+        std::vector<Node> nodes;
+    };
+
+    [[nodiscard]] static std::shared_ptr<const Index>
+    build(Book book, std::vector<aid::Contact> contacts, std::optional<std::string> ctag);
+
+    mutable std::mutex mtx_;
+    std::shared_ptr<const Index> addresses_;
+    std::shared_ptr<const Index> companies_;
+    std::uint64_t generation_{0};
+};
+
+} // namespace aid::adapters::davical::internal
@@ -0,0 +1,63 @@
+#pragma once
+
+// ContactSnapshot — the ContactMirror on disk, so a restarted plugin answers
+// from a warm mirror at once instead of paying two REPORTs per call until the
+// first refresh lands. The CTag of each book is saved with it: the startup
+// refresh then PROPFINDs, finds the CTag unchanged and downloads nothing.
+//
+// Compact binary, host byte order (the file never leaves the machine):
+//
+//   "AIDCSNAP" | u32 version | book URLs | 2 × book | u64 FNV-1a of all before
+//   book    = u8 hasCtag, str ctag, u32 count, count × contact
+//   contact = str name, str companyName, u32 n, n × str TEL,
+//             u32 m, m × str project id
+//   str     = u32 length, bytes
+//
+// Any mismatch — magic, version, checksum, a length running past the end, or
+// book URLs other than the configured ones — rejects the whole file and the
+// plugin starts cold, as it would without one. The file is a cache: written
+// via tmp + rename so a reader never sees half of it, never fsync'd.
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "aid/value-types/Contact.h"
+
+namespace aid::adapters::davical::internal {
+
+struct SnapshotBook {
+    std::vector<aid::Contact> contacts;
+    std::optional<std::string> ctag;
+};
+
+struct Snapshot {
+    // The configured book URLs the contacts were downloaded from.
+    std::string bookAddresses;
+    std::string bookCompanies;
+    SnapshotBook addresses;
+    SnapshotBook companies;
+};
+
+class ContactSnapshot {
+public:
+    // Bump on any change to the layout above.
+    static constexpr std::uint32_t kVersion = 1;
+
+    [[nodiscard]] static std::string encode(const Snapshot& snapshot);
+
+    // nullopt on any malformed input; never reads past `bytes`.
+    [[nodiscard]] static std::optional<Snapshot> decode(std::string_view bytes);
+
+    // mmap `path` and decode it. nullopt when it is missing or unusable.
+    [[nodiscard]] static std::optional<Snapshot> load(const std::filesystem::path& path);
+
+    // Write `bytes` to `path` via an owner-only `path`.tmp, fsynced before the
+    // rename and the directory after it. False on failure.
+    [[nodiscard]] static bool save(const std::filesystem::path& path, std::string_view bytes);
+};
+
+} // namespace aid::adapters::davical::internal
@@ -44,6 +44,12 @@ public:
     // ErrorCode taxonomy as report().
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<void>> probe(std::string url);
 
+    // PROPFIND (Depth: 0) with an XML prop request, returning the raw
+    // multistatus body — the address-book mirror reads the collection's
+    // CTag this way. Same ErrorCode taxonomy as report().
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::string>>
+    propfind(std::string url, std::string_view xmlBody);
+
 private:
     aid::infrastructure::HttpClient& http_;
     std::string authHeader_;
@@ -6,14 +6,16 @@
 // Pure. No I/O. Static-only by design — a stateless XML projector. The
 // XML library used internally is libxml2 with all four XXE-relevant
 // parse options off (XML_PARSE_NONET, no DTDLOAD, no NOENT, no DTDATTR);
-// see the .cpp for the hardening boilerplate. Malformed input never
-// throws — bounds are guarded; a vCard that doesn't parse is skipped
-// and the others are returned.
+// see the .cpp for the hardening boilerplate. parse() streams the body
+// through an xmlTextReader, so a full-book download never exists as a
+// DOM. Malformed input never throws — bounds are guarded; a vCard that
+// doesn't parse is skipped and the others are returned.
 //
 // Contact.kind is intentionally NOT set here; DaviCalAdapter stamps
 // Person or Company based on which CardDAV book the parse came from.
 
 #include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -29,6 +31,15 @@ public:
     // CardDAV failures are treated as no-match upstream).
     [[nodiscard]] static std::vector<aid::Contact> parse(std::string_view xmlMultistatus);
 
+    // parse() over a full DOM of the body: the same contacts in the same
+    // order. The reference parse() is checked against; not used at runtime.
+    [[nodiscard]] static std::vector<aid::Contact> parseDom(std::string_view xmlMultistatus);
+
+    // PROPFIND multistatus → the collection's <CS:getctag> (trimmed). The
+    // CTag changes whenever anything in the address book does; nullopt when
+    // the server did not report one or the body does not parse.
+    [[nodiscard]] static std::optional<std::string> parseCtag(std::string_view xmlMultistatus);
+
     // Single vCard text → Contact (FN/ORG/TEL/X-CUSTOM1). Returns
     // nullopt on malformed input; never throws. The old microkernel
     // version crashed on a missing trailing newline (line[length()-1]
@@ -0,0 +1,54 @@
+#pragma once
+
+// SnapshotWriter — writes ContactSnapshots off the domain loop. The refresh
+// that changed the mirror hands the new snapshot to schedule() and moves on;
+// one worker thread encodes it and does the tmp + rename. Only the latest
+// snapshot matters, so one still waiting when the next arrives is replaced,
+// never queued behind it.
+//
+// The destructor writes whatever is still pending and joins the thread, so
+// the adapter's destruction (destroy_AddressBook, before dlclose) never leaves
+// the thread running plugin code that is about to be unmapped.
+
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "aid/adapters/davical/internal/ContactSnapshot.h"
+
+namespace aid::adapters::davical::internal {
+
+class SnapshotWriter {
+public:
+    explicit SnapshotWriter(std::filesystem::path path);
+
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+    SnapshotWriter(SnapshotWriter&&) = delete;
+    SnapshotWriter& operator=(SnapshotWriter&&) = delete;
+    ~SnapshotWriter();
+
+    // Replace the pending snapshot with `snapshot` and wake the worker.
+    void schedule(Snapshot snapshot);
+
+    // Block until nothing is pending or being written. For tests.
+    void drain();
+
+private:
+    void run();
+
+    std::filesystem::path path_;
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::optional<Snapshot> pending_;
+    bool writing_{false};
+    bool stopping_{false};
+    // Log the first failed write only; a broken disk would otherwise warn on
+    // every change.
+    bool warned_{false};
+    std::thread worker_; // last: started once the members above exist
+};
+
+} // namespace aid::adapters::davical::internal
@@ -11,12 +11,15 @@
 // OpDashboardBuilder). Routing, dashboard, and lockVersion logic each
 // live in their own helper file.
 
+#include <filesystem>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
+#include "aid/adapters/openproject/internal/CallidIndex.h"
 #include "aid/adapters/openproject/internal/CustomFieldMap.h"
 #include "aid/adapters/openproject/internal/HandlerLedger.h"
 #include "aid/adapters/openproject/internal/HttpDispatcher.h"
@@ -25,7 +28,10 @@
 #include "aid/adapters/openproject/internal/OpStatusMap.h"
 #include "aid/adapters/openproject/internal/OpTicketRepo.h"
 #include "aid/adapters/openproject/internal/OpUserRepo.h"
+#include "aid/adapters/openproject/internal/OpenCallView.h"
 #include "aid/adapters/openproject/internal/ProducedLedger.h"
+#include "aid/adapters/openproject/internal/RecipientCache.h"
+#include "aid/adapters/openproject/internal/TicketCache.h"
 #include "aid/crosscutting/Config.h"
 #include "aid/infrastructure/HttpClient.h"
 #include "aid/plumbing/Result.h"
@@ -42,10 +48,13 @@ namespace aid::adapters::openproject {
 class OpenProjectAdapter final : public aid::ports::TicketStore {
 public:
     // Built by the extern "C" factory after parsing config_json and
-    // wiring HttpClient + Sleeper from the event loop.
+    // wiring HttpClient + Sleeper from the event loop. `callidIndexPath`
+    // (TicketSystem.callidIndexPath) persists the callid → ticket index across
+    // restarts; nullopt keeps it in memory only.
     OpenProjectAdapter(std::unique_ptr<aid::infrastructure::HttpClient> http,
                        aid::crosscutting::TicketSystemConfig opCfg,
-                       aid::crosscutting::UiConfig uiCfg, CustomFieldMap fields, Sleeper sleeper);
+                       aid::crosscutting::UiConfig uiCfg, CustomFieldMap fields, Sleeper sleeper,
+                       std::optional<std::filesystem::path> callidIndexPath = std::nullopt);
 
     ~OpenProjectAdapter() override = default;
 
@@ -79,6 +88,11 @@ public:
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
     findOpenInProjectByCallerNumber(aid::ProjectId project, aid::PhoneNumber caller) override;
 
+    [[nodiscard]] aid::plumbing::Task<
+        aid::plumbing::Result<std::vector<std::optional<aid::Ticket>>>>
+    findOpenByCallerNumberInProjects(std::span<const aid::ProjectId> projects,
+                                     aid::PhoneNumber caller) override;
+
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::UserHandle>>>
     resolveUser(std::string_view login) override;
 
@@ -88,18 +102,30 @@ public:
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::vector<aid::DashboardEntry>>>
     listDashboard(aid::UserHandle viewer) override;
 
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<aid::DashboardListing>>
+    listDashboardStamped(aid::UserHandle viewer) override;
+
     [[nodiscard]] aid::DashboardEntry buildEntry(const aid::Ticket& ticket,
                                                  aid::UserHandle viewer) override;
 
+    [[nodiscard]] aid::SharedDashboardEntry
+    buildEntries(const aid::Ticket& ticket, const std::vector<aid::UserHandle>& viewers) override;
+
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<aid::TicketId>>
     create(const aid::NewTicket& ticket) override;
 
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
+    createAndGet(const aid::NewTicket& ticket) override;
+
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<aid::Ticket>>
     save(aid::TicketId id, aid::ports::TicketReducer reduce) override;
 
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<void>>
     addCallHandler(aid::TicketId id, aid::UserHandle login) override;
 
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
+    addCallHandlerAndGet(aid::TicketId id, aid::UserHandle login) override;
+
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::vector<aid::UserHandle>>>
     recipientsFor(const aid::Ticket& ticket) override;
 
@@ -116,6 +142,12 @@ public:
 
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<void>> ping() override;
 
+    // ─── Diagnostics (not part of the port) ─────────────────────────────
+
+    // recipientsFor answers served from the recipient cache, and sets built,
+    // since construction.
+    [[nodiscard]] RecipientCache::Stats recipientsForStats() const noexcept;
+
 private:
     // Order matters: helpers reference each other by reference, and
     // construction-order is field-declaration-order.
@@ -132,6 +164,16 @@ private:
     // last-known callHandler set here, and decodeWebhook reads both back.
     ProducedLedger producedLedger_;
     HandlerLedger handlerLedger_;
+    // Fed by tickets_ and by decodeWebhook; serves findByCallidContains.
+    CallidIndex callidIndex_;
+    // Fed by tickets_, decodeWebhook and the dashboard's own reconciles;
+    // serves listDashboard.
+    OpenCallView openCalls_;
+    // Fed by tickets_; decodeWebhook drops entries an external edit outdated.
+    // Seeds save() without a fetch.
+    TicketCache ticketCache_;
+    // Fed by tickets_.recipientsFor, stamped with users_' membership versions.
+    RecipientCache recipientCache_;
     OpHttp http_;
     OpUserRepo users_;
     OpTicketRepo tickets_;
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "aid/value-types/Ids.h"
+#include "aid/value-types/Ticket.h"
+
+// CallidIndex — local callid → TicketId map, so the Accepted / Transfer /
+// Hangup lookups (findByCallidContains) skip OpenProject's `~` (LIKE) filter
+// over work packages, one of the slowest queries the daemon issues. Sibling of
+// ProducedLedger / HandlerLedger.
+//
+// OpTicketRepo feeds it from every ticket it observes — create(), save(),
+// fetchById(), the find* results and the paged dashboard scans — and the adapter
+// feeds it from each decoded webhook. The index is a HINT, never the truth: a
+// hit is verified with a fetchById and a check that the ticket still carries the
+// callid, and any miss or stale entry falls back to the filter query. A lost or
+// wrong entry therefore costs one extra GET, never a wrong ticket.
+//
+// Persistence: with a path, every change is appended to a small line-oriented
+// file ("<callid>\t<ticketId>\n", an empty id being a tombstone) and the file is
+// replayed + compacted on construction, so a restart keeps serving the calls that
+// were live before it. Writes are best effort — a failing disk is logged once and
+// the index carries on in memory. The file is a cache, so it is never fsync'd.
+//
+// Bounded by kMaxEntries (oldest recorded first out). Guarded by a mutex for the
+// same reason as the ledgers: the plugin-ABI contract is that port methods are
+// safe to call concurrently.
+
+namespace aid::adapters::openproject {
+
+class CallidIndex {
+public:
+    // Well above the callids of every ticket a daemon touches in a working day;
+    // present only so the map (and the file) cannot grow without bound.
+    static constexpr std::size_t kMaxEntries = 20000;
+
+    // In-memory only (tests, or no TicketSystem.callidIndexPath configured).
+    CallidIndex() = default;
+
+    // Replay `persistPath` if it exists, then rewrite it compacted. A missing file
+    // is the cold start; an unreadable one is logged and treated as empty.
+    // nullopt is the in-memory-only index.
+    explicit CallidIndex(std::optional<std::filesystem::path> persistPath);
+
+    CallidIndex(const CallidIndex&) = delete;
+    CallidIndex& operator=(const CallidIndex&) = delete;
+    CallidIndex(CallidIndex&&) = delete;
+    CallidIndex& operator=(CallidIndex&&) = delete;
+    ~CallidIndex() = default;
+
+    // Map `callid` to `id`. A no-op (no disk write) when it already does.
+    void record(const aid::CallId& callid, const aid::TicketId& id);
+
+    // record() every callid `t` currently carries.
+    void recordTicket(const aid::Ticket& t);
+
+    [[nodiscard]] std::optional<aid::TicketId> lookup(const aid::CallId& callid);
+
+    // Drop `callid` only if it still maps to `id`, so a stale-entry eviction
+    // cannot erase a fresher mapping recorded while the verifying GET was in
+    // flight.
+    void forget(const aid::CallId& callid, const aid::TicketId& id);
+
+    [[nodiscard]] std::size_t size();
+
+private:
+    struct Entry {
+        aid::TicketId id;
+        std::uint64_t seq{0};
+    };
+
+    // Caller holds mtx_. Insert/overwrite without touching the file.
+    void put(const std::string& callid, const aid::TicketId& id);
+    // Caller holds mtx_. Append one line; compact instead once the file has
+    // grown to twice the live entry count.
+    void append(const std::string& callid, const std::string& id);
+    // Caller holds mtx_. Rewrite the file from the map via tmp + rename.
+    void compact();
+    // Caller holds mtx_. Log the first persistence failure, then go quiet.
+    void persistFailed(const std::string& what);
+
+    std::mutex mtx_;
+    std::unordered_map<std::string, Entry> byCallid_;
+    std::uint64_t nextSeq_{0};
+    std::optional<std::filesystem::path> path_;
+    std::size_t linesOnDisk_{0};
+    bool warned_{false};
+};
+
+} // namespace aid::adapters::openproject
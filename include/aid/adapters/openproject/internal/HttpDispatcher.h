@@ -44,6 +44,11 @@ public:
 
 using Sleeper = std::function<aid::plumbing::Task<void>(std::chrono::milliseconds)>;
 
+// The production Sleeper: resumes on `loop` after the requested duration,
+// under the deadline that was in scope when the sleep began (see
+// plumbing/Deadline.h) — the timer callback itself runs with none.
+[[nodiscard]] Sleeper makeLoopSleeper(trantor::EventLoop& loop);
+
 // Production adapter: forwards every send() to a real HttpClient.
 class RealHttpDispatcher final : public HttpDispatcher {
 public:
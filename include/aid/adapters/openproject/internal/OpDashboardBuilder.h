@@ -1,10 +1,12 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "aid/adapters/openproject/internal/OpTicketRepo.h"
 #include "aid/adapters/openproject/internal/OpUserRepo.h"
+#include "aid/adapters/openproject/internal/OpenCallView.h"
 #include "aid/crosscutting/Config.h"
 #include "aid/plumbing/Result.h"
 #include "aid/plumbing/Task.h"
@@ -26,14 +28,27 @@
 //
 // This class is the only owner of projectWebBaseUrl — keeping URL
 // construction in exactly one place.
+//
+// With an OpenCallView, steps 1–3 only run for what the view does not yet hold
+// (or holds from longer than its reconcile interval ago): the viewer's cached
+// project list, the member-project scan over the stale projects alone, and the
+// handler scan once per interval. Steps 4–5 become a local select over the
+// view; a warm load issues no OpenProject request at all.
+//
+// Step 3 does not depend on steps 1–2, so on either path it is launched first
+// and overlaps them: a cold load waits on the slower of the handler scan and
+// the projects → member-scan chain, not on all three in turn.
 
 namespace aid::adapters::openproject {
 
 class OpDashboardBuilder {
 public:
+    // `openCalls` is optional (nullptr ⇒ every build() runs all three queries,
+    // the pre-view shape the unit tests drive); the plugin always wires it in.
     OpDashboardBuilder(OpUserRepo& users, OpTicketRepo& tickets,
                        const aid::crosscutting::TicketSystemConfig& opCfg,
-                       const aid::crosscutting::UiConfig& uiCfg);
+                       const aid::crosscutting::UiConfig& uiCfg,
+                       OpenCallView* openCalls = nullptr);
 
     OpDashboardBuilder(const OpDashboardBuilder&) = delete;
     OpDashboardBuilder& operator=(const OpDashboardBuilder&) = delete;
@@ -44,6 +59,11 @@ public:
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::vector<aid::DashboardEntry>>>
     build(aid::UserHandle viewer);
 
+    // build() plus the stamp of the view state the rows were cut from
+    // (nullopt without an OpenCallView).
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<aid::DashboardListing>>
+    buildListing(aid::UserHandle viewer);
+
     // Step-6 per-ticket projection, factored out of build() so the live-delta
     // path (TicketStore::buildEntry → TicketDeltaEmitter) produces a
     // DashboardEntry byte-identical to the one the dashboard list returns:
@@ -52,6 +72,12 @@ public:
     [[nodiscard]] aid::DashboardEntry buildEntry(const aid::Ticket& t,
                                                  aid::UserHandle viewer) const;
 
+    // buildEntry for many viewers (TicketStore::buildEntries): the shared
+    // part and the call-log scan once, then a per-viewer overlay that looks
+    // only at the open call lines.
+    [[nodiscard]] aid::SharedDashboardEntry
+    buildEntries(const aid::Ticket& t, const std::vector<aid::UserHandle>& viewers) const;
+
     // Exposed for unit-tests of the merge-dedup step. The pipeline is
     // intentionally hard to test piecewise (each step depends on the
     // previous), so the assertion surface is "given two halves and a
@@ -66,10 +92,31 @@ public:
     [[nodiscard]] std::string projectName(const aid::ProjectId& id) const;
 
 private:
+    // Steps 1–4 against the view: refresh whatever is stale, then select.
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<OpenCallView::Selection>>
+    selectFromView(aid::UserHandle viewer);
+
+    // Steps 1–2 against the view: the viewer's member projects, each with a
+    // current seed by the time this returns.
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::vector<aid::ProjectId>>>
+    memberProjectsFromView(aid::UserHandle viewer);
+
+    // Step 6 split in two: every field but the per-viewer pair, and that pair
+    // from the ticket's open call lines / users on a call.
+    [[nodiscard]] aid::DashboardEntry baseEntry(const aid::Ticket& t) const;
+    [[nodiscard]] static aid::ViewerOverlay
+    overlayFor(const std::vector<std::string_view>& openLines,
+               const std::vector<aid::UserHandle>& onCall, aid::UserHandle viewer);
+
+    // Steps 5–6: sort, then project each ticket for `viewer`.
+    [[nodiscard]] std::vector<aid::DashboardEntry> entriesFor(std::vector<aid::Ticket> tickets,
+                                                              const aid::UserHandle& viewer) const;
+
     OpUserRepo& users_;
     OpTicketRepo& tickets_;
     const aid::crosscutting::TicketSystemConfig& opCfg_;
     const aid::crosscutting::UiConfig& uiCfg_;
+    OpenCallView* openCalls_;
 };
 
 } // namespace aid::adapters::openproject
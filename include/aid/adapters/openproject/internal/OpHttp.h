@@ -14,7 +14,8 @@
 // Owns three things, and nothing else:
 //
 //   1. The "Basic apikey:<token>" header, built once at construction.
-//   2. JSON-body get/post/patch helpers that return parsed nlohmann::json.
+//   2. JSON-body get/post/patch helpers that return parsed nlohmann::json
+//      (plus getBody, the unparsed GET for streamed collection pages).
 //   3. retryOn409 — the lockVersion retry loop
 //      (50/100/200/400/800 ms backoff, max 5 attempts) used by every
 //      PATCH callsite. OpTicketRepo::save delegates to retryOn409;
@@ -44,6 +45,11 @@ public:
     // co_await, so the frame must own its storage.
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<nlohmann::json>> get(std::string path);
 
+    // get() without the DOM parse: the 2xx body as received, for callers that
+    // stream it (streamHalCollection). Status mapping is identical to get().
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::string>>
+    getBody(std::string path);
+
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<nlohmann::json>>
     post(std::string path, const nlohmann::json& body);
 
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <coroutine>
+#include <cstddef>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "aid/adapters/openproject/internal/CustomFieldMap.h"
@@ -11,6 +16,7 @@
 #include "aid/adapters/openproject/internal/OpStatusMap.h"
 #include "aid/adapters/openproject/internal/OpUserRepo.h"
 #include "aid/crosscutting/Config.h"
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Result.h"
 #include "aid/plumbing/Task.h"
 #include "aid/ports/TicketStore.h"
@@ -30,6 +36,10 @@ namespace aid::adapters::openproject {
 
 class ProducedLedger;
 class HandlerLedger;
+class CallidIndex;
+class OpenCallView;
+class RecipientCache;
+class TicketCache;
 
 class OpTicketRepo {
 public:
@@ -40,9 +50,22 @@ public:
     // handler-drop edit against the last-known set. Both are optional (nullptr) —
     // the repo's own tests construct it without one and simply skip the
     // bookkeeping; the plugin always wires both in.
+    // `callidIndex` maps every callid the repo observes to its ticket so
+    // findByCallidContains can skip the `~` filter query; optional on the same
+    // terms (nullptr ⇒ every lookup goes to OpenProject, the pre-index shape).
+    // `openCalls` receives every ticket a fetch or write hands back, which keeps
+    // the dashboard's OpenCallView current between its reconciles; optional on
+    // the same terms.
+    // `ticketCache` holds the last whole ticket each fetch / create / save
+    // returned, so save() can PATCH without a seeding fetch; optional on the
+    // same terms (nullptr ⇒ every save fetches first).
+    // `recipientCache` keeps recipientsFor's union per project and membership
+    // version; optional on the same terms (nullptr ⇒ rebuilt on every call).
     OpTicketRepo(OpHttp& http, OpUserRepo& users, const OpStatusMap& statusMap,
                  const aid::crosscutting::TicketSystemConfig& cfg, const CustomFieldMap& fieldMap,
-                 ProducedLedger* producedLedger = nullptr, HandlerLedger* handlerLedger = nullptr);
+                 ProducedLedger* producedLedger = nullptr, HandlerLedger* handlerLedger = nullptr,
+                 CallidIndex* callidIndex = nullptr, OpenCallView* openCalls = nullptr,
+                 TicketCache* ticketCache = nullptr, RecipientCache* recipientCache = nullptr);
 
     OpTicketRepo(const OpTicketRepo&) = delete;
     OpTicketRepo& operator=(const OpTicketRepo&) = delete;
@@ -56,6 +79,10 @@ public:
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
     findByExactCallid(aid::CallId callid);
 
+    // Served from the CallidIndex when it has an entry: one fetchById by id, kept
+    // only if the ticket still carries `callid`. A miss, a stale entry (the
+    // callid has left the ticket) or a 404 falls back to the `~` filter query,
+    // whose hit is fed back into the index.
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
     findByCallidContains(aid::CallId callid);
 
@@ -68,17 +95,41 @@ public:
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
     findOpenInProjectByCallerNumber(aid::ProjectId project, aid::PhoneNumber caller);
 
+    // The batch form: ONE query (project filter over the whole set, newest
+    // update first) instead of one per project. Element i is the latest open
+    // ticket of `caller` in `projects[i]`.
+    [[nodiscard]] aid::plumbing::Task<
+        aid::plumbing::Result<std::vector<std::optional<aid::Ticket>>>>
+    findOpenByCallerNumberInProjects(std::vector<aid::ProjectId> projects, aid::PhoneNumber caller);
+
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<aid::TicketId>>
     create(const aid::NewTicket& nt);
 
+    // create() returning the new work package parsed straight from the POST
+    // response (a full HAL representation) — no follow-up GET. Falls back to a
+    // fetchById only if that body does not parse; nullopt if that fails too.
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
+    createAndGet(const aid::NewTicket& nt);
+
     // Persist a mutation to ticket `id` expressed as a pure delta. Mirrors
     // addCallHandler's refetch→apply→patch loop, generalised to any field:
     // fetch the current ticket, apply `reduce` to that FRESH state, PATCH the
     // result through the shared 409 loop, and on a conflict re-fetch + re-apply
     // `reduce` so a concurrent same-ticket writer's delta-field edit
-    // (callLength / callId / description) is never clobbered.
+    // (callLength / callId / description) is never clobbered. With a
+    // TicketCache the seeding fetch is skipped when the cache holds the ticket:
+    // the PATCH goes out at the cached lockVersion, and a 409 (someone wrote
+    // since) lands in the same re-fetch + re-apply path.
     // `reduce` MUST be pure + total (see ports/TicketStore.h). Absolute-target
     // fields (status/assignee/...) it sets are last-writer-wins by intent.
+    //
+    // Same-ticket saves are combined rather than raced: while one save() for
+    // `id` is in flight, later ones queue behind it without touching
+    // OpenProject. When it lands, the whole queue runs as ONE fetch + PATCH
+    // whose reducer applies each queued reducer in arrival order, and every
+    // caller in that batch gets the same post-PATCH Ticket (or the same error).
+    // Concurrent writers therefore cost one extra write per burst instead of a
+    // 409 per loser.
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<aid::Ticket>>
     save(aid::TicketId id, aid::ports::TicketReducer reduce);
 
@@ -94,6 +145,11 @@ public:
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<void>>
     addCallHandler(aid::TicketId id, aid::UserHandle login);
 
+    // addCallHandler() returning the post-merge ticket: the PATCH response when a
+    // write happened, the seeding fetch when `login` was already recorded.
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
+    addCallHandlerAndGet(aid::TicketId id, aid::UserHandle login);
+
     // The two-step status walk. Idempotent on
     // already-closed tickets (path() returns []).
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<void>> closeTwoStep(aid::TicketId id);
@@ -137,6 +193,8 @@ public:
     // exact inverse of the dashboard's two visibility arms
     // (findCallTicketsInProjectsOpen ∪ findCallTicketsWithHandler), so a ticket
     // appears on a viewer's dashboard iff that viewer is in recipientsFor(t).
+    // With a RecipientCache, a project whose membership has not changed since
+    // the last call is answered without touching projectMembers.
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::vector<aid::UserHandle>>>
     recipientsFor(const aid::Ticket& t);
 
@@ -165,18 +223,64 @@ private:
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<std::string>>>
     resolveAssigneeHref(const std::optional<aid::UserHandle>& assignee, bool omitOnLookupFailure);
 
+    // The shared front half of create()/createAndGet(): resolve the assignee and
+    // POST the work package, returning the raw HAL response.
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<nlohmann::json>>
+    postNew(const aid::NewTicket& nt);
+
+    // Pull the new id out of a POST response and do the produced-ledger /
+    // handler-ledger / callid-index bookkeeping for it.
+    [[nodiscard]] aid::plumbing::Result<aid::TicketId> recordCreated(const nlohmann::json& resp,
+                                                                    const aid::CallId& callid);
+
     // Fetch EVERY work_package matching an already-built `…?filters=<…>` URL,
     // paging through OpenProject's HAL collection until exhausted. OpenProject
     // caps an unparameterised list at its default page size (20) and silently
     // drops the rest, so the dashboard snapshot arms (findCallTicketsInProjects-
     // Open / findCallTicketsWithHandler / findOpenTicketsAssignedTo) MUST page
-    // or they truncate. Loops offset=1,2,… appending &offset&pageSize, stopping
-    // on the first short page — so a result set smaller than one page costs
-    // exactly one GET. Only the snapshot arms use this; the single-ticket delta
-    // path never does (it must add no extra OpenProject queries).
+    // or they truncate. Reads page 1, then — `total` and the applied page size
+    // now known — the remaining pages with a bounded concurrent fan-out, merged
+    // in page order. A result set smaller than one page costs exactly one GET.
+    // Only the snapshot arms use this; the single-ticket delta path never does
+    // (it must add no extra OpenProject queries).
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::vector<aid::Ticket>>>
     getAllPaged(std::string baseUrlWithFilters);
 
+    // getAllPaged's per-page step: stream the raw page body, picking up
+    // `total` if it reports one, parse and index its elements onto `all`, and
+    // return how many it held.
+    [[nodiscard]] aid::plumbing::Result<std::size_t>
+    absorbPage(std::string_view body, std::vector<aid::Ticket>& all, long long& total);
+
+    // Feed every callid `t` carries into the CallidIndex (no-op without one).
+    void indexCallids(const aid::Ticket& t);
+
+    // Hand `t` — fresh server state from a fetch or write — to the
+    // OpenCallView (no-op without one).
+    void trackOpenCall(const aid::Ticket& t);
+
+    // Remember `t` — a whole ticket from a by-id fetch or a write response — in
+    // the TicketCache (no-op without one).
+    void cacheTicket(const aid::Ticket& t);
+
+    // One caller of save() and, once its batch has been written, its outcome.
+    struct PendingSave {
+        aid::ports::TicketReducer reduce;
+        std::optional<aid::plumbing::Result<aid::Ticket>> result;
+        bool leads{false};              // promoted to write the next batch
+        std::coroutine_handle<> waiter; // set while parked in SaveTurn
+        // The parked caller's own budget, reinstalled around its resume (see
+        // plumbing/Deadline.h) — not the leader's, which is in scope then.
+        std::optional<aid::plumbing::Deadline> deadline;
+    };
+    // Parks a queued save() until its batch is written or it is promoted.
+    struct SaveTurn;
+
+    // The single-writer body of save(): seed (cache or fetch), reduce, PATCH
+    // through the 409 loop, and do the ledger / index bookkeeping.
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<aid::Ticket>>
+    saveNow(aid::TicketId id, aid::ports::TicketReducer reduce);
+
     OpHttp& http_;
     OpUserRepo& users_;
     const OpStatusMap& statusMap_;
@@ -184,6 +288,15 @@ private:
     const CustomFieldMap& fieldMap_;
     ProducedLedger* producedLedger_;
     HandlerLedger* handlerLedger_;
+    CallidIndex* callidIndex_;
+    OpenCallView* openCalls_;
+    TicketCache* ticketCache_;
+    RecipientCache* recipientCache_;
+
+    // TicketId → the saves queued behind the one in flight. An entry exists
+    // exactly while a save for that ticket is being written.
+    std::mutex saveMtx_;
+    std::unordered_map<std::string, std::vector<std::shared_ptr<PendingSave>>> saveQueues_;
 };
 
 } // namespace aid::adapters::openproject
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <mutex>
+#include <nlohmann/json.hpp>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -43,7 +47,15 @@ namespace aid::adapters::openproject {
 
 class OpUserRepo {
 public:
-    explicit OpUserRepo(OpHttp& http) noexcept : http_(http) {}
+    using Clock = std::function<aid::Timestamp()>;
+
+    // How long refreshMembership may go on incremental passes alone before the
+    // next one is a full sweep again — the only pass that sees a deleted
+    // membership, so this bounds how late a removal is noticed.
+    static constexpr std::chrono::seconds kFullSweepInterval{600};
+
+    // `clock` defaults to system_clock::now; tests inject a fake one.
+    explicit OpUserRepo(OpHttp& http, Clock clock = {});
 
     OpUserRepo(const OpUserRepo&) = delete;
     OpUserRepo& operator=(const OpUserRepo&) = delete;
@@ -66,7 +78,8 @@ public:
     // it 404s — so we query the memberships collection filtered by project.) Each
     // membership names a principal by href only, so every user principal is
     // resolved to its login via loginForUserHref; group/placeholder principals
-    // carry no login and are skipped. This is the inverse of projectsForUser and
+    // carry no login and are skipped. The not-yet-cached user principals are
+    // resolved in bulk first (resolvePrincipals). This is the inverse of projectsForUser and
     // drives TicketStore::recipientsFor / dashboard visibility. Result populates
     // membersCache_ for this project; the entry is thereafter kept fresh by
     // refreshMembership() (the poll loop), not assumed stable for the run.
@@ -77,11 +90,26 @@ public:
     // fresh set against the cached one, swap the cache to the fresh sets, and
     // return one MembershipDelta per project whose set changed. Nothing cached ⇒
     // empty result (no project has been resolved yet, so there is nothing to
-    // reconcile). Cost: one batched GET
+    // reconcile).
+    //
+    // Two modes. A FULL sweep re-reads every tracked project's memberships and
+    // diffs whole sets (adds and removals); it runs on the first call and then
+    // whenever the last one is kFullSweepInterval old. In between, an
+    // INCREMENTAL pass adds an `updatedAt` filter from the oldest per-project
+    // watermark (the newest membership updatedAt seen for that project, or, for
+    // one a full sweep found empty, the newest on that sweep's first page —
+    // always the server's clock, never ours), so a quiet poll returns an
+    // empty page. It can only report additions — a deleted membership leaves
+    // no row — and folds them into the cached sets. A removed member therefore
+    // stays cached, and keeps receiving that project's deltas, until the next
+    // full sweep: at most kFullSweepInterval.
+    //
+    // Cost of a full sweep: one batched GET
     // /api/v3/memberships?filters=[{"project":{"operator":"=","values":[<all
-    // cached ids>]}}] (paginated like getAllPaged) plus one GET per *newly seen*
-    // principal — already-known logins are served from loginByHref_, so a steady
-    // state with no joins costs exactly the batched GET(s).
+    // cached ids>]}}] (paginated like getAllPaged) plus one bulk users GET per
+    // kPrincipalChunk *newly seen* principals — already-known logins are served
+    // from loginByHref_, so a steady state with no joins costs exactly the
+    // batched GET(s).
     //
     // SAFETY GUARD: a failed batched fetch (or a wholly-empty response while the
     // cache is non-empty — the signature of lost API-token permission) is read
@@ -95,6 +123,12 @@ public:
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::vector<aid::MembershipDelta>>>
     refreshMembership();
 
+    // A counter for `project`'s cached member set: set when projectMembers
+    // first caches it and bumped each time refreshMembership changes it.
+    // nullopt while the project is not cached. RecipientCache stamps its sets
+    // with it.
+    [[nodiscard]] std::optional<std::uint64_t> membershipVersion(const aid::ProjectId& project);
+
 private:
     // Resolve a principal href ("/api/v3/users/<id>") to its login by GETting it
     // and reading the `login` field. nullopt when the principal exposes no login
@@ -103,13 +137,37 @@ private:
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::UserHandle>>>
     loginForUserHref(std::string_view href);
 
+    // Warm loginByHref_/hrefCache_ for every user principal in `principalHrefs`
+    // not cached yet: GET /api/v3/users?filters=[{"id":{"operator":"=",
+    // "values":[…]}}] per chunk of ids, a bounded number in flight at once,
+    // instead of one GET per principal. Best-effort — whatever it does not
+    // resolve (a failed chunk, a principal without a visible login) is left to
+    // loginForUserHref, so callers keep its exact per-principal semantics.
+    [[nodiscard]] aid::plumbing::Task<void>
+    resolvePrincipals(std::vector<std::string> principalHrefs);
+
+    // Cache each user of one bulk users response under the principal href
+    // `hrefById` maps its id to.
+    void absorbUsers(const nlohmann::json& resp,
+                     const std::unordered_map<std::string, std::string>& hrefById);
+
     OpHttp& http_;
-    // Guards the three caches below. Locked only around each map access, never
+    // Guards the caches below. Locked only around each map access, never
     // across a co_await (see the class comment).
     std::mutex cacheMtx_;
     std::unordered_map<aid::UserHandle, std::string> hrefCache_;
     std::unordered_map<std::string, aid::UserHandle> loginByHref_;
     std::unordered_map<aid::ProjectId, std::vector<aid::UserHandle>> membersCache_;
+    // Per tracked project: the newest membership updatedAt seen (from
+    // projectMembers or a refresh). Guarded by cacheMtx_.
+    std::unordered_map<aid::ProjectId, aid::Timestamp> watermarks_;
+    // Per tracked project: membershipVersion(). Values come from
+    // nextVersion_, so a project's version never repeats. Guarded by cacheMtx_.
+    std::unordered_map<aid::ProjectId, std::uint64_t> versions_;
+    std::uint64_t nextVersion_{1};
+    // When the last full sweep started; nullopt until one has run.
+    std::optional<aid::Timestamp> lastFullSweep_;
+    Clock clock_;
 };
 
 } // namespace aid::adapters::openproject
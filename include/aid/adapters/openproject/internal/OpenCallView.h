@@ -0,0 +1,149 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "aid/value-types/Dashboard.h"
+#include "aid/value-types/Ids.h"
+#include "aid/value-types/Ticket.h"
+
+// OpenCallView — in-memory copy of the open (New + InProgress) call tickets the
+// dashboard shows, so listDashboard is a local filter + sort instead of three
+// paged OpenProject scans per page load. Sibling of CallidIndex.
+//
+// It is fed from three directions:
+//   * seeds — OpDashboardBuilder runs the member-project scan for a project the
+//     first time a viewer needs it, and the call-handler scan for a viewer the
+//     first time that viewer loads, then again whenever the seed is older than
+//     kReconcileInterval. A seed is authoritative for its slice: a row it no
+//     longer returns is dropped.
+//   * writes — OpTicketRepo applies every ticket its fetch / create / save /
+//     addCallHandler paths hand back. Those are exactly the tickets the use
+//     cases pass to TicketDeltaEmitter, so the view sees every live delta.
+//   * webhooks — the adapter applies each decoded call work package, echo or
+//     not, so edits made in the OpenProject UI land here too.
+//
+// Ordering: the view never replaces a row with an older lockVersion of the same
+// ticket. A seed reads version() before its query and hands it back; a row
+// written after that point is newer than anything the seed can have seen, so
+// the seed never drops it. A closed ticket leaves a tombstone (its lockVersion)
+// for one reconcile interval, so a scan that was already in flight when it
+// closed cannot bring it back.
+//
+// The viewer → member-project list is cached here too, on the same interval,
+// and dropped whenever refreshMembership reports a change.
+//
+// Guarded by a mutex for the same reason as the ledgers: the plugin-ABI
+// contract is that port methods are safe to call concurrently.
+
+namespace aid::adapters::openproject {
+
+class OpenCallView {
+public:
+    using Clock = std::function<aid::Timestamp()>;
+
+    // How long a seed (and a cached project list) is trusted before the next
+    // dashboard load re-runs it. The live feeds keep the view current in
+    // between; the reconcile only repairs what they missed (a lost webhook, an
+    // edit in a project nobody subscribed to).
+    static constexpr std::chrono::seconds kReconcileInterval{300};
+
+    // `clock` defaults to system_clock::now; tests inject a fake one.
+    explicit OpenCallView(Clock clock = {});
+
+    OpenCallView(const OpenCallView&) = delete;
+    OpenCallView& operator=(const OpenCallView&) = delete;
+    OpenCallView(OpenCallView&&) = delete;
+    OpenCallView& operator=(OpenCallView&&) = delete;
+    ~OpenCallView() = default;
+
+    // Live feed. A Closed ticket leaves the view; an open one is inserted, or
+    // replaces an older lockVersion of itself.
+    void apply(const aid::Ticket& t);
+
+    // Drop `id` outright — a work package that is not (or no longer) a call.
+    void forget(const aid::TicketId& id);
+
+    // The change counter. Read it before a seed's upstream query and pass it to
+    // seedProjects / seedHandler.
+    [[nodiscard]] std::uint64_t version();
+
+    // The members of `projects` never seeded, or seeded more than
+    // kReconcileInterval ago.
+    [[nodiscard]] std::vector<aid::ProjectId>
+    staleProjects(const std::vector<aid::ProjectId>& projects);
+
+    // Install `open` — the member-project scan over `projects`, started at
+    // version `since` — as the rows of those projects.
+    void seedProjects(const std::vector<aid::ProjectId>& projects, std::vector<aid::Ticket> open,
+                      std::uint64_t since);
+
+    // True when `viewer`'s call-handler scan has never run, or ran more than
+    // kReconcileInterval ago.
+    [[nodiscard]] bool handlerStale(const aid::UserHandle& viewer);
+
+    // Install `open` — `viewer`'s call-handler scan, started at version `since`.
+    // Authoritative only for rows in projects without a current seed of their
+    // own; those are left to their project's reconcile.
+    void seedHandler(const aid::UserHandle& viewer, std::vector<aid::Ticket> open,
+                     std::uint64_t since);
+
+    // The cached member projects of `viewer`, or nullopt when unknown / stale.
+    [[nodiscard]] std::optional<std::vector<aid::ProjectId>>
+    projectsFor(const aid::UserHandle& viewer);
+    void rememberProjects(const aid::UserHandle& viewer, std::vector<aid::ProjectId> projects);
+    // Membership changed somewhere: every viewer's project list is re-read.
+    void forgetProjects();
+
+    struct Selection {
+        std::vector<aid::Ticket> tickets;
+        aid::DashboardStamp stamp;
+    };
+
+    // The rows `viewer` sees — those in `projects` (the viewer's member
+    // projects) plus those listing `viewer` as a call handler — unsorted, with
+    // the current version and the time of the oldest seed they rest on.
+    [[nodiscard]] Selection select(const aid::UserHandle& viewer,
+                                   const std::vector<aid::ProjectId>& projects);
+
+    [[nodiscard]] std::size_t size();
+
+private:
+    struct Row {
+        aid::Ticket ticket;
+        std::uint64_t touched{0}; // version_ when last written
+    };
+    struct Tombstone {
+        int lockVersion{0};
+        aid::Timestamp at{};
+    };
+    struct ViewerProjects {
+        std::vector<aid::ProjectId> projects;
+        aid::Timestamp at{};
+    };
+
+    // Caller holds mtx_. Insert or replace `t` unless the view holds a newer
+    // version of it (as a row or a tombstone).
+    void upsert(aid::Ticket t);
+    // Caller holds mtx_. Drop tombstones older than kReconcileInterval.
+    void pruneTombstones(aid::Timestamp now);
+    [[nodiscard]] bool fresh(aid::Timestamp seededAt, aid::Timestamp now) const;
+
+    Clock clock_;
+    std::mutex mtx_;
+    std::unordered_map<std::string, Row> rows_;
+    std::unordered_map<std::string, Tombstone> tombstones_;
+    std::unordered_map<std::string, aid::Timestamp> projectSeededAt_;
+    std::unordered_map<std::string, aid::Timestamp> handlerSeededAt_;
+    std::unordered_map<std::string, ViewerProjects> viewerProjects_;
+    std::uint64_t version_{0};
+};
+
+} // namespace aid::adapters::openproject
@@ -2,9 +2,13 @@
 
 #include <chrono>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "aid/adapters/openproject/internal/HttpDispatcher.h"
+#include "aid/plumbing/Task.h"
 #include "aid/value-types/Ids.h"
 
 // ProducedLedger — short-TTL record of (ticketId, lockVersion) pairs this
@@ -20,7 +24,15 @@
 //
 // Entries expire after kTtl so the map stays bounded (the echo window is the
 // round-trip from our PATCH to the webhook landing — well under a second with
-// journal aggregation set to 0). Guarded by a mutex: in production every access
+// journal aggregation set to 0).
+//
+// The ledger also knows which writes are still in flight: OpTicketRepo holds a
+// PendingWrite across every PATCH / POST until its version is recorded. That is
+// what lets decodeWebhook forward an external edit at once — it only waits
+// (polling, up to kEchoGraceDelay) while a write to the same ticket, or a create
+// whose id is not known yet, could still record the webhook's version.
+//
+// Guarded by a mutex: in production every access
 // is on the single domain loop, but the plugin-ABI contract is that
 // port methods are safe to call concurrently, so we lock rather than assume.
 
@@ -33,11 +45,30 @@ public:
     static constexpr std::chrono::seconds kTtl{30};
 
     // The other half of the echo-window contract (lives here so both constants
-    // sit together): how long decodeWebhook waits before consulting the ledger,
-    // so a save()/create() racing the echo webhook has recorded its version
-    // first. This is a timing cushion only — suppression is still an EXACT
-    // (id, version) match, never a time window.
+    // sit together): the longest decodeWebhook waits for an in-flight
+    // save()/create() racing the echo webhook to record its version. This is a
+    // timing cushion only — suppression is still an EXACT (id, version) match,
+    // never a time window.
     static constexpr std::chrono::milliseconds kEchoGraceDelay{500};
+    // How often decodeWebhook re-checks the ledger while it waits.
+    static constexpr std::chrono::milliseconds kEchoPollInterval{20};
+
+    // Marks a write in flight for its lifetime: on `id`, or — for a create,
+    // whose id OpenProject has not assigned yet — on every ticket. Hold it until
+    // after record(). A null ledger makes it a no-op.
+    class PendingWrite {
+    public:
+        PendingWrite(ProducedLedger* ledger, std::optional<aid::TicketId> id);
+        PendingWrite(const PendingWrite&) = delete;
+        PendingWrite& operator=(const PendingWrite&) = delete;
+        PendingWrite(PendingWrite&&) = delete;
+        PendingWrite& operator=(PendingWrite&&) = delete;
+        ~PendingWrite();
+
+    private:
+        ProducedLedger* ledger_;
+        std::optional<aid::TicketId> id_;
+    };
 
     ProducedLedger() = default;
     ProducedLedger(const ProducedLedger&) = delete;
@@ -55,6 +86,17 @@ public:
     // at this exact version is our own echo. Expired entries are pruned on read.
     [[nodiscard]] bool contains(const aid::TicketId& id, int version);
 
+    // True while a write to `id`, or any create, has not finished — i.e. a
+    // version of `id` this daemon produced may still be about to be recorded.
+    [[nodiscard]] bool writeInFlight(const aid::TicketId& id);
+
+    // decodeWebhook's echo check: true iff `version` of `id` is this daemon's
+    // own write. A miss with no write pending answers at once; otherwise it
+    // re-checks every kEchoPollInterval through `sleeper`, until the version is
+    // recorded, the writes finish or kEchoGraceDelay runs out.
+    [[nodiscard]] aid::plumbing::Task<bool> isEcho(aid::TicketId id, int version,
+                                                   Sleeper sleeper);
+
     // One recorded production. Public only so the .cpp's TTL-prune helper can
     // name it; not part of the meaningful API surface.
     struct Entry {
@@ -65,6 +107,9 @@ public:
 private:
     std::mutex mtx_;
     std::unordered_map<std::string, std::vector<Entry>> byTicket_;
+    // Open PendingWrites per ticket id, and for creates.
+    std::unordered_map<std::string, int> writesInFlight_;
+    int createsInFlight_{0};
 };
 
 } // namespace aid::adapters::openproject
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "aid/value-types/Ids.h"
+
+// RecipientCache — the recipientsFor union (project members ∪ callHandlers,
+// deduped by login, members first) kept per project, so a call storm on one
+// project's tickets builds it once instead of on every live delta.
+//
+// An entry is stamped with the project's membership version
+// (OpUserRepo::membershipVersion), which every change to the cached member
+// set bumps; a lookup under any other version misses and the next rebuild
+// replaces the entry. Within one version the union only depends on the
+// handlers that are NOT members, so tickets whose handlers are all members
+// (the usual case) share one set. Sets are immutable once built and handed
+// out by shared_ptr.
+//
+// Guarded by a mutex, like the ledgers: the plugin-ABI contract is that port
+// methods are safe to call concurrently. hits/rebuilds count lookup() hits
+// and rebuild() calls.
+
+namespace aid::adapters::openproject {
+
+class RecipientCache {
+public:
+    // Distinct non-member handler combinations kept per project version. Past
+    // it the project's sets are dropped and rebuilt on demand.
+    static constexpr std::size_t kMaxSetsPerProject = 256;
+
+    using Recipients = std::shared_ptr<const std::vector<aid::UserHandle>>;
+
+    struct Stats {
+        std::uint64_t hits{0};
+        std::uint64_t rebuilds{0};
+    };
+
+    RecipientCache() = default;
+    RecipientCache(const RecipientCache&) = delete;
+    RecipientCache& operator=(const RecipientCache&) = delete;
+    RecipientCache(RecipientCache&&) = delete;
+    RecipientCache& operator=(RecipientCache&&) = delete;
+    ~RecipientCache() = default;
+
+    // The recipients of a ticket in `project` with `handlers`, as built under
+    // membership `version`; nullptr on a miss.
+    [[nodiscard]] Recipients lookup(const aid::ProjectId& project, std::uint64_t version,
+                                    const std::vector<aid::UserHandle>& handlers);
+
+    // Build members ∪ handlers and, when `version` is known and not older than
+    // the project's entry, keep it for later lookups. `members` must be the
+    // set current at `version` or newer — a newer one is only ever stored
+    // under the older version, where the next lookup misses it.
+    [[nodiscard]] Recipients rebuild(const aid::ProjectId& project,
+                                     std::optional<std::uint64_t> version,
+                                     const std::vector<aid::UserHandle>& members,
+                                     const std::vector<aid::UserHandle>& handlers);
+
+    [[nodiscard]] Stats stats() const noexcept;
+
+    // members ∪ handlers, deduped by login, members first for determinism.
+    [[nodiscard]] static std::vector<aid::UserHandle>
+    unite(const std::vector<aid::UserHandle>& members, const std::vector<aid::UserHandle>& handlers);
+
+private:
+    struct Entry {
+        std::uint64_t version{0};
+        std::unordered_set<std::string> memberLogins;
+        // Non-member handler logins, in order, '\n'-joined → recipient set.
+        std::unordered_map<std::string, Recipients> byExtras;
+    };
+
+    // The key of `handlers` within `entry`: its non-member logins.
+    [[nodiscard]] static std::string extrasKey(const Entry& entry,
+                                               const std::vector<aid::UserHandle>& handlers);
+
+    std::mutex mtx_;
+    std::unordered_map<aid::ProjectId, Entry> byProject_;
+    std::atomic<std::uint64_t> hits_{0};
+    std::atomic<std::uint64_t> rebuilds_{0};
+};
+
+} // namespace aid::adapters::openproject
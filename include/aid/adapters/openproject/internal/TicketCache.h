@@ -0,0 +1,80 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "aid/value-types/Ids.h"
+#include "aid/value-types/Ticket.h"
+
+// TicketCache — the last full Ticket the daemon read or wrote for each work
+// package, so OpTicketRepo::save can apply its reducer and PATCH straight away
+// instead of re-fetching a ticket it touched moments ago. Sibling of
+// ProducedLedger / HandlerLedger.
+//
+// A cached copy is only ever a guess: save() PATCHes with the cached
+// lockVersion, and if anyone else has written the ticket since, OpenProject
+// answers 409 and the shared retry loop re-fetches and re-applies the reducer
+// exactly as before. So a stale entry costs one rejected PATCH, never a lost
+// edit. To keep that rare, the adapter drops an entry when a webhook reports a
+// newer version than the one held.
+//
+// Only whole-ticket representations go in: by-id fetches and create/PATCH
+// responses. The collection scans read a sparse fieldset and are never cached.
+//
+// Entries are TTL'd and the map is capped, like HandlerLedger. Guarded by a
+// mutex for the same reason as the ledgers: the plugin-ABI contract is that
+// port methods are safe to call concurrently.
+
+namespace aid::adapters::openproject {
+
+class TicketCache {
+public:
+    // How long an entry is offered to save(). Short: the point is the burst of
+    // writes one call makes to its ticket (accept, hangup, close), not a
+    // long-lived mirror.
+    static constexpr std::chrono::minutes kTtl{10};
+
+    // Hard backstop on cached tickets; well above the number of calls in flight.
+    static constexpr std::size_t kMaxTickets = 2000;
+
+    TicketCache() = default;
+    TicketCache(const TicketCache&) = delete;
+    TicketCache& operator=(const TicketCache&) = delete;
+    TicketCache(TicketCache&&) = delete;
+    TicketCache& operator=(TicketCache&&) = delete;
+    ~TicketCache() = default;
+
+    // Remember `t` as its ticket's current state, unless a newer lockVersion of
+    // it is already held.
+    void record(const aid::Ticket& t);
+
+    // The cached copy of `id`, or nullopt when none is held or it has expired.
+    [[nodiscard]] std::optional<aid::Ticket> lookup(const aid::TicketId& id);
+
+    // Someone wrote `id` at `lockVersion`: drop the cached copy if it is older.
+    void invalidateBelow(const aid::TicketId& id, int lockVersion);
+
+    // Drop the cached copy of `id` outright.
+    void forget(const aid::TicketId& id);
+
+    [[nodiscard]] std::size_t size();
+
+private:
+    struct Entry {
+        aid::Ticket ticket;
+        std::chrono::steady_clock::time_point expiresAt{};
+    };
+
+    // Caller holds mtx_. Same policy as HandlerLedger: expired entries first,
+    // then the soonest-to-expire until back at the cap.
+    void evictIfOverCapacity(std::chrono::steady_clock::time_point now);
+
+    std::mutex mtx_;
+    std::unordered_map<std::string, Entry> byTicket_;
+};
+
+} // namespace aid::adapters::openproject
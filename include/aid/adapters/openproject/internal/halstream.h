@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <nlohmann/json_fwd.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "aid/plumbing/Result.h"
+
+// Streaming reader for OpenProject HAL collections — the paged-scan
+// counterpart of OpHttp::get's whole-body DOM parse.
+//
+// A 1000-element work_packages page is several MB of JSON, most of it links,
+// embedded schemas and rendered HTML nobody reads; as a DOM it costs several
+// times its byte size in heap nodes, all alive at once. streamHalCollection
+// walks the body with nlohmann's SAX interface instead: it reads the top-level
+// `total`, descends into `_embedded.elements`, and rebuilds each element as a
+// small json object holding only the keys the caller asked for, handing it to
+// the sink before starting the next. Every other subtree (the envelope's own
+// _links, an element's schema, unlisted relations) is stepped over without
+// being materialised, so peak memory is one trimmed element plus the body.
+//
+// The per-element sink keeps the existing element parsers (parseFromHal, the
+// membership row reader) as the single place that knows the HAL shape.
+
+namespace aid::adapters::openproject {
+
+// Which parts of each element to keep. `attributes` are the element's own
+// keys (a kept `_links` / `_embedded` is itself filtered by `relations`);
+// anything below a kept relation or attribute is kept whole.
+struct HalElementFields {
+    std::vector<std::string> attributes;
+    std::vector<std::string> relations;
+};
+
+struct HalCollectionPage {
+    long long total{-1};     // the collection's `total`; -1 when absent
+    std::size_t elements{0}; // elements handed to the sink
+};
+
+// Receives each trimmed element in document order. An error aborts the parse
+// and is returned by streamHalCollection as-is.
+using HalElementSink = std::function<aid::plumbing::Result<void>(nlohmann::json&& element)>;
+
+// An empty body is an empty collection, as in OpHttp::get. A body that is not
+// valid JSON is ErrorCode::Unknown, the code OpHttp::get uses for the same case.
+[[nodiscard]] aid::plumbing::Result<HalCollectionPage>
+streamHalCollection(std::string_view body, const HalElementFields& fields,
+                    const HalElementSink& sink);
+
+} // namespace aid::adapters::openproject
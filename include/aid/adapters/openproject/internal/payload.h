@@ -3,10 +3,12 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "aid/adapters/openproject/internal/CustomFieldMap.h"
 #include "aid/adapters/openproject/internal/OpStatusMap.h"
+#include "aid/adapters/openproject/internal/halstream.h"
 #include "aid/crosscutting/Config.h"
 #include "aid/plumbing/Result.h"
 #include "aid/value-types/Ids.h"
@@ -25,9 +27,42 @@
 
 namespace aid::adapters::openproject {
 
+// Parse OpenProject's ISO-8601 "YYYY-MM-DDTHH:MM:SSZ" or with fractional
+// seconds (e.g. "2024-01-15T10:30:00.000Z"), truncated to whole seconds.
+// Returns nullopt on any parse failure. We deliberately parse to UTC;
+// OpenProject always serializes UTC.
+[[nodiscard]] std::optional<aid::Timestamp> parseIso8601Utc(std::string_view s);
+
 [[nodiscard]] aid::plumbing::Result<aid::Ticket>
 parseFromHal(const nlohmann::json& hal, const CustomFieldMap& fields, const OpStatusMap& statusMap);
 
+// How much of each work package a collection query asks OpenProject for, via
+// API v3's `select=` sparse fieldset. Without one every element arrives as the
+// full HAL document — every relation link, the embedded schema, the rendered
+// description — of which parseFromHal reads a handful of keys.
+enum class HalProjection {
+    // Routing / roll-up lookups: everything parseFromHal needs to build a
+    // usable Ticket except the long-text bodies (description, callLength). A
+    // routing hit is only ever written through save(), which re-reads the full
+    // ticket before its reducer runs, so the bodies are never needed here.
+    Routing,
+    // Dashboard / membership listings: every key parseFromHal reads, because
+    // each row is rendered (description, call-log lines) straight from it.
+    Listing,
+};
+
+// The `select=` value (unencoded) for a work_packages collection query:
+// `total`/`count` plus `elements/<key>` for each key `projection` keeps. Lives
+// beside parseFromHal so the two cannot drift — a key parseFromHal starts
+// reading must be added here too (test_payload checks the round trip).
+[[nodiscard]] std::string workPackageSelect(const CustomFieldMap& fields,
+                                            HalProjection projection);
+
+// The element fields streamHalCollection must keep for parseFromHal to see
+// everything it reads (the Listing set, plus _embedded.assignee). Same source
+// of truth as workPackageSelect.
+[[nodiscard]] HalElementFields workPackageFields(const CustomFieldMap& fields);
+
 [[nodiscard]] nlohmann::json
 toCreatePayload(const aid::NewTicket& nt, const CustomFieldMap& fields,
                 const OpStatusMap& statusMap, const aid::crosscutting::TicketSystemConfig& cfg,
@@ -62,6 +62,9 @@ public:
                             const aid::plumbing::ActionResult& result) override;
     void pushTicketUpsert(aid::UserHandle user, const aid::DashboardEntry& entry) override;
     void pushTicketRemove(aid::UserHandle user, aid::TicketId ticketId, int lockVersion) override;
+    // Serializes the shared entry once; frames differ only in the overlay,
+    // and viewers with an equal overlay get the same payload string.
+    void pushTicketUpserts(const aid::SharedDashboardEntry& shared) override;
 
     [[nodiscard]] std::size_t subscriberCount() const noexcept;
 
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <drogon/HttpRequest.h>
+#include <drogon/HttpResponse.h>
+#include <trantor/net/InetAddress.h>
+
+#include <functional>
+
+namespace aid::ports {
+class AddressBook;
+} // namespace aid::ports
+
+namespace aid::crosscutting {
+class Logger;
+} // namespace aid::crosscutting
+
+namespace aid::controllers {
+
+// POST /admin/* operator hooks. Loopback-only: an operator runs them on the
+// daemon's own host, so any other caller gets 403 before anything happens.
+// No body, no session — the trust model is the host, like /call's.
+class AdminController {
+public:
+    AdminController(aid::ports::AddressBook& addressBook, aid::crosscutting::Logger& logger);
+
+    AdminController(const AdminController&) = delete;
+    AdminController& operator=(const AdminController&) = delete;
+    AdminController(AdminController&&) = delete;
+    AdminController& operator=(AdminController&&) = delete;
+    ~AdminController() = default;
+
+    // POST /admin/contacts/flush: drop the address-book plugin's cached
+    // lookups after the books were edited. 204, or 403 off loopback.
+    void postContactsFlush(const drogon::HttpRequestPtr& req,
+                           std::function<void(const drogon::HttpResponsePtr&)>&& callback);
+
+    // The same, for a caller at `peer`. Split out so tests can pose as any
+    // peer; a drogon request's peer address is not settable from outside.
+    void postContactsFlush(const trantor::InetAddress& peer,
+                           std::function<void(const drogon::HttpResponsePtr&)>&& callback);
+
+private:
+    aid::ports::AddressBook& addressBook_;
+    aid::crosscutting::Logger& logger_;
+};
+
+} // namespace aid::controllers
@@ -27,8 +27,15 @@ namespace aid::controllers {
 // framework's underlying buffer is released after the handler returns.
 class CallController {
 public:
+    // Optional ingest-time hook, called with each event once it is in the
+    // WAL and before it is enqueued. Main posts it to CallPrefetch::begin on
+    // the domain loop so the event's reads start while it waits its turn.
+    // Must not block; it runs on the IO thread.
+    using Prefetch = std::function<void(const aid::CallEvent&)>;
+
     CallController(aid::infrastructure::Wal& wal, aid::infrastructure::Mailbox& mailbox,
-                   aid::crosscutting::Logger& logger, aid::crosscutting::CorrelationId& cid);
+                   aid::crosscutting::Logger& logger, aid::crosscutting::CorrelationId& cid,
+                   Prefetch prefetch = {});
 
     CallController(const CallController&) = delete;
     CallController& operator=(const CallController&) = delete;
@@ -49,6 +56,7 @@ private:
     aid::infrastructure::Mailbox& mailbox_;
     aid::crosscutting::Logger& logger_;
     aid::crosscutting::CorrelationId& cid_;
+    Prefetch prefetch_;
 };
 
 } // namespace aid::controllers
@@ -3,6 +3,7 @@
 #include <drogon/HttpRequest.h>
 #include <drogon/HttpResponse.h>
 
+#include <cstdint>
 #include <functional>
 #include <optional>
 #include <string>
@@ -48,6 +49,12 @@ public:
     // package ({"id":N,…}). Empty optional when no usable id is present.
     [[nodiscard]] static std::optional<aid::TicketId> ticketIdOf(std::string_view body);
 
+    // The work package's lockVersion, for the mailbox's supersede-on-enqueue
+    // (WebhookMailbox::VersionPeek). Same two shapes as ticketIdOf, but a
+    // streaming scan that stops at the field instead of building the document.
+    // Empty optional when there is no integer lockVersion.
+    [[nodiscard]] static std::optional<std::int64_t> lockVersionOf(std::string_view body);
+
 private:
     aid::infrastructure::Wal& wal_;
     aid::infrastructure::WebhookMailbox& mailbox_;
@@ -114,6 +114,21 @@ struct WebhookConfig {
     std::string secret;
 };
 
+// EventBudgets section of config.json — the per-event-type time budget, in
+// milliseconds from mailbox enqueue, after which an event stops spending
+// upstream time: HttpClient clamps each request to what is left and fails with
+// ErrorCode::DeadlineExceeded once it is gone (the WAL record stays for
+// replay, like any failed event). Entirely OPTIONAL; every key defaults to 0,
+// which means "unbudgeted" (the plain readTimeout × retries policy).
+struct EventBudgetsConfig {
+    int incomingMs = 0;
+    int outgoingMs = 0;
+    int acceptedMs = 0;
+    int transferMs = 0;
+    int hangupMs = 0;
+    int webhookMs = 0;
+};
+
 class Config {
 public:
     // The project where unrouted/incognito
@@ -145,6 +160,9 @@ public:
     // Optional Webhook section. std::nullopt when absent (feature off); a
     // present-but-malformed section (missing/empty `secret`) is a config error.
     [[nodiscard]] aid::plumbing::Result<std::optional<WebhookConfig>> webhook() const;
+    // Optional EventBudgets section. Absent section/key → 0 (unbudgeted); a
+    // present key must be a non-negative integer.
+    [[nodiscard]] aid::plumbing::Result<EventBudgetsConfig> eventBudgets() const;
     // Top-level "lanInterface" string — e.g. "0.0.0.0" for the bind-everywhere
     // dev case, or a specific interface IP in production. Consumed by Main to
     // pick the LAN listener address for /ui/* and /health.
@@ -182,6 +200,13 @@ public:
     // therefore always exactly 0 or ≥ 5.
     [[nodiscard]] aid::plumbing::Result<int> membershipPollIntervalSec() const;
 
+    // Top-level "callPrefetchMs" — how long a call event's ingest-time
+    // prefetch (usecases/CallPrefetch.h) is kept for its use case. Optional:
+    // absent → 0, which turns the prefetch off (the use cases query the
+    // ports themselves, as before). A present value must be a non-negative
+    // integer.
+    [[nodiscard]] aid::plumbing::Result<int> callPrefetchMs() const;
+
     // Top-level "walPath" — absolute path to the append-only inbox WAL
     // (fsync-before-202). Optional: absent → the production default
     // "/var/lib/aid-daemon/inbox.log" (so a pre-walPath config behaves exactly
@@ -59,6 +59,12 @@ public:
     [[nodiscard]] static std::vector<UserHandle>
     findUsersWithOpenCalls(std::string_view description);
 
+    // The OPEN lines of `description` (a "Call start:" line with no "Call
+    // End:"), in order, as views into it. Every line findOpenLineForUser or
+    // findUsersWithOpenCalls can match is among them, so a caller asking for
+    // many users scans the whole log once and then only these few lines.
+    [[nodiscard]] static std::vector<std::string_view> findOpenLines(std::string_view description);
+
     [[nodiscard]] static bool hasLine(std::string_view description, const UserHandle& user,
                                       const CallId& callid);
 };
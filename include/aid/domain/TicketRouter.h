@@ -26,15 +26,16 @@ public:
     };
     using RoutingDecision = std::variant<ReuseExisting, CreateInProject>;
 
-    struct RoutingCandidate {
-        ProjectId project;
-        std::optional<aid::Ticket> latestOpenCallTicket;
-    };
-
-    // Precondition: `perProject` is non-empty. Caller iterates over
-    // `contact.projectIds[i]` so this holds by construction.
+    // Two index-aligned views: `latestOpenPerProject[i]` is the latest open
+    // call ticket in `projects[i]`, exactly the shape
+    // TicketStore::findOpenByCallerNumberInProjects returns, so the use case
+    // hands its batch result straight through.
+    // Precondition: `projects` is non-empty and both spans have the same
+    // length. Callers pass `contact.projectIds` and the batch lookup over it,
+    // so this holds by construction.
     struct KnownInput {
-        std::span<const RoutingCandidate> perProject;
+        std::span<const ProjectId> projects;
+        std::span<const std::optional<aid::Ticket>> latestOpenPerProject;
     };
 
     struct UnknownInput {
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Timer that keeps the address-book plugin's local copy of its books current
+// (AddressBook::refreshContacts — the DaviCal plugin's CTag-gated mirror). The
+// plugin owns the data and the change detection; this component only owns the
+// cadence, the same split as MembershipReconciler, whose loop handling it
+// copies: the recurring timer fires on the Drogon app loop and each refresh
+// hops onto the domain loop that owns the plugin's HttpClient, so every
+// co_await inside it resumes there.
+//
+// Driving the refresh from the daemon rather than from a timer inside the
+// plugin keeps the plugin free of background work the daemon cannot see:
+// stop() drains an in-flight refresh before main() releases the plugin.
+
+namespace trantor {
+class EventLoop;
+} // namespace trantor
+
+namespace aid::crosscutting {
+class Logger;
+} // namespace aid::crosscutting
+
+namespace aid::ports {
+class AddressBook;
+} // namespace aid::ports
+
+namespace aid::infrastructure {
+
+class AddressBookRefresher {
+public:
+    // A refresh whose CTags are unchanged is one PROPFIND per book, so a
+    // minute is cheap and bounds how long an address-book edit takes to show.
+    static constexpr std::chrono::seconds kInterval{60};
+
+    AddressBookRefresher(trantor::EventLoop& loop, aid::ports::AddressBook& ab,
+                         aid::crosscutting::Logger& logger,
+                         std::chrono::seconds interval = kInterval) noexcept;
+
+    AddressBookRefresher(const AddressBookRefresher&) = delete;
+    AddressBookRefresher& operator=(const AddressBookRefresher&) = delete;
+    AddressBookRefresher(AddressBookRefresher&&) = delete;
+    AddressBookRefresher& operator=(AddressBookRefresher&&) = delete;
+    ~AddressBookRefresher();
+
+    // Refresh once now (so the copy is warm shortly after startup) and then
+    // every `interval`. Call once after construction.
+    void start();
+
+    // Run ONE refresh now. Safe to call from any thread — it hops onto the
+    // domain loop before touching the plugin.
+    void kick();
+
+    // Cancel the timer and wait for an in-flight refresh to finish. Same
+    // contract as MembershipReconciler::stop(): call from a non-loop thread
+    // while the domain loop and the plugin are still alive. Idempotent; the
+    // destructor calls it as a backstop.
+    void stop();
+
+private:
+    // Runs on the domain loop: reentrancy-guards, then spawns the detached
+    // refresh coroutine.
+    void launchRefresh();
+
+    trantor::EventLoop& loop_;
+    aid::ports::AddressBook& ab_;
+    aid::crosscutting::Logger& logger_;
+    std::chrono::seconds interval_;
+
+    // The Drogon app loop the timer is registered on; nullptr until start().
+    trantor::EventLoop* timerLoop_{nullptr};
+    // trantor::TimerId; 0 == no timer scheduled.
+    std::uint64_t timerId_{0};
+    // Set by stop(); blocks new refreshes from launching.
+    std::atomic<bool> stopped_{false};
+    // True while a refresh runs: a slow address book must not pile them up,
+    // and stop() waits on it.
+    std::atomic<bool> inFlight_{false};
+};
+
+} // namespace aid::infrastructure
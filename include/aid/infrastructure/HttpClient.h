@@ -65,6 +65,14 @@ class HttpCancelStation;
 // per-request timeout had not yet elapsed — touches only the heap control
 // block, never the freed wrapper.
 //
+// EVENT DEADLINE: send() reads the ambient event budget
+// (plumbing/Deadline.h) on its synchronous path. When one is in scope, each
+// attempt's drogon timeout is clamped to the time left, a backoff sleep that
+// would outlast it is skipped, and running out surfaces as
+// ErrorCode::DeadlineExceeded (never retried) instead of spending another
+// readTimeout × networkRetries on an event that has stopped mattering. With no
+// budget in scope the policy above is unchanged.
+//
 // v1 is HTTP-only; TLS is deferred. 409 / lockVersion
 // retries are NOT here — they live in the ticket-system adapter, since
 // they need an adapter-specific refresh callback.
@@ -69,11 +69,21 @@ public:
         HangupHandler hangup;
     };
 
+    // Per-event-type time budget, measured from enqueue (Config EventBudgets).
+    // Zero = unbudgeted. See MailboxEngine::Pending::deadline.
+    struct Budgets {
+        std::chrono::milliseconds incoming{0};
+        std::chrono::milliseconds outgoing{0};
+        std::chrono::milliseconds accepted{0};
+        std::chrono::milliseconds transfer{0};
+        std::chrono::milliseconds hangup{0};
+    };
+
     // domainLoop, wal, and logger must outlive the Mailbox. Decoder may be
     // empty for production callers that never call enqueueReplay; an empty
     // decoder causes enqueueReplay to log and drop.
     Mailbox(trantor::EventLoop& domainLoop, Wal& wal, aid::crosscutting::Logger& logger,
-            Handlers handlers, ReplayDecoder decoder);
+            Handlers handlers, ReplayDecoder decoder, Budgets budgets = {});
 
     Mailbox(const Mailbox&) = delete;
     Mailbox& operator=(const Mailbox&) = delete;
@@ -105,6 +115,11 @@ public:
     // (typically the SIGTERM handler on the main thread) — see MailboxEngine.h.
     [[nodiscard]] aid::plumbing::Task<void> drain(std::chrono::seconds budget);
 
+    // The budget `budgets` gives `event`'s alternative. Public so the call
+    // prefetch (usecases/CallPrefetch.h) prices its reads the same way.
+    [[nodiscard]] static std::chrono::milliseconds budgetFor(const Budgets& budgets,
+                                                             const aid::CallEvent& event);
+
     static constexpr std::size_t MAX_QUEUE = Engine::MAX_QUEUE;
     static constexpr std::size_t MAX_LIVE_MAILBOXES = Engine::MAX_LIVE_MAILBOXES;
 
@@ -116,6 +131,7 @@ private:
     aid::crosscutting::Logger& logger_; // for enqueueReplay warn text
     Handlers handlers_;
     ReplayDecoder decoder_;
+    Budgets budgets_;
     // Declared LAST: ~Engine runs its shutdown-barrier flush before handlers_
     // and decoder_ (which the dispatch closure captures) are destroyed.
     Engine engine_;
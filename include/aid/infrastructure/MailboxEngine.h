@@ -7,10 +7,13 @@
 #include <deque>
 #include <functional>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Result.h"
 #include "aid/plumbing/Task.h"
 
@@ -54,6 +57,17 @@ public:
         // it; the webhook flow always leaves it false. See Mailbox.h for
         // the replay-dedup rationale.
         bool replay = false;
+        // The event's time budget, fixed at enqueue (receipt, or WAL replay on
+        // startup) from the facade's BudgetFor. Installed as the ambient
+        // deadline around the dispatch so every upstream request the event
+        // causes is clamped to it (plumbing/Deadline.h). nullopt = unbudgeted.
+        std::optional<aid::plumbing::Deadline> deadline = std::nullopt;
+        // The payload's version as VersionOf peeked it at enqueue; nullopt when
+        // there is no VersionOf or it could not tell.
+        std::optional<std::int64_t> version = std::nullopt;
+        // WAL seqs of queued events this one superseded. Acked together with
+        // walSeq on success, left in the WAL with it on failure.
+        std::vector<std::uint64_t> supersededSeqs = {};
     };
 
     // The per-event step. Receives the Pending by reference so the call
@@ -62,6 +76,23 @@ public:
     // Task is fine for std::function.
     using Dispatch = std::function<aid::plumbing::Task<aid::plumbing::Result<void>>(Pending&)>;
 
+    // Per-event budget, measured from enqueue. Lets each facade price its
+    // event types differently (Config EventBudgets). Empty function, nullopt,
+    // or a non-positive duration => the event runs unbudgeted.
+    using BudgetFor =
+        std::function<std::optional<std::chrono::milliseconds>(const Payload&)>;
+
+    // Opt-in supersede-on-enqueue. For a payload that carries the whole state
+    // of its key at a monotonic version (a webhook's lockVersion), handling an
+    // older queued one is wasted work once a newer one is queued behind it. With
+    // a VersionOf, enqueue keeps only the newest queued payload per key: an
+    // older queued event is dropped in favour of the new one, and a new event
+    // older than one already queued is dropped in favour of that. The survivor
+    // carries every dropped event's WAL seq, so the acks still cover them all.
+    // The event a worker is already running is never touched. Empty function
+    // (the default) or nullopt for a payload => plain FIFO.
+    using VersionOf = std::function<std::optional<std::int64_t>(const Payload&)>;
+
     // Byte-exact log/rejection text preserved from the two former classes.
     //   prefix       "mailbox"                / "webhook mailbox"
     //   handledLabel "handled event callid"   / "handled ticket"
@@ -72,10 +103,11 @@ public:
         std::string failLabel;
     };
 
-    // domainLoop, wal, and logger must outlive the engine. dispatch and labels
-    // are value-captured.
+    // domainLoop, wal, and logger must outlive the engine. dispatch, labels,
+    // budgetFor and versionOf are value-captured.
     MailboxEngine(trantor::EventLoop& domainLoop, Wal& wal, aid::crosscutting::Logger& logger,
-                  Dispatch dispatch, Labels labels);
+                  Dispatch dispatch, Labels labels, BudgetFor budgetFor = {},
+                  VersionOf versionOf = {});
 
     MailboxEngine(const MailboxEngine&) = delete;
     MailboxEngine& operator=(const MailboxEngine&) = delete;
@@ -114,12 +146,20 @@ public:
 private:
     aid::plumbing::Task<void> workerCoroutine(Key key);
     void spawnWorker(Key key);
+    [[nodiscard]] std::optional<aid::plumbing::Deadline> deadlineFor(const Payload& payload) const;
+    // Caller holds mtx_. Apply the VersionOf policy to `incoming` against the
+    // queued `dq`: drop the queued events it supersedes (moving their seqs onto
+    // it), or — when a newer one is already queued — fold it into that one and
+    // return true (nothing left to push).
+    [[nodiscard]] bool supersede(std::deque<Pending>& dq, Pending& incoming);
 
     trantor::EventLoop& domainLoop_;
     Wal& wal_;
     aid::crosscutting::Logger& logger_;
     Dispatch dispatch_;
     Labels labels_;
+    BudgetFor budgetFor_;
+    VersionOf versionOf_;
 
     mutable std::mutex mtx_;
     std::unordered_map<Key, std::deque<Pending>> queues_;
@@ -64,6 +64,12 @@ public:
     // can't hammer the ticket system.
     static constexpr std::chrono::seconds kMinInterval{5};
 
+    // Adaptive cadence: the timer still fires every `interval`, but a tick only
+    // polls every `backoff` fires. A poll that sees a change resets the backoff
+    // to 1 (poll at the configured interval); a quiet one doubles it, up to this
+    // ceiling. kick() always polls at once.
+    static constexpr int kMaxBackoff{8};
+
     MembershipReconciler(trantor::EventLoop& loop, aid::ports::TicketStore& ts,
                          ConnectionGate anyConnected, ApplyDeltas applyDeltas,
                          aid::crosscutting::Logger& logger, std::chrono::seconds interval) noexcept;
@@ -90,7 +96,15 @@ public:
     // `this`. Idempotent. The destructor also calls it as a backstop.
     void stop();
 
+    // The time between polls the timer currently honours: the configured
+    // interval times the current backoff.
+    [[nodiscard]] std::chrono::seconds currentInterval() const noexcept;
+
 private:
+    // Runs on the domain loop for every timer fire: counts down the backoff and
+    // launches a tick when it runs out.
+    void onTimer();
+
     // Runs on the domain loop: reentrancy-guards, then spawns the detached tick
     // coroutine (a fire-and-forget drogon::AsyncTask defined in the .cpp).
     void launchTick();
@@ -114,6 +128,11 @@ private:
     // slow ticket system must not pile up cycles) and lets stop() wait for the
     // in-flight tick to finish before `this` is destroyed.
     std::atomic<bool> inFlight_{false};
+    // Timer fires per poll (1..kMaxBackoff). Written by the tick on the domain
+    // loop; atomic only so currentInterval() may read it from anywhere.
+    std::atomic<int> backoff_{1};
+    // Timer fires left before the next poll. Domain loop only.
+    int ticksUntilPoll_{1};
 };
 
 } // namespace aid::infrastructure
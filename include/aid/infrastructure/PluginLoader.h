@@ -15,6 +15,7 @@
 
 #include "aid/abi/PluginAbiTag.h"
 #include "aid/abi/PluginContract.h"
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Error.h"
 #include "aid/plumbing/Result.h"
 
@@ -26,6 +27,25 @@
 
 namespace aid::infrastructure {
 
+namespace detail {
+// Hand the daemon's per-thread event-deadline slot to a freshly dlopen'd
+// plugin (plumbing/Deadline.h) so its statically-linked HttpClient sees the
+// budget the mailbox installed. The symbol is optional: a plugin without it
+// (a test fixture) simply runs every request unbudgeted; a shipped plugin that
+// lags it is refused by the contract-tag guard anyway.
+inline void bindPluginDeadlineSlot(void* handle) noexcept {
+    (void)::dlerror();
+    void* sym = ::dlsym(handle, "aid_plugin_bind_deadline_slot");
+    if (sym == nullptr) {
+        return;
+    }
+    using BindFn = void (*)(std::int64_t* (*)());
+    BindFn fn{};
+    std::memcpy(&fn, &sym, sizeof(fn));
+    fn(&aid::plumbing::localDeadlineSlot);
+}
+} // namespace detail
+
 template <class Port> class PluginLoader {
 public:
     PluginLoader() = default;
@@ -185,6 +205,8 @@ PluginLoader<Port>::load(std::string_view soPath, std::string_view createSym,
     Deleter destroyer{};
     std::memcpy(&destroyer, &destroyPtr, sizeof(destroyer));
 
+    detail::bindPluginDeadlineSlot(handle);
+
     const std::string configStr{configJson};
     Port* raw = factory(configStr.c_str());
     if (raw == nullptr) {
@@ -284,6 +306,8 @@ PluginLoader<Port>::loadWithLoop(std::string_view soPath, std::string_view creat
     Deleter destroyer{};
     std::memcpy(&destroyer, &destroyPtr, sizeof(destroyer));
 
+    detail::bindPluginDeadlineSlot(handle);
+
     const std::string configStr{configJson};
     Port* raw = factory(configStr.c_str(), eventLoop);
     if (raw == nullptr) {
@@ -55,11 +55,23 @@ public:
     // optional => the record cannot be keyed and is dropped (with a warn).
     using KeyExtractor = std::function<std::optional<aid::TicketId>(std::string_view)>;
 
+    // Peek the ticket's lockVersion out of a webhook body without a full
+    // decode. A webhook carries the whole work package, so with a VersionPeek
+    // a newer queued webhook for a ticket supersedes the older ones still
+    // waiting behind its worker (MailboxEngine::VersionOf). Empty optional =>
+    // that body is queued plainly.
+    using VersionPeek = std::function<std::optional<std::int64_t>(std::string_view)>;
+
     // domainLoop, wal, and logger must outlive the WebhookMailbox. extractor may
     // be empty for callers that never replay; an empty extractor makes
     // enqueueReplay log and drop.
+    // `budget` is the per-webhook time budget from enqueue (Config
+    // EventBudgets.webhookMs); zero = unbudgeted. `versionPeek` may be empty:
+    // every webhook is then handled, in arrival order.
     WebhookMailbox(trantor::EventLoop& domainLoop, Wal& wal, aid::crosscutting::Logger& logger,
-                   Handler handler, KeyExtractor extractor);
+                   Handler handler, KeyExtractor extractor,
+                   std::chrono::milliseconds budget = std::chrono::milliseconds{0},
+                   VersionPeek versionPeek = {});
 
     WebhookMailbox(const WebhookMailbox&) = delete;
     WebhookMailbox& operator=(const WebhookMailbox&) = delete;
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+// Deadline — the time budget of the event currently being processed, carried
+// implicitly from the mailbox dispatch down to HttpClient::send so a stale
+// event stops spending upstream time once it no longer matters.
+//
+// The budget is ambient (a per-thread slot) rather than a parameter because it
+// has to cross the port vtables and the plugin boundary without touching any
+// port signature. Every coroutine in the chain is eager and is resumed from a
+// loop callback, so nothing carries the slot across a suspension by itself:
+// each party that resumes a suspended chain reinstalls the deadline that chain
+// was started under (MailboxEngine around its dispatch; HttpClient around its
+// completion, cancellation and backoff resumes). A resumption source that does
+// not do this simply runs without a budget — the pre-deadline behaviour, never
+// a wrong budget.
+//
+// Plugin boundary: a plugin `.so` links its own static copy of aid_plumbing and
+// therefore has its own slot. PluginLoader hands the daemon's slot accessor to
+// each plugin at load time (the optional aid_plugin_bind_deadline_slot symbol),
+// after which both sides read and write the daemon's slot. Unbound (a unit test
+// linking the plugin internals directly), the plugin uses its own slot.
+//
+// Uses only <chrono> so it stays includable by plugins.
+
+namespace aid::plumbing {
+
+using DeadlineClock = std::chrono::steady_clock;
+using Deadline = DeadlineClock::time_point;
+
+// The deadline in scope on this thread, or nullopt when the current work is
+// unbudgeted (UI requests, the membership poll, tests).
+[[nodiscard]] std::optional<Deadline> currentDeadline() noexcept;
+
+// RAII: install `deadline` (nullopt = explicitly unbudgeted) for the dynamic
+// extent of the scope, restoring the previous value on exit. Scopes nest.
+class DeadlineScope {
+public:
+    explicit DeadlineScope(std::optional<Deadline> deadline) noexcept;
+    ~DeadlineScope();
+
+    DeadlineScope(const DeadlineScope&) = delete;
+    DeadlineScope& operator=(const DeadlineScope&) = delete;
+    DeadlineScope(DeadlineScope&&) = delete;
+    DeadlineScope& operator=(DeadlineScope&&) = delete;
+
+private:
+    std::optional<Deadline> previous_;
+};
+
+// --- plugin-boundary bridge -------------------------------------------------
+//
+// The slot is a plain int64 (DeadlineClock ticks since its epoch, or
+// kNoDeadline) so the accessor is expressible as a C function pointer.
+inline constexpr std::int64_t kNoDeadline = INT64_MIN;
+
+using DeadlineSlotFn = std::int64_t* (*)();
+
+// This module's own per-thread slot. The daemon passes &localDeadlineSlot to
+// every plugin's aid_plugin_bind_deadline_slot.
+[[nodiscard]] std::int64_t* localDeadlineSlot();
+
+// Route this module's currentDeadline()/DeadlineScope through `fn` (the
+// daemon's localDeadlineSlot). Called once, at plugin load, before the
+// factory runs. A null `fn` reverts to the local slot.
+void bindDeadlineSlot(DeadlineSlotFn fn) noexcept;
+
+} // namespace aid::plumbing
@@ -19,6 +19,9 @@ enum class ErrorCode {
     LockVersionExhausted,
     UpstreamUnavailable,
     UpstreamTimeout,
+    DeadlineExceeded, // the event's time budget (Config EventBudgets) ran out before or
+                      // during an upstream request. Distinct from UpstreamTimeout: the
+                      // upstream may be healthy; this event simply waited too long to matter.
     Unauthenticated,
     Forbidden,
     TooManyRequests, // auth: the AuthService Argon2 concurrency cap rejected this request
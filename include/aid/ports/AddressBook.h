@@ -28,6 +28,19 @@ public:
     // graceful drain, before this port is destroyed. Default: no-op.
     virtual void cancelPendingRequests() noexcept {}
 
+    // Admin hook (POST /admin/contacts/flush): drop whatever lookup results the
+    // adapter caches, so an address-book edit shows on the next call instead of
+    // after the cache TTL. Default: no-op, for adapters that cache nothing.
+    virtual void flushContactCache() noexcept {}
+
+    // Periodic hook (AddressBookRefresher, every minute on the domain loop):
+    // bring whatever local copy of the address book the adapter keeps up to
+    // date, so lookup() can answer without a round-trip. A failure only means
+    // the copy stays as it was. Default: nothing to refresh.
+    [[nodiscard]] virtual plumbing::Task<plumbing::Result<void>> refreshContacts() {
+        co_return plumbing::Result<void>{};
+    }
+
     [[nodiscard]] virtual PhoneNumber canonicalize(PhoneNumber raw) const noexcept = 0;
 
     [[nodiscard]] virtual plumbing::Task<plumbing::Result<std::optional<Contact>>>
@@ -2,8 +2,10 @@
 
 #include <functional>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "aid/plumbing/Result.h"
@@ -64,6 +66,44 @@ public:
     [[nodiscard]] virtual plumbing::Task<plumbing::Result<std::optional<Ticket>>>
     findOpenInProjectByCallerNumber(ProjectId project, PhoneNumber caller) = 0;
 
+    // findOpenInProjectByCallerNumber for several projects at once: element i
+    // of the result is the latest open call ticket of `caller` in
+    // `projects[i]` (nullopt when there is none), so the known-contact routing
+    // of a caller attached to N projects costs one round trip instead of N.
+    // The default issues the per-project queries all at once (Task is eager)
+    // and collects them in order, so N projects cost one round trip of wall
+    // time though still N requests; the first error in project order wins. A
+    // backend that can filter on a project set in one query should override it.
+    [[nodiscard]] virtual plumbing::Task<plumbing::Result<std::vector<std::optional<Ticket>>>>
+    findOpenByCallerNumberInProjects(std::span<const ProjectId> projects, PhoneNumber caller) {
+        // Every query is started before the first suspension, while the span
+        // (a view into the caller's storage) is still valid.
+        std::vector<plumbing::Task<plumbing::Result<std::optional<Ticket>>>> queries;
+        queries.reserve(projects.size());
+        for (const auto& project : projects) {
+            queries.push_back(findOpenInProjectByCallerNumber(project, caller));
+        }
+        // Await all of them even after an error: a Task must not be destroyed
+        // while its request is still in flight.
+        std::optional<plumbing::Error> failed;
+        std::vector<std::optional<Ticket>> out;
+        out.reserve(queries.size());
+        for (auto& query : queries) {
+            auto open = co_await query;
+            if (!open) {
+                if (!failed) {
+                    failed = open.error();
+                }
+                continue;
+            }
+            out.push_back(std::move(*open));
+        }
+        if (failed) {
+            co_return plumbing::unexpected{std::move(*failed)};
+        }
+        co_return out;
+    }
+
     [[nodiscard]] virtual plumbing::Task<plumbing::Result<std::optional<UserHandle>>>
     resolveUser(std::string_view login) = 0;
 
@@ -73,6 +113,19 @@ public:
     [[nodiscard]] virtual plumbing::Task<plumbing::Result<std::vector<DashboardEntry>>>
     listDashboard(UserHandle viewer) = 0;
 
+    // listDashboard plus the consistency stamp of the state the rows were cut
+    // from, which GetDashboard passes through to the UI. The default is
+    // listDashboard with no stamp; a backend that serves the dashboard from a
+    // locally maintained view should override it to say how fresh that view is.
+    [[nodiscard]] virtual plumbing::Task<plumbing::Result<DashboardListing>>
+    listDashboardStamped(UserHandle viewer) {
+        auto entries = co_await listDashboard(std::move(viewer));
+        if (!entries) {
+            co_return plumbing::unexpected{entries.error()};
+        }
+        co_return DashboardListing{std::move(*entries), std::nullopt};
+    }
+
     // Project a single ticket to the per-viewer DashboardEntry exactly as
     // listDashboard would (same href, activeCallForViewer, otherActiveUsers,
     // statusId, lockVersion). Synchronous and pure — no I/O — because the
@@ -81,9 +134,50 @@ public:
     // byte-identical to a row the REST dashboard would have returned.
     [[nodiscard]] virtual DashboardEntry buildEntry(const Ticket& ticket, UserHandle viewer) = 0;
 
+    // buildEntry for each of `viewers`, split into the part they all share and
+    // a small per-viewer overlay (entryFor() of overlay i == buildEntry(ticket,
+    // viewers[i])). The live-delta fan-out uses it so a ticket in a busy
+    // project is projected once, not once per recipient. The default calls
+    // buildEntry per viewer; a backend should override it when the shared
+    // part is the costly one.
+    [[nodiscard]] virtual SharedDashboardEntry buildEntries(const Ticket& ticket,
+                                                            const std::vector<UserHandle>& viewers) {
+        SharedDashboardEntry shared;
+        shared.viewers.reserve(viewers.size());
+        for (const auto& viewer : viewers) {
+            auto e = buildEntry(ticket, viewer);
+            shared.viewers.push_back(ViewerOverlay{viewer, std::exchange(e.activeCallForViewer, {}),
+                                                   std::exchange(e.otherActiveUsers, {})});
+            if (shared.viewers.size() == 1) {
+                shared.entry = std::move(e);
+            }
+        }
+        return shared;
+    }
+
     [[nodiscard]] virtual plumbing::Task<plumbing::Result<TicketId>>
     create(const NewTicket& ticket) = 0;
 
+    // create() plus the created ticket, for the callers that emit a live delta
+    // straight away. An error means the create itself failed; `nullopt` means
+    // the ticket WAS created but could not be read back, which the caller
+    // treats exactly like a failed post-write fetchById (no delta, event still
+    // succeeds). The default is literally create() + fetchById(), so a backend
+    // whose create response carries only the id need not override it; one
+    // whose create response IS the full ticket should, to drop the round trip.
+    [[nodiscard]] virtual plumbing::Task<plumbing::Result<std::optional<Ticket>>>
+    createAndGet(const NewTicket& ticket) {
+        auto created = co_await create(ticket);
+        if (!created) {
+            co_return plumbing::unexpected{created.error()};
+        }
+        auto fresh = co_await fetchById(*created);
+        if (!fresh) {
+            co_return std::optional<Ticket>{};
+        }
+        co_return std::optional<Ticket>{std::move(*fresh)};
+    }
+
     // Persist a mutation to the ticket `id`, expressed as a pure delta rather
     // than an absolute ticket value. The adapter fetches the ticket's current
     // server state, applies `reduce` to it, and PATCHes the result; on an
@@ -121,6 +215,25 @@ public:
     [[nodiscard]] virtual plumbing::Task<plumbing::Result<void>>
     addCallHandler(TicketId id, UserHandle login) = 0;
 
+    // addCallHandler() plus the ticket as it stands after the merge (the state a
+    // live delta must carry: post-merge lockVersion and handler CSV). Error and
+    // `nullopt` follow createAndGet: an error means the merge failed, `nullopt`
+    // that it succeeded but the ticket could not be read back. The default is
+    // addCallHandler() + fetchById(); override when the merge's own response
+    // already is the ticket.
+    [[nodiscard]] virtual plumbing::Task<plumbing::Result<std::optional<Ticket>>>
+    addCallHandlerAndGet(TicketId id, UserHandle login) {
+        auto recorded = co_await addCallHandler(id, std::move(login));
+        if (!recorded) {
+            co_return plumbing::unexpected{recorded.error()};
+        }
+        auto fresh = co_await fetchById(std::move(id));
+        if (!fresh) {
+            co_return std::optional<Ticket>{};
+        }
+        co_return std::optional<Ticket>{std::move(*fresh)};
+    }
+
     // The set of users who should see `ticket`: the members of its project
     // UNION the logins recorded as its call handlers, deduped. This is the
     // exact inverse of listDashboard's visibility rule — a ticket appears on a
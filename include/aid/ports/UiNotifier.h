@@ -37,6 +37,15 @@ public:
     // lockVersion lets the viewer drop a frame that lost a race with a newer one.
     virtual void pushTicketUpsert(UserHandle user, const DashboardEntry& entry) = 0;
     virtual void pushTicketRemove(UserHandle user, TicketId ticketId, int lockVersion) = 0;
+
+    // pushTicketUpsert to every viewer in `shared` (TicketStore::buildEntries).
+    // The default pushes each viewer's entryFor() in turn; WsHubAdapter
+    // serializes the shared part once instead.
+    virtual void pushTicketUpserts(const SharedDashboardEntry& shared) {
+        for (const auto& overlay : shared.viewers) {
+            pushTicketUpsert(overlay.viewer, entryFor(shared, overlay));
+        }
+    }
 };
 
 } // namespace aid::ports
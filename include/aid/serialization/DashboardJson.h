@@ -11,10 +11,16 @@
 
 namespace aid {
 struct DashboardEntry;
+struct ViewerOverlay;
 } // namespace aid
 
 namespace aid::serialization {
 
 [[nodiscard]] nlohmann::json toJson(const aid::DashboardEntry& entry);
 
+// Overwrite the two per-viewer keys (activeCallForViewer, otherActiveUsers)
+// of a toJson() entry with `overlay`'s, so one serialized shared entry can be
+// reused for every viewer of a live delta.
+void applyOverlay(nlohmann::json& entry, const aid::ViewerOverlay& overlay);
+
 } // namespace aid::serialization
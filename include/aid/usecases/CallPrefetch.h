@@ -0,0 +1,152 @@
+#pragma once
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "aid/plumbing/Deadline.h"
+#include "aid/plumbing/Result.h"
+#include "aid/plumbing/Task.h"
+#include "aid/value-types/CallEvent.h"
+#include "aid/value-types/Contact.h"
+#include "aid/value-types/Ids.h"
+#include "aid/value-types/Ticket.h"
+
+namespace aid::ports {
+class TicketStore;
+class AddressBook;
+} // namespace aid::ports
+
+namespace aid::crosscutting {
+class Clock;
+} // namespace aid::crosscutting
+
+namespace aid::usecases {
+
+// Ingest-time prefetch of a call event's reads. CallController hands each
+// event to begin() (posted onto the domain loop) right after the WAL append,
+// so its upstream reads are already under way while the event waits behind
+// earlier ones for the same callid. The use cases then ask here instead of
+// the port and get the answer begin() started, or a fresh query when there
+// is none (no begin, expired, or not safe to reuse — see below).
+//
+// Only reads are prefetched, and only answers that the events queued ahead
+// cannot invalidate; every write still happens in mailbox order:
+//   * lookup() — Incoming/Outgoing contact by canonical number. Call events
+//     never write the address book, so the answer holds for the TTL. An
+//     error is not handed out; the caller queries again.
+//   * findByCallidContains() — Accepted/Transfer/Hangup. Only a hit is
+//     handed out: a miss may just mean the Incoming queued ahead has not
+//     created the ticket yet. All three use cases take only the id from it,
+//     so the hit's other fields going stale is harmless: save() may seed from
+//     a cached copy, but a stale lockVersion earns a 409 and its refresh
+//     re-applies the reducer to the current ticket. A Hangup takes the callid
+//     off its ticket, so an event begun after one gets no prefetched ticket.
+//
+// Prefetched reads start outside any mailbox dispatch, so begin() installs
+// the event's time budget itself (plumbing/Deadline.h), measured from
+// begin() — right after the enqueue the mailbox measures it from. A read
+// the budget runs out on ends in DeadlineExceeded, which is not handed out,
+// so a use case parked on it is released by then; it is resumed under its
+// own deadline.
+//
+// Entries live `ttl` by the Clock and are swept on begin(). Domain loop
+// only — no locking. Destroy only once drain() reports every port Task
+// begin() started finished (in Main: before the plugins are released).
+class CallPrefetch {
+public:
+    // Per-event budget for the reads begin() starts (Mailbox::budgetFor in
+    // Main). Empty function or a non-positive duration => unbudgeted.
+    using BudgetFor = std::function<std::chrono::milliseconds(const aid::CallEvent&)>;
+
+    CallPrefetch(aid::ports::TicketStore& ts, aid::ports::AddressBook& ab,
+                 aid::crosscutting::Clock& clock, std::chrono::milliseconds ttl,
+                 BudgetFor budgetFor = {});
+
+    CallPrefetch(const CallPrefetch&) = delete;
+    CallPrefetch& operator=(const CallPrefetch&) = delete;
+    CallPrefetch(CallPrefetch&&) = delete;
+    CallPrefetch& operator=(CallPrefetch&&) = delete;
+    ~CallPrefetch() = default;
+
+    // Start the reads `event` will need. Incognito numbers (canonicalize()
+    // empty) have no contact to look up.
+    void begin(const aid::CallEvent& event);
+
+    // AddressBook::lookup(canonical), answered from the read begin() started
+    // for `callid` when it was for the same number.
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Contact>>>
+    lookup(aid::CallId callid, aid::PhoneNumber canonical);
+
+    // TicketStore::findByCallidContains(callid), answered from the read
+    // begin() started when that found a ticket.
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
+    findByCallidContains(aid::CallId callid);
+
+    // Shutdown: while a read begin() started is still in flight, cancel the
+    // ports' pending requests so it completes promptly. Returns true once
+    // none is left. Main calls it on the domain loop until it does, before
+    // releasing the plugins — ~HttpClient does not cancel.
+    [[nodiscard]] bool drain();
+
+    // Callids with a live entry. For tests.
+    [[nodiscard]] std::size_t size() const noexcept;
+
+private:
+    // A parked use case and its own deadline, reinstalled around its resume
+    // — fill() runs under none.
+    struct Waiter {
+        std::coroutine_handle<> handle;
+        std::optional<aid::plumbing::Deadline> deadline;
+    };
+    // One prefetched read and the use cases waiting on it.
+    template <class T> struct Flight {
+        aid::Timestamp started;
+        std::optional<aid::plumbing::Result<T>> result;
+        std::vector<Waiter> waiters;
+    };
+    // Parks a use case until its Flight has a result.
+    template <class T> struct FlightWait;
+
+    using ContactFlight = Flight<std::optional<aid::Contact>>;
+    using TicketFlight = Flight<std::optional<aid::Ticket>>;
+
+    struct Entry {
+        aid::PhoneNumber number; // what `contact` was looked up for
+        std::shared_ptr<ContactFlight> contact;
+        std::shared_ptr<TicketFlight> ticket;
+        bool hungUp{false}; // a Hangup for this callid was begun
+    };
+
+    // Await `query` into `flight` and wake its waiters.
+    template <class T>
+    static aid::plumbing::Task<void> fill(std::shared_ptr<Flight<T>> flight,
+                                          aid::plumbing::Task<aid::plumbing::Result<T>> query);
+
+    template <class T> [[nodiscard]] bool fresh(const Flight<T>& flight) const;
+
+    // now + budgetFor_(event), or nullopt when unbudgeted.
+    [[nodiscard]] std::optional<aid::plumbing::Deadline>
+    deadlineFor(const aid::CallEvent& event) const;
+
+    // Drop expired flights, entries left empty, and finished fill() frames.
+    void sweep();
+
+    aid::ports::TicketStore& ts_;
+    aid::ports::AddressBook& ab_;
+    aid::crosscutting::Clock& clock_;
+    std::chrono::milliseconds ttl_;
+    BudgetFor budgetFor_;
+
+    std::unordered_map<aid::CallId, Entry> entries_;
+    // Eager-started fill() frames, kept alive until they finish.
+    std::list<aid::plumbing::Task<void>> fills_;
+};
+
+} // namespace aid::usecases
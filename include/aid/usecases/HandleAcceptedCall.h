@@ -15,6 +15,8 @@ class Clock;
 
 namespace aid::usecases {
 
+class CallPrefetch;
+
 // Orchestrates the Accepted event — mark ticket in-progress, stamp callStart
 // on every accept (most recent call's start; per-call history is kept in
 // callLength), append the open `Call start:` line per call. Pure
@@ -22,8 +24,10 @@ namespace aid::usecases {
 // the mailbox worker boundary logs them.
 class HandleAcceptedCall {
 public:
+    // `prefetch` (optional) answers the callid lookup from the read started
+    // at ingest; see CallPrefetch.
     HandleAcceptedCall(aid::ports::TicketStore& ts, aid::ports::UiNotifier& ui,
-                       aid::crosscutting::Clock& clock);
+                       aid::crosscutting::Clock& clock, CallPrefetch* prefetch = nullptr);
 
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<void>> run(const aid::AcceptedCall& ev);
 
@@ -31,6 +35,7 @@ private:
     aid::ports::TicketStore& ts_;
     aid::ports::UiNotifier& ui_;
     aid::crosscutting::Clock& clock_;
+    CallPrefetch* prefetch_;
 };
 
 } // namespace aid::usecases
@@ -15,14 +15,18 @@ class Clock;
 
 namespace aid::usecases {
 
+class CallPrefetch;
+
 // Orchestrates the Hangup event — complete the per-call comment line with the
 // end-time marker, remove the callid from the active list, save. Missing
 // ticket is a critical error (the one exception to the otherwise-non-fatal
 // "ticket not found" treatment).
 class HandleHangup {
 public:
+    // `prefetch` (optional) answers the callid lookup from the read started
+    // at ingest; see CallPrefetch.
     HandleHangup(aid::ports::TicketStore& ts, aid::ports::UiNotifier& ui,
-                 aid::crosscutting::Clock& clock);
+                 aid::crosscutting::Clock& clock, CallPrefetch* prefetch = nullptr);
 
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<void>> run(const aid::HangupCall& ev);
 
@@ -30,6 +34,7 @@ private:
     aid::ports::TicketStore& ts_;
     aid::ports::UiNotifier& ui_;
     aid::crosscutting::Clock& clock_;
+    CallPrefetch* prefetch_;
 };
 
 } // namespace aid::usecases
@@ -17,14 +17,19 @@ class Clock;
 
 namespace aid::usecases {
 
+class CallPrefetch;
+
 // Orchestrates the Ring procedure for an incoming-call event. Pure
 // orchestration: no JSON, no HTTP, no Drogon. Errors propagate silently —
 // the mailbox worker boundary logs them and decides on WAL truncation.
 class HandleIncomingCall {
 public:
+    // `prefetch` (optional) answers the contact lookup from the read started
+    // at ingest; see CallPrefetch.
     HandleIncomingCall(aid::ports::TicketStore& ts, aid::ports::AddressBook& ab,
                        aid::ports::UiNotifier& ui, aid::crosscutting::Clock& clock,
-                       const aid::crosscutting::Config::TicketRouting& cfg);
+                       const aid::crosscutting::Config::TicketRouting& cfg,
+                       CallPrefetch* prefetch = nullptr);
 
     // `replay` is true when the event is being re-dispatched from the WAL on
     // startup. Only the incognito branch reads it: a live
@@ -41,6 +46,7 @@ private:
     aid::ports::UiNotifier& ui_;
     aid::crosscutting::Clock& clock_;
     const aid::crosscutting::Config::TicketRouting& cfg_;
+    CallPrefetch* prefetch_;
 };
 
 } // namespace aid::usecases
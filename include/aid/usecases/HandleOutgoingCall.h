@@ -17,15 +17,20 @@ class Clock;
 
 namespace aid::usecases {
 
+class CallPrefetch;
+
 // Orchestrates the outgoing-call flow. Same shape as HandleIncomingCall
 // with two deltas: user is resolved first (nullopt → non-fatal early
 // return), and the assignee is set on the ticket (reuse or
 // create). OutgoingCall has no `dialed`; calledNumber stays nullopt.
 class HandleOutgoingCall {
 public:
+    // `prefetch` (optional) answers the contact lookup from the read started
+    // at ingest; see CallPrefetch.
     HandleOutgoingCall(aid::ports::TicketStore& ts, aid::ports::AddressBook& ab,
                        aid::ports::UiNotifier& ui, aid::crosscutting::Clock& clock,
-                       const aid::crosscutting::Config::TicketRouting& cfg);
+                       const aid::crosscutting::Config::TicketRouting& cfg,
+                       CallPrefetch* prefetch = nullptr);
 
     // `replay` is true when the event is being re-dispatched from the WAL on
     // startup; see HandleIncomingCall::run. Only the
@@ -40,6 +45,7 @@ private:
     aid::ports::UiNotifier& ui_;
     aid::crosscutting::Clock& clock_;
     const aid::crosscutting::Config::TicketRouting& cfg_;
+    CallPrefetch* prefetch_;
 };
 
 } // namespace aid::usecases
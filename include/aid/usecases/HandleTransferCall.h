@@ -11,18 +11,24 @@ class UiNotifier;
 
 namespace aid::usecases {
 
+class CallPrefetch;
+
 // Orchestrates the Transfer event — rewrite the per-call comment line to
 // show the new assignee and update ticket.assignee. Lookup by callid
 // substring (a transfer on a multi-call ticket).
 class HandleTransferCall {
 public:
-    HandleTransferCall(aid::ports::TicketStore& ts, aid::ports::UiNotifier& ui);
+    // `prefetch` (optional) answers the callid lookup from the read started
+    // at ingest; see CallPrefetch.
+    HandleTransferCall(aid::ports::TicketStore& ts, aid::ports::UiNotifier& ui,
+                       CallPrefetch* prefetch = nullptr);
 
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<void>> run(const aid::TransferCall& ev);
 
 private:
     aid::ports::TicketStore& ts_;
     aid::ports::UiNotifier& ui_;
+    CallPrefetch* prefetch_;
 };
 
 } // namespace aid::usecases
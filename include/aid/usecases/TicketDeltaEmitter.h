@@ -16,14 +16,18 @@ namespace aid::usecases {
 // notifyInvalidate("dashboard") broadcast (which forced every connected client
 // to refetch the whole dashboard) with a precise per-recipient push:
 //
-//   recipientsFor(ticket)  →  for each viewer  →  buildEntry(ticket, viewer)
-//                                              →  UiNotifier::pushTicketUpsert
+//   recipientsFor(ticket)  →  buildEntries(ticket, recipients)
+//                          →  UiNotifier::pushTicketUpserts (one frame per viewer)
+//
+// buildEntries projects the ticket once and adds a small per-viewer overlay,
+// so a delta on a ticket with many recipients does not rebuild (or, in the
+// WebSocket hub, reserialize) the whole entry for each of them.
 //
 // A ticket that is no longer on any dashboard (status not New / In Progress —
 // e.g. Closed via /ui/close) is removed instead of upserted, so a stale row
 // disappears live.
 //
-// Depends only on the two ports (TicketStore for recipientsFor + buildEntry,
+// Depends only on the two ports (TicketStore for recipientsFor + buildEntries,
 // UiNotifier for the push), so it stays in the use-case layer with no Drogon /
 // JSON / adapter coupling. Construct it from the refs a use case already holds.
 class TicketDeltaEmitter {
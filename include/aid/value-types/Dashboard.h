@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <vector>
@@ -44,6 +45,33 @@ struct DashboardEntry {
     Timestamp updatedAt{};
 };
 
+// What one viewer's copy of a ticket's DashboardEntry adds to the part every
+// viewer shares: the two fields that depend on who is looking.
+struct ViewerOverlay {
+    UserHandle viewer;
+    std::optional<CallId> activeCallForViewer;
+    std::vector<UserHandle> otherActiveUsers;
+};
+
+// One ticket projected for several viewers at once (the live-delta fan-out).
+// `entry` holds every viewer-independent field, with activeCallForViewer and
+// otherActiveUsers left empty; `viewers` holds one overlay per viewer, in the
+// order they were asked for.
+struct SharedDashboardEntry {
+    DashboardEntry entry;
+    std::vector<ViewerOverlay> viewers;
+};
+
+// The DashboardEntry `overlay`'s viewer sees: `shared.entry` with the two
+// per-viewer fields filled in.
+[[nodiscard]] inline DashboardEntry entryFor(const SharedDashboardEntry& shared,
+                                             const ViewerOverlay& overlay) {
+    DashboardEntry e = shared.entry;
+    e.activeCallForViewer = overlay.activeCallForViewer;
+    e.otherActiveUsers = overlay.otherActiveUsers;
+    return e;
+}
+
 struct ActiveCall {
     TicketId ticketId;
     CallId callId;
@@ -51,6 +79,22 @@ struct ActiveCall {
     PhoneNumber callerNumber;
 };
 
+// How current a dashboard listing is. `version` is the backend's change
+// counter at the moment the list was cut (it only grows, so a client can tell
+// which of two listings is newer); `reconciledAt` is when the oldest upstream
+// scan the list was served from ran. A backend that queries upstream on every
+// listing has no such stamp.
+struct DashboardStamp {
+    std::uint64_t version = 0;
+    Timestamp reconciledAt{};
+};
+
+// A viewer's dashboard rows plus the stamp of the state they were cut from.
+struct DashboardListing {
+    std::vector<DashboardEntry> entries;
+    std::optional<DashboardStamp> stamp;
+};
+
 struct DashboardView {
     std::vector<DashboardEntry> tickets;
     std::optional<ActiveCall> active;
@@ -58,6 +102,9 @@ struct DashboardView {
     // by looking up the active call's caller number. nullopt when there is
     // no active call, or the address book has no match.
     std::optional<Contact> addressCallInformation;
+    // Consistency stamp of `tickets` (see DashboardStamp); nullopt when the
+    // backend does not stamp its listings.
+    std::optional<DashboardStamp> stamp;
 };
 
 } // namespace aid
@@ -1,5 +1,6 @@
-// DaviCalAdapter class body — composed of canonicalize() (libphonenumber)
-// and the two-step lookup() pipeline (DcHttp + DcVCardParser). The
+// DaviCalAdapter class body — composed of canonicalize() (libphonenumber),
+// the mirrored/cached two-step lookup() pipeline (DcHttp + DcVCardParser)
+// and the refreshContacts() that keeps the mirror current. The
 // extern "C" factory triplet that the daemon dlopens lives in
 // factory.cpp; keeping the class body in this .cpp (which is part of
 // aid_davical_internals) lets tests construct DaviCalAdapter directly.
@@ -11,17 +12,29 @@
 
 #include <algorithm>
 #include <cctype>
+#include <coroutine>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <span>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <utility>
 #include <vector>
 
+#include "aid/adapters/davical/internal/CanonicalMemo.h"
+#include "aid/adapters/davical/internal/ContactMirror.h"
+#include "aid/adapters/davical/internal/ContactSnapshot.h"
 #include "aid/adapters/davical/internal/DcVCardParser.h"
+#include "aid/adapters/davical/internal/SnapshotWriter.h"
+#include "aid/crosscutting/Logger.h"
 #include "aid/infrastructure/HttpClient.h"
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Error.h"
 #include "aid/plumbing/Result.h"
 #include "aid/plumbing/Task.h"
@@ -34,6 +47,32 @@ DaviCalAdapter::DaviCalAdapter(std::unique_ptr<aid::infrastructure::HttpClient>
                                DaviCalConfig cfg)
     : httpClient_(std::move(http)), cfg_(std::move(cfg)),
       http_(*httpClient_, cfg_.user, cfg_.password) {
+    if (cfg_.snapshotPath.empty()) {
+        return;
+    }
+    // A snapshot of other books (the config changed since it was written) is
+    // ignored; the first refresh replaces it on disk.
+    auto snapshot = internal::ContactSnapshot::load(cfg_.snapshotPath);
+    if (snapshot && snapshot->bookAddresses == cfg_.bookAddresses &&
+        snapshot->bookCompanies == cfg_.bookCompanies) {
+        const auto count =
+            snapshot->addresses.contacts.size() + snapshot->companies.contacts.size();
+        const auto since = mirror_.generation();
+        mirror_.install(internal::ContactMirror::Book::Addresses,
+                        std::move(snapshot->addresses.contacts),
+                        std::move(snapshot->addresses.ctag), since);
+        mirror_.install(internal::ContactMirror::Book::Companies,
+                        std::move(snapshot->companies.contacts),
+                        std::move(snapshot->companies.ctag), since);
+        aid::crosscutting::Logger::instance().info("davical plugin: warm start, " +
+                                                   std::to_string(count) +
+                                                   " contacts from " + cfg_.snapshotPath);
+    } else if (std::error_code ec; std::filesystem::exists(cfg_.snapshotPath, ec)) {
+        aid::crosscutting::Logger::instance().warn("davical plugin: ignoring contact snapshot " +
+                                                   cfg_.snapshotPath +
+                                                   " (unreadable, or of other books)");
+    }
+    snapshotWriter_ = std::make_unique<internal::SnapshotWriter>(cfg_.snapshotPath);
 }
 
 void DaviCalAdapter::cancelPendingRequests() noexcept {
@@ -45,6 +84,11 @@ void DaviCalAdapter::cancelPendingRequests() noexcept {
     httpClient_->cancelInFlight();
 }
 
+void DaviCalAdapter::flushContactCache() noexcept {
+    contactCache_.clear();
+    mirror_.clear();
+}
+
 namespace {
 
 // EXTENSION_LENGTH: when the exact-match
@@ -135,6 +179,22 @@ constexpr std::size_t EXTENSION_LENGTH = 5;
 </C:addressbook-query>)";
 }
 
+// PROPFIND body for refreshContacts(): just the collection's CTag
+// (calendarserver.org extension, which DaviCal implements for address books
+// as well as calendars).
+constexpr std::string_view kCtagQuery = R"(<?xml version="1.0" encoding="utf-8" ?>
+<D:propfind xmlns:D="DAV:" xmlns:CS="http://calendarserver.org/ns/">
+  <D:prop><CS:getctag/></D:prop>
+</D:propfind>)";
+
+// addressbook-query for the whole book: an empty filter matches every vCard
+// (RFC 6352 §10.5). Fixed text, no interpolation.
+constexpr std::string_view kFullBookQuery = R"(<?xml version="1.0" encoding="utf-8" ?>
+<C:addressbook-query xmlns:D="DAV:" xmlns:C="urn:ietf:params:xml:ns:carddav">
+  <D:prop><C:address-data/></D:prop>
+  <C:filter/>
+</C:addressbook-query>)";
+
 // Exact-TEL picker for the addresses (Person) pass. The "contains" server
 // filter can return superstring false positives, and DcVCardParser already
 // trims surrounding whitespace off every parsed TEL — so the authoritative
@@ -200,27 +260,68 @@ aid::PhoneNumber DaviCalAdapter::canonicalize(aid::PhoneNumber raw) const noexce
     // noexcept. Any failure (parse error, bad region, unrecognised
     // input, internal exception) collapses to PhoneNumber{} so the
     // incognito branch takes over upstream.
+    //
+    // The memo answers a string seen before, and an E.164 number this
+    // method produced (E164 output re-parses to itself), without
+    // libphonenumber. Other '+digits' strings are not passed through on
+    // their form alone: Parse strips a national prefix after the country
+    // code and IsPossibleNumber applies per-country lengths, so "+4901701…"
+    // or an unknown country code still goes to libphonenumber once.
     try {
-        auto* utilPtr = i18n::phonenumbers::PhoneNumberUtil::GetInstance();
-        if (utilPtr == nullptr) {
-            return aid::PhoneNumber{};
-        }
-        i18n::phonenumbers::PhoneNumber parsed;
-        const auto status = utilPtr->Parse(raw.v, cfg_.defaultRegion, &parsed);
-        if (status != i18n::phonenumbers::PhoneNumberUtil::NO_PARSING_ERROR) {
-            return aid::PhoneNumber{};
-        }
-        if (!utilPtr->IsPossibleNumber(parsed)) {
-            return aid::PhoneNumber{};
+        if (auto known = canonicalMemo_.lookup(cfg_.defaultRegion, raw.v)) {
+            return std::move(*known);
         }
-        std::string e164;
-        utilPtr->Format(parsed, i18n::phonenumbers::PhoneNumberUtil::E164, &e164);
-        return aid::PhoneNumber{std::move(e164)};
+        auto canonical = canonicalizeUncached(raw.v);
+        canonicalMemo_.record(cfg_.defaultRegion, raw.v, canonical);
+        return canonical;
     } catch (...) {
         return aid::PhoneNumber{};
     }
 }
 
+aid::PhoneNumber DaviCalAdapter::canonicalizeUncached(const std::string& raw) const {
+    auto* utilPtr = i18n::phonenumbers::PhoneNumberUtil::GetInstance();
+    if (utilPtr == nullptr) {
+        return aid::PhoneNumber{};
+    }
+    i18n::phonenumbers::PhoneNumber parsed;
+    const auto status = utilPtr->Parse(raw, cfg_.defaultRegion, &parsed);
+    if (status != i18n::phonenumbers::PhoneNumberUtil::NO_PARSING_ERROR) {
+        return aid::PhoneNumber{};
+    }
+    if (!utilPtr->IsPossibleNumber(parsed)) {
+        return aid::PhoneNumber{};
+    }
+    std::string e164;
+    utilPtr->Format(parsed, i18n::phonenumbers::PhoneNumberUtil::E164, &e164);
+    return aid::PhoneNumber{std::move(e164)};
+}
+
+internal::CanonicalMemo::Stats DaviCalAdapter::canonicalizeStats() const noexcept {
+    return canonicalMemo_.stats();
+}
+
+struct DaviCalAdapter::FlightWait {
+    std::mutex& mtx;
+    Flight& flight;
+
+    bool await_ready() {
+        std::scoped_lock lk{mtx};
+        return flight.result.has_value();
+    }
+
+    bool await_suspend(std::coroutine_handle<> h) {
+        std::scoped_lock lk{mtx};
+        if (flight.result.has_value()) {
+            return false;
+        }
+        flight.waiters.push_back(Flight::Waiter{h, aid::plumbing::currentDeadline()});
+        return true;
+    }
+
+    void await_resume() const noexcept {}
+};
+
 aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Contact>>>
 DaviCalAdapter::lookup(aid::PhoneNumber number) {
     // Precondition: caller has already canonicalised
@@ -230,6 +331,75 @@ DaviCalAdapter::lookup(aid::PhoneNumber number) {
     if (number.empty()) {
         co_return std::optional<aid::Contact>{};
     }
+    // The mirror is only asked about numbers lookupRemote would accept, so a
+    // non-canonical one still fails the same way warm or cold.
+    if (isCanonicalE164(number.v)) {
+        if (auto mirrored = mirror_.lookup(number, EXTENSION_LENGTH)) {
+            co_return std::move(*mirrored);
+        }
+    }
+    if (auto cached = contactCache_.lookup(number)) {
+        co_return std::move(*cached);
+    }
+
+    // Join the lookup already in flight for this number, or lead one.
+    std::shared_ptr<Flight> flight;
+    bool leads = false;
+    {
+        std::scoped_lock lk{flightMtx_};
+        auto [it, first] = flights_.try_emplace(number.v);
+        if (first) {
+            it->second = std::make_shared<Flight>();
+            leads = true;
+        }
+        flight = it->second;
+    }
+    if (!leads) {
+        co_await FlightWait{flightMtx_, *flight};
+        co_return *flight->result;
+    }
+
+    // Errors are not cached: the next caller retries upstream. A throw (OOM,
+    // the XML or vCard parser) becomes an error too, so the waiters below are
+    // always woken and the flight always erased — otherwise every later
+    // lookup for this number would join a flight that never lands.
+    const auto since = contactCache_.generation();
+    aid::plumbing::Result<std::optional<aid::Contact>> result = std::optional<aid::Contact>{};
+    try {
+        result = co_await lookupRemote(number);
+        if (result) {
+            contactCache_.record(number, *result, since);
+        }
+    } catch (const std::exception& e) {
+        result = aid::plumbing::unexpected{aid::plumbing::Error{
+            aid::plumbing::ErrorCode::Unknown, std::string{"davical lookup threw: "} + e.what(),
+            std::nullopt}};
+    } catch (...) {
+        result = aid::plumbing::unexpected{aid::plumbing::Error{
+            aid::plumbing::ErrorCode::Unknown, "davical lookup threw", std::nullopt}};
+    }
+
+    // Hand the outcome to the waiters; resume them only after dropping the lock.
+    // Each runs under its own event's deadline, not this leader's.
+    std::vector<Flight::Waiter> wake;
+    {
+        std::scoped_lock lk{flightMtx_};
+        flight->result = result;
+        wake = std::exchange(flight->waiters, {});
+        flights_.erase(number.v);
+    }
+    for (const auto& w : wake) {
+        const aid::plumbing::DeadlineScope scope{w.deadline};
+        w.handle.resume();
+    }
+    co_return result;
+}
+
+aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Contact>>>
+DaviCalAdapter::lookupRemote(aid::PhoneNumber number) {
+    if (cfg_.concurrentLookups) {
+        co_return co_await lookupRemoteConcurrent(std::move(number));
+    }
 
     // Step 1: exact match on the addresses book (Person). The "contains"
     // server filter tolerates whitespace-padded stored TELs; pickExactMatch
@@ -274,6 +444,126 @@ DaviCalAdapter::lookup(aid::PhoneNumber number) {
     co_return std::optional<aid::Contact>{};
 }
 
+aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Contact>>>
+DaviCalAdapter::lookupRemoteConcurrent(aid::PhoneNumber number) {
+    // Same two passes and the same outcome as the serial path, but both
+    // REPORTs are sent before either is awaited (Task starts eagerly), so a
+    // cold lookup costs the slower round trip rather than the sum of both.
+    // Both queries are built first: an invalid number fails before any request.
+    auto personQuery = buildExactQuery(number);
+    if (!personQuery) {
+        co_return aid::plumbing::unexpected{personQuery.error()};
+    }
+    std::optional<std::string> companyQuery;
+    if (number.v.size() > EXTENSION_LENGTH) {
+        aid::PhoneNumber trimmed{number.v.substr(0, number.v.size() - EXTENSION_LENGTH)};
+        auto query = buildPrefixQuery(trimmed);
+        if (!query) {
+            co_return aid::plumbing::unexpected{query.error()};
+        }
+        companyQuery = std::move(*query);
+    }
+
+    auto personReport = http_.report(cfg_.bookAddresses, *personQuery);
+    std::optional<aid::plumbing::Task<aid::plumbing::Result<std::string>>> companyReport;
+    if (companyQuery) {
+        companyReport.emplace(http_.report(cfg_.bookCompanies, *companyQuery));
+    }
+
+    // The company REPORT is awaited even when the person pass decides the
+    // outcome: HttpClient cannot cancel a single request, and dropping its
+    // Task mid-flight would leave the response callback resuming a freed
+    // frame. Its reply is then discarded unparsed, errors included.
+    auto personResp = co_await personReport;
+    std::optional<aid::plumbing::Result<std::string>> companyResp;
+    if (companyReport) {
+        auto& report = *companyReport;
+        companyResp.emplace(co_await report);
+    }
+
+    // Person first: its hit (or its error) wins over anything the company
+    // pass found, exactly as if the company REPORT had never been sent.
+    if (!personResp) {
+        co_return aid::plumbing::unexpected{personResp.error()};
+    }
+    auto people = internal::DcVCardParser::parse(*personResp);
+    if (auto picked = pickExactMatch(people, number)) {
+        picked->kind = aid::AddressKind::Person;
+        co_return std::optional<aid::Contact>{std::move(*picked)};
+    }
+
+    if (companyResp) {
+        if (!*companyResp) {
+            co_return aid::plumbing::unexpected{companyResp->error()};
+        }
+        auto companies = internal::DcVCardParser::parse(**companyResp);
+        if (auto picked = pickLongestCommonPrefix(companies, number)) {
+            picked->kind = aid::AddressKind::Company;
+            co_return std::optional<aid::Contact>{std::move(*picked)};
+        }
+    }
+
+    co_return std::optional<aid::Contact>{};
+}
+
+aid::plumbing::Task<aid::plumbing::Result<void>> DaviCalAdapter::refreshContacts() {
+    // Both books are read under one generation, so a flush between the two
+    // drops both installs and the mirror cannot come back half pre-flush.
+    const auto since = mirror_.generation();
+    auto addresses =
+        co_await refreshBook(internal::ContactMirror::Book::Addresses, cfg_.bookAddresses, since);
+    if (!addresses) {
+        co_return aid::plumbing::unexpected{addresses.error()};
+    }
+    auto companies =
+        co_await refreshBook(internal::ContactMirror::Book::Companies, cfg_.bookCompanies, since);
+    if (!companies) {
+        co_return aid::plumbing::unexpected{companies.error()};
+    }
+
+    // Save the mirror when it changed. Both books must be there: a flush
+    // between the downloads leaves it cold, and a cold mirror is not saved.
+    if (snapshotWriter_ && (*addresses || *companies)) {
+        auto addressBook = mirror_.exportBook(internal::ContactMirror::Book::Addresses);
+        auto companyBook = mirror_.exportBook(internal::ContactMirror::Book::Companies);
+        if (addressBook && companyBook) {
+            snapshotWriter_->schedule(internal::Snapshot{cfg_.bookAddresses, cfg_.bookCompanies,
+                                                         std::move(*addressBook),
+                                                         std::move(*companyBook)});
+        }
+    }
+    co_return aid::plumbing::Result<void>{};
+}
+
+aid::plumbing::Task<aid::plumbing::Result<bool>>
+DaviCalAdapter::refreshBook(internal::ContactMirror::Book book, std::string url,
+                            std::uint64_t since) {
+    auto props = co_await http_.propfind(url, kCtagQuery);
+    if (!props) {
+        co_return aid::plumbing::unexpected{props.error()};
+    }
+    // Unchanged CTag: the mirrored copy is current. A server that reports no
+    // CTag never compares equal, so its book is downloaded every time.
+    auto ctag = internal::DcVCardParser::parseCtag(*props);
+    if (ctag && ctag == mirror_.ctag(book)) {
+        co_return false;
+    }
+
+    auto resp = co_await http_.report(url, kFullBookQuery);
+    if (!resp) {
+        co_return aid::plumbing::unexpected{resp.error()};
+    }
+    auto contacts = internal::DcVCardParser::parse(*resp);
+    // parse() cannot tell an empty book from a body it could not read, so an
+    // empty result is installed without its CTag: it is downloaded again on
+    // the next refresh instead of being pinned until the book changes.
+    if (contacts.empty()) {
+        ctag.reset();
+    }
+    mirror_.install(book, std::move(contacts), std::move(ctag), since);
+    co_return true;
+}
+
 aid::plumbing::Task<aid::plumbing::Result<void>> DaviCalAdapter::ping() {
     // Cold-start ping: auth'd PROPFIND Depth: 0 on the configured
     // addresses book URL — DaviCal answers 207 Multi-Status when reachable.
@@ -7,6 +7,7 @@
 #include <trantor/net/EventLoop.h>
 
 #include <chrono>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <nlohmann/json.hpp>
@@ -21,6 +22,7 @@
 #include "aid/adapters/support/HttpSupport.h"
 #include "aid/crosscutting/Logger.h"
 #include "aid/infrastructure/HttpClient.h"
+#include "aid/plumbing/Deadline.h"
 #include "aid/ports/AddressBook.h"
 
 #define AID_PLUGIN_EXPORT __attribute__((visibility("default")))
@@ -43,6 +45,24 @@ namespace {
         cfg.user = root.value("user", std::string{});
         cfg.password = root.value("password", std::string{});
         cfg.defaultRegion = root.value("defaultRegion", std::string{});
+        // snapshotPath is optional — without it the contact mirror lives in
+        // memory only and starts cold after every restart.
+        if (auto sp = root.find("snapshotPath"); sp != root.end()) {
+            if (!sp->is_string() || sp->get<std::string>().empty()) {
+                Logger::instance().error("davical plugin: snapshotPath must be a non-empty string",
+                                         LogType::BACKEND);
+                return std::nullopt;
+            }
+            cfg.snapshotPath = sp->get<std::string>();
+        }
+        if (auto cl = root.find("concurrentLookups"); cl != root.end()) {
+            if (!cl->is_boolean()) {
+                Logger::instance().error("davical plugin: concurrentLookups must be a boolean",
+                                         LogType::BACKEND);
+                return std::nullopt;
+            }
+            cfg.concurrentLookups = cl->get<bool>();
+        }
         if (cfg.bookAddresses.empty() || cfg.bookCompanies.empty() || cfg.defaultRegion.empty()) {
             Logger::instance().error(
                 "davical plugin: missing required keys (bookAddresses / bookCompanies / "
@@ -151,3 +171,10 @@ extern "C" AID_PLUGIN_EXPORT std::uint64_t aid_plugin_abi_layout_tag(void) {
 extern "C" AID_PLUGIN_EXPORT const char* aid_plugin_contract_tag(void) {
     return aid::abi::kPluginContractTag;
 }
+
+// Event-deadline bridge: the daemon hands over its per-thread deadline slot
+// (plumbing/Deadline.h) before the factory runs, so this `.so`'s HttpClient
+// clamps requests to the budget the daemon's mailbox installed.
+extern "C" AID_PLUGIN_EXPORT void aid_plugin_bind_deadline_slot(std::int64_t* (*slot)()) {
+    aid::plumbing::bindDeadlineSlot(slot);
+}
@@ -0,0 +1,68 @@
+#include "aid/adapters/davical/internal/CanonicalMemo.h"
+
+#include <utility>
+
+namespace aid::adapters::davical::internal {
+
+namespace {
+
+// '\n' never appears in a region code, so no (region, raw) pair collides.
+[[nodiscard]] std::string keyOf(std::string_view region, std::string_view raw) {
+    std::string key;
+    key.reserve(region.size() + 1 + raw.size());
+    key.append(region);
+    key.push_back('\n');
+    key.append(raw);
+    return key;
+}
+
+} // namespace
+
+std::optional<aid::PhoneNumber> CanonicalMemo::lookup(std::string_view region,
+                                                      std::string_view raw) {
+    const auto key = keyOf(region, raw);
+    std::lock_guard lk{mtx_};
+    auto it = byKey_.find(key);
+    if (it == byKey_.end()) {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    lru_.splice(lru_.begin(), lru_, it->second.lru);
+    return it->second.canonical;
+}
+
+void CanonicalMemo::record(std::string_view region, std::string_view raw,
+                           const aid::PhoneNumber& canonical) {
+    std::lock_guard lk{mtx_};
+    insertLocked(keyOf(region, raw), canonical);
+    if (!canonical.empty() && canonical.v != raw) {
+        insertLocked(keyOf(region, canonical.v), canonical);
+    }
+}
+
+void CanonicalMemo::insertLocked(std::string key, const aid::PhoneNumber& canonical) {
+    auto it = byKey_.find(key);
+    if (it != byKey_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second.lru);
+        it->second.canonical = canonical;
+        return;
+    }
+    lru_.push_front(key);
+    byKey_.emplace(std::move(key), Entry{canonical, lru_.begin()});
+    while (byKey_.size() > kMaxEntries) {
+        byKey_.erase(lru_.back());
+        lru_.pop_back();
+    }
+}
+
+CanonicalMemo::Stats CanonicalMemo::stats() const noexcept {
+    return Stats{hits_.load(std::memory_order_relaxed), misses_.load(std::memory_order_relaxed)};
+}
+
+std::size_t CanonicalMemo::size() {
+    std::lock_guard lk{mtx_};
+    return byKey_.size();
+}
+
+} // namespace aid::adapters::davical::internal
@@ -0,0 +1,70 @@
+#include "aid/adapters/davical/internal/ContactCache.h"
+
+#include <utility>
+
+namespace aid::adapters::davical::internal {
+
+ContactCache::ContactCache(Clock clock) : clock_(std::move(clock)) {
+    if (!clock_) {
+        clock_ = [] { return std::chrono::steady_clock::now(); };
+    }
+}
+
+std::optional<std::optional<aid::Contact>> ContactCache::lookup(const aid::PhoneNumber& number) {
+    const auto now = clock_();
+    std::lock_guard lk{mtx_};
+    auto it = byNumber_.find(number.v);
+    if (it == byNumber_.end()) {
+        return std::nullopt;
+    }
+    if (it->second.expiresAt <= now) {
+        lru_.erase(it->second.lru);
+        byNumber_.erase(it);
+        return std::nullopt;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second.lru);
+    return it->second.contact;
+}
+
+std::uint64_t ContactCache::generation() {
+    std::lock_guard lk{mtx_};
+    return generation_;
+}
+
+void ContactCache::record(const aid::PhoneNumber& number, std::optional<aid::Contact> contact,
+                          std::uint64_t since) {
+    const auto now = clock_();
+    const auto ttl = contact ? std::chrono::duration_cast<std::chrono::seconds>(kPositiveTtl)
+                             : kNegativeTtl;
+    std::lock_guard lk{mtx_};
+    if (since != generation_) {
+        return; // flushed while the lookup was in flight
+    }
+    auto it = byNumber_.find(number.v);
+    if (it != byNumber_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second.lru);
+        it->second.contact = std::move(contact);
+        it->second.expiresAt = now + ttl;
+        return;
+    }
+    lru_.push_front(number.v);
+    byNumber_.emplace(number.v, Entry{std::move(contact), now + ttl, lru_.begin()});
+    while (byNumber_.size() > kMaxEntries) {
+        byNumber_.erase(lru_.back());
+        lru_.pop_back();
+    }
+}
+
+void ContactCache::clear() {
+    std::lock_guard lk{mtx_};
+    byNumber_.clear();
+    lru_.clear();
+    ++generation_;
+}
+
+std::size_t ContactCache::size() {
+    std::lock_guard lk{mtx_};
+    return byNumber_.size();
+}
+
+} // namespace aid::adapters::davical::internal
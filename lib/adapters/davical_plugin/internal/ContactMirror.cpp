@@ -0,0 +1,154 @@
+#include "aid/adapters/davical/internal/ContactMirror.h"
+
+#include <utility>
+
+namespace aid::adapters::davical::internal {
+
+namespace {
+
+// Trie slot for a TEL character: '+' is 10, digits are themselves; anything
+// else ends the walk.
+[[nodiscard]] std::optional<std::size_t> slotOf(char c) noexcept {
+    if (c == '+') {
+        return 10;
+    }
+    if (c >= '0' && c <= '9') {
+        return static_cast<std::size_t>(c - '0');
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+std::shared_ptr<const ContactMirror::Index>
+ContactMirror::build(Book book, std::vector<aid::Contact> contacts,
+                     std::optional<std::string> ctag) {
+    auto idx = std::make_shared<Index>();
+    idx->contacts = std::move(contacts);
+    idx->ctag = std::move(ctag);
+    const auto kind =
+        book == Book::Addresses ? aid::AddressKind::Person : aid::AddressKind::Company;
+    for (auto& c : idx->contacts) {
+        c.kind = kind;
+    }
+
+    if (book == Book::Addresses) {
+        for (std::size_t i = 0; i < idx->contacts.size(); ++i) {
+            for (const auto& tel : idx->contacts[i].phoneNumbers) {
+                idx->byTel.try_emplace(tel.v, i); // first contact wins
+            }
+        }
+        return idx;
+    }
+
+    idx->nodes.emplace_back();
+    for (std::size_t i = 0; i < idx->contacts.size(); ++i) {
+        for (const auto& tel : idx->contacts[i].phoneNumbers) {
+            std::size_t node = 0;
+            for (const char ch : tel.v) {
+                const auto slot = slotOf(ch);
+                if (!slot) {
+                    break;
+                }
+                // Contacts are inserted in order, so the one that creates a
+                // node is the lowest index through it.
+                auto next = idx->nodes[node].child[*slot];
+                if (next == 0) {
+                    next = static_cast<std::uint32_t>(idx->nodes.size());
+                    idx->nodes[node].child[*slot] = next;
+                    idx->nodes.emplace_back();
+                    idx->nodes[next].first = i;
+                }
+                node = next;
+            }
+        }
+    }
+    return idx;
+}
+
+std::optional<std::optional<aid::Contact>>
+ContactMirror::lookup(const aid::PhoneNumber& number, std::size_t extensionLength) const {
+    std::shared_ptr<const Index> addresses;
+    std::shared_ptr<const Index> companies;
+    {
+        std::lock_guard lk{mtx_};
+        addresses = addresses_;
+        companies = companies_;
+    }
+    if (!addresses || !companies) {
+        return std::nullopt;
+    }
+
+    if (auto it = addresses->byTel.find(number.v); it != addresses->byTel.end()) {
+        return addresses->contacts[it->second];
+    }
+
+    if (number.v.size() <= extensionLength) {
+        return std::optional<aid::Contact>{};
+    }
+    // Walk as far as any company TEL follows the number. The depth reached is
+    // the longest common prefix; it must cover the number minus its extension.
+    std::size_t node = 0;
+    std::size_t depth = 0;
+    for (const char ch : number.v) {
+        const auto slot = slotOf(ch);
+        if (!slot) {
+            break;
+        }
+        const auto next = companies->nodes[node].child[*slot];
+        if (next == 0) {
+            break;
+        }
+        node = next;
+        ++depth;
+    }
+    if (depth < number.v.size() - extensionLength) {
+        return std::optional<aid::Contact>{};
+    }
+    return companies->contacts[companies->nodes[node].first];
+}
+
+std::uint64_t ContactMirror::generation() const {
+    std::lock_guard lk{mtx_};
+    return generation_;
+}
+
+void ContactMirror::install(Book book, std::vector<aid::Contact> contacts,
+                            std::optional<std::string> ctag, std::uint64_t since) {
+    auto idx = build(book, std::move(contacts), std::move(ctag));
+    std::lock_guard lk{mtx_};
+    if (since != generation_) {
+        return; // flushed while the download was in flight
+    }
+    (book == Book::Addresses ? addresses_ : companies_) = std::move(idx);
+}
+
+std::optional<std::string> ContactMirror::ctag(Book book) const {
+    std::lock_guard lk{mtx_};
+    const auto& idx = book == Book::Addresses ? addresses_ : companies_;
+    if (!idx) {
+        return std::nullopt;
+    }
+    return idx->ctag;
+}
+
+std::optional<SnapshotBook> ContactMirror::exportBook(Book book) const {
+    std::shared_ptr<const Index> idx;
+    {
+        std::lock_guard lk{mtx_};
+        idx = book == Book::Addresses ? addresses_ : companies_;
+    }
+    if (!idx) {
+        return std::nullopt;
+    }
+    return SnapshotBook{idx->contacts, idx->ctag};
+}
+
+void ContactMirror::clear() {
+    std::lock_guard lk{mtx_};
+    addresses_.reset();
+    companies_.reset();
+    ++generation_;
+}
+
+} // namespace aid::adapters::davical::internal
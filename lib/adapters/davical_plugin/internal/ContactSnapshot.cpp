@@ -0,0 +1,308 @@
+#include "aid/adapters/davical/internal/ContactSnapshot.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <system_error>
+#include <utility>
+
+#include "aid/value-types/Ids.h"
+
+namespace aid::adapters::davical::internal {
+
+namespace {
+
+constexpr std::string_view kMagic = "AIDCSNAP";
+
+// FNV-1a, 64-bit: catches a torn or bit-rotted file; not a defence against
+// anyone who can write to the state directory.
+[[nodiscard]] std::uint64_t fnv1a(std::string_view bytes) noexcept {
+    std::uint64_t h = 14695981039346656037ULL;
+    for (const char c : bytes) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+class Writer {
+public:
+    void raw(std::string_view s) { out_.append(s); }
+    template <class T>
+    void num(T v) {
+        out_.append(reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+    void str(std::string_view s) {
+        num(static_cast<std::uint32_t>(s.size()));
+        out_.append(s);
+    }
+    void book(const SnapshotBook& b) {
+        num(static_cast<std::uint8_t>(b.ctag ? 1 : 0));
+        str(b.ctag.value_or(std::string{}));
+        num(static_cast<std::uint32_t>(b.contacts.size()));
+        for (const auto& c : b.contacts) {
+            str(c.name);
+            str(c.companyName);
+            num(static_cast<std::uint32_t>(c.phoneNumbers.size()));
+            for (const auto& tel : c.phoneNumbers) {
+                str(tel.v);
+            }
+            num(static_cast<std::uint32_t>(c.projectIds.size()));
+            for (const auto& id : c.projectIds) {
+                str(id.v);
+            }
+        }
+    }
+    [[nodiscard]] std::string take() { return std::move(out_); }
+
+private:
+    std::string out_;
+};
+
+// Bounds-checked cursor: every read fails once the input is exhausted, and the
+// failure sticks, so decode() checks ok() once per record rather than per field.
+class Reader {
+public:
+    explicit Reader(std::string_view in) noexcept : in_(in) {}
+
+    template <class T>
+    [[nodiscard]] T num() noexcept {
+        T v{};
+        if (!ok_ || in_.size() < sizeof(T)) {
+            ok_ = false;
+            return v;
+        }
+        std::memcpy(&v, in_.data(), sizeof(T));
+        in_.remove_prefix(sizeof(T));
+        return v;
+    }
+    [[nodiscard]] std::string str() {
+        const auto n = num<std::uint32_t>();
+        if (!ok_ || in_.size() < n) {
+            ok_ = false;
+            return {};
+        }
+        std::string s{in_.substr(0, n)};
+        in_.remove_prefix(n);
+        return s;
+    }
+    // A count is only plausible if each element could still take `minBytes`;
+    // stops a corrupt count from reserving gigabytes.
+    [[nodiscard]] std::uint32_t count(std::size_t minBytes) noexcept {
+        const auto n = num<std::uint32_t>();
+        if (ok_ && n > in_.size() / minBytes) {
+            ok_ = false;
+        }
+        return ok_ ? n : 0;
+    }
+    [[nodiscard]] std::optional<SnapshotBook> book() {
+        SnapshotBook b;
+        const bool hasCtag = num<std::uint8_t>() != 0;
+        auto ctag = str();
+        if (hasCtag) {
+            b.ctag = std::move(ctag);
+        }
+        const auto contacts = count(4 * sizeof(std::uint32_t));
+        b.contacts.reserve(contacts);
+        for (std::uint32_t i = 0; i < contacts && ok_; ++i) {
+            aid::Contact c;
+            c.name = str();
+            c.companyName = str();
+            const auto tels = count(sizeof(std::uint32_t));
+            for (std::uint32_t t = 0; t < tels && ok_; ++t) {
+                c.phoneNumbers.push_back(aid::PhoneNumber{str()});
+            }
+            const auto ids = count(sizeof(std::uint32_t));
+            for (std::uint32_t p = 0; p < ids && ok_; ++p) {
+                c.projectIds.push_back(aid::ProjectId{str()});
+            }
+            b.contacts.push_back(std::move(c));
+        }
+        if (!ok_) {
+            return std::nullopt;
+        }
+        return b;
+    }
+    [[nodiscard]] bool ok() const noexcept { return ok_; }
+    [[nodiscard]] bool atEnd() const noexcept { return in_.empty(); }
+
+private:
+    std::string_view in_;
+    bool ok_{true};
+};
+
+// Read-only mapping of a whole file, unmapped and closed on scope exit.
+class MappedFile {
+public:
+    explicit MappedFile(const std::filesystem::path& path) noexcept {
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd_ < 0) {
+            return;
+        }
+        struct stat st{};
+        if (::fstat(fd_, &st) != 0 || st.st_size <= 0) {
+            return;
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+        void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (p == MAP_FAILED) {
+            size_ = 0;
+            return;
+        }
+        data_ = p;
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+    ~MappedFile() {
+        if (data_ != nullptr) {
+            ::munmap(data_, size_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    [[nodiscard]] std::optional<std::string_view> bytes() const noexcept {
+        if (data_ == nullptr) {
+            return std::nullopt;
+        }
+        return std::string_view{static_cast<const char*>(data_), size_};
+    }
+
+private:
+    int fd_{-1};
+    void* data_{nullptr};
+    std::size_t size_{0};
+};
+
+// Owns one descriptor for save(): closed on every early return.
+class OwnedFd {
+public:
+    explicit OwnedFd(int fd) noexcept : fd_(fd) {}
+    OwnedFd(const OwnedFd&) = delete;
+    OwnedFd& operator=(const OwnedFd&) = delete;
+    OwnedFd(OwnedFd&&) = delete;
+    OwnedFd& operator=(OwnedFd&&) = delete;
+    ~OwnedFd() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    [[nodiscard]] int get() const noexcept { return fd_; }
+    // close() can report a write-back error fsync() did not; surface it.
+    [[nodiscard]] bool close() noexcept { return ::close(std::exchange(fd_, -1)) == 0; }
+
+private:
+    int fd_;
+};
+
+[[nodiscard]] bool writeAll(int fd, std::string_view bytes) noexcept {
+    while (!bytes.empty()) {
+        const ssize_t n = ::write(fd, bytes.data(), bytes.size());
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        bytes.remove_prefix(static_cast<std::size_t>(n));
+    }
+    return true;
+}
+
+} // namespace
+
+std::string ContactSnapshot::encode(const Snapshot& snapshot) {
+    Writer w;
+    w.raw(kMagic);
+    w.num(kVersion);
+    w.str(snapshot.bookAddresses);
+    w.str(snapshot.bookCompanies);
+    w.book(snapshot.addresses);
+    w.book(snapshot.companies);
+    auto out = w.take();
+    const auto sum = fnv1a(out);
+    out.append(reinterpret_cast<const char*>(&sum), sizeof(sum));
+    return out;
+}
+
+std::optional<Snapshot> ContactSnapshot::decode(std::string_view bytes) {
+    if (bytes.size() < kMagic.size() + sizeof(std::uint32_t) + sizeof(std::uint64_t) ||
+        bytes.substr(0, kMagic.size()) != kMagic) {
+        return std::nullopt;
+    }
+    const auto body = bytes.substr(0, bytes.size() - sizeof(std::uint64_t));
+    std::uint64_t sum = 0;
+    std::memcpy(&sum, bytes.data() + body.size(), sizeof(sum));
+    if (sum != fnv1a(body)) {
+        return std::nullopt;
+    }
+
+    Reader r{body.substr(kMagic.size())};
+    if (r.num<std::uint32_t>() != kVersion) {
+        return std::nullopt;
+    }
+    Snapshot s;
+    s.bookAddresses = r.str();
+    s.bookCompanies = r.str();
+    auto addresses = r.book();
+    auto companies = r.book();
+    if (!addresses || !companies || !r.ok() || !r.atEnd()) {
+        return std::nullopt;
+    }
+    s.addresses = std::move(*addresses);
+    s.companies = std::move(*companies);
+    return s;
+}
+
+std::optional<Snapshot> ContactSnapshot::load(const std::filesystem::path& path) {
+    const MappedFile file{path};
+    const auto bytes = file.bytes();
+    if (!bytes) {
+        return std::nullopt;
+    }
+    return decode(*bytes);
+}
+
+bool ContactSnapshot::save(const std::filesystem::path& path, std::string_view bytes) {
+    auto tmpPath = path;
+    tmpPath += ".tmp";
+    // The snapshot holds names and phone numbers: owner-only whatever the
+    // umask, and created afresh so a leftover .tmp cannot lend its mode.
+    ::unlink(tmpPath.c_str());
+    {
+        OwnedFd out{::open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600)};
+        if (out.get() < 0) {
+            return false;
+        }
+        // On disk before the rename, or a crash could leave `path` naming an
+        // empty or torn file in place of the good snapshot it replaced.
+        if (!writeAll(out.get(), bytes) || ::fsync(out.get()) != 0 || !out.close()) {
+            ::unlink(tmpPath.c_str());
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec) {
+        ::unlink(tmpPath.c_str());
+        return false;
+    }
+    // And the rename itself survives a crash only once the directory is synced.
+    auto dir = path.parent_path();
+    if (dir.empty()) {
+        dir = ".";
+    }
+    const OwnedFd dirFd{::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)};
+    return dirFd.get() >= 0 && ::fsync(dirFd.get()) == 0;
+}
+
+} // namespace aid::adapters::davical::internal
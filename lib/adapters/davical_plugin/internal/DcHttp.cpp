@@ -115,4 +115,21 @@ aid::plumbing::Task<aid::plumbing::Result<void>> DcHttp::probe(std::string url)
     co_return aid::plumbing::Result<void>{};
 }
 
+aid::plumbing::Task<aid::plumbing::Result<std::string>> DcHttp::propfind(std::string url,
+                                                                         std::string_view xmlBody) {
+    aid::infrastructure::Headers h;
+    h.kv.emplace_back("Depth", "0");
+    h.kv.emplace_back("Content-Type", "application/xml; charset=utf-8");
+    h.kv.emplace_back("Authorization", authHeader_);
+
+    auto resp = co_await http_.send("PROPFIND", url, xmlBody, h);
+    if (!resp) {
+        co_return aid::plumbing::unexpected{resp.error()};
+    }
+    if (resp->status < 200 || resp->status >= 300) {
+        co_return aid::plumbing::unexpected{reportStatusError(resp->status, url, resp->body)};
+    }
+    co_return std::move(resp->body);
+}
+
 } // namespace aid::adapters::davical::internal
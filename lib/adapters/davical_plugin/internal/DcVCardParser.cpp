@@ -3,6 +3,7 @@
 #include <libxml/parser.h>
 #include <libxml/tree.h>
 #include <libxml/xmlerror.h>
+#include <libxml/xmlreader.h>
 #include <libxml/xmlstring.h>
 
 #include <algorithm>
@@ -36,6 +37,17 @@ struct XmlDocDeleter {
 };
 using XmlDocPtr = std::unique_ptr<xmlDoc, XmlDocDeleter>;
 
+// Streaming reader for parse(); frees the nodes it has walked past as it
+// goes, so only the element under the cursor is ever held in memory.
+struct XmlReaderDeleter {
+    void operator()(xmlTextReader* r) const noexcept {
+        if (r != nullptr) {
+            xmlFreeTextReader(r);
+        }
+    }
+};
+using XmlReaderPtr = std::unique_ptr<xmlTextReader, XmlReaderDeleter>;
+
 // libxml2 helpers (xmlNodeGetContent, xmlGetProp) return xmlChar* (unsigned
 // char*) that must be released with xmlFree, its internal free.
 struct XmlCharDeleter {
@@ -237,11 +249,12 @@ struct VCardLine {
     return out;
 }
 
-} // namespace
-
-std::vector<aid::Contact> DcVCardParser::parse(std::string_view xmlMultistatus) {
-    if (xmlMultistatus.empty()) {
-        return {};
+// Shared front half of every entry point: screen and bound one CardDAV
+// multistatus body before libxml2 sees it. False when the body is empty or
+// rejected; on true the hardened parser state is initialised.
+[[nodiscard]] bool admitHardened(std::string_view xml) {
+    if (xml.empty()) {
+        return false;
     }
 
     // DoS pre-screen, not the primary XXE barrier. Real CardDAV
@@ -260,22 +273,81 @@ std::vector<aid::Contact> DcVCardParser::parse(std::string_view xmlMultistatus)
     // (NONET + no-DTDLOAD + no-NOENT + no-op external-entity loader).
     // This pre-screen catches "DoS by malformed-but-still-parsed-by-
     // libxml2" cases that the parse options alone don't.
-    if (xmlMultistatus.find("<!DOCTYPE") != std::string_view::npos) {
-        return {};
+    if (xml.find("<!DOCTYPE") != std::string_view::npos) {
+        return false;
     }
 
     initHardenedXml();
 
-    // xmlReadMemory takes int sizes; clamp to be safe (the multistatus
-    // body comes from CardDAV, which won't be petabytes, but better a
-    // bounded conversion than a UB sign-conversion warning).
-    if (xmlMultistatus.size() > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+    // xmlReadMemory / xmlReaderForMemory take int sizes; clamp to be safe
+    // (the multistatus body comes from CardDAV, which won't be petabytes,
+    // but better a bounded conversion than a UB sign-conversion warning).
+    return xml.size() <= static_cast<std::size_t>(std::numeric_limits<int>::max());
+}
+
+// The whole body as a DOM, for parseCtag() and parseDom(). nullptr when
+// the body is rejected or not well-formed XML.
+[[nodiscard]] XmlDocPtr readHardened(std::string_view xml) {
+    if (!admitHardened(xml)) {
+        return nullptr;
+    }
+    return XmlDocPtr{xmlReadMemory(xml.data(), static_cast<int>(xml.size()),
+                                   /*URL=*/"davical://multistatus", /*encoding=*/nullptr,
+                                   kHardenedParseOptions)};
+}
+
+// The same body behind a streaming reader, for parse(). Same screen, same
+// options, same no-op entity loader — the reader is libxml2's own parser
+// fed incrementally, so the XXE barrier is the one readHardened() relies on.
+[[nodiscard]] XmlReaderPtr openHardened(std::string_view xml) {
+    if (!admitHardened(xml)) {
+        return nullptr;
+    }
+    return XmlReaderPtr{xmlReaderForMemory(xml.data(), static_cast<int>(xml.size()),
+                                           /*URL=*/"davical://multistatus",
+                                           /*encoding=*/nullptr, kHardenedParseOptions)};
+}
+
+} // namespace
+
+std::vector<aid::Contact> DcVCardParser::parse(std::string_view xmlMultistatus) {
+    XmlReaderPtr reader = openHardened(xmlMultistatus);
+    if (!reader) {
+        return {};
+    }
+
+    // Walk the body once, in document order. At each <address-data> the
+    // reader expands just that element, and its text is projected at once;
+    // the element is freed as the walk moves past it. A well-formedness
+    // error anywhere (xmlTextReaderRead → -1) discards everything gathered,
+    // as xmlReadMemory failing would for parseDom().
+    std::vector<aid::Contact> out;
+    int rc = 0;
+    while ((rc = xmlTextReaderRead(reader.get())) == 1) {
+        if (xmlTextReaderNodeType(reader.get()) != XML_READER_TYPE_ELEMENT ||
+            !isElement(xmlTextReaderCurrentNode(reader.get()), "address-data")) {
+            continue;
+        }
+        xmlNode* node = xmlTextReaderExpand(reader.get());
+        if (node == nullptr) {
+            return {};
+        }
+        XmlCharPtr txt{xmlNodeGetContent(node)};
+        if (!txt) {
+            continue;
+        }
+        if (auto c = parseOneVCard(reinterpret_cast<const char*>(txt.get()))) {
+            out.push_back(std::move(*c));
+        }
+    }
+    if (rc != 0) {
         return {};
     }
+    return out;
+}
 
-    XmlDocPtr doc{xmlReadMemory(xmlMultistatus.data(), static_cast<int>(xmlMultistatus.size()),
-                                /*URL=*/"davical://multistatus", /*encoding=*/nullptr,
-                                kHardenedParseOptions)};
+std::vector<aid::Contact> DcVCardParser::parseDom(std::string_view xmlMultistatus) {
+    XmlDocPtr doc = readHardened(xmlMultistatus);
     if (!doc) {
         return {};
     }
@@ -297,6 +369,31 @@ std::vector<aid::Contact> DcVCardParser::parse(std::string_view xmlMultistatus)
     return out;
 }
 
+std::optional<std::string> DcVCardParser::parseCtag(std::string_view xmlMultistatus) {
+    XmlDocPtr doc = readHardened(xmlMultistatus);
+    if (!doc) {
+        return std::nullopt;
+    }
+    const xmlNode* root = xmlDocGetRootElement(doc.get());
+    if (root == nullptr) {
+        return std::nullopt;
+    }
+
+    // A server without CTag support answers the property 404 inside its
+    // propstat — an empty <getctag/> — which is as good as absent. Pretty-
+    // printed bodies wrap the value in newlines, hence the wider trim set.
+    std::vector<std::string> ctags;
+    collectTextOf(root, "getctag", ctags);
+    constexpr std::string_view kSpace = " \t\r\n";
+    for (const auto& v : ctags) {
+        const auto first = v.find_first_not_of(kSpace);
+        if (first != std::string::npos) {
+            return v.substr(first, v.find_last_not_of(kSpace) - first + 1);
+        }
+    }
+    return std::nullopt;
+}
+
 std::optional<aid::Contact> DcVCardParser::parseOneVCard(std::string_view vCardText) {
     if (vCardText.empty()) {
         return std::nullopt;
@@ -0,0 +1,68 @@
+#include "aid/adapters/davical/internal/SnapshotWriter.h"
+
+#include <exception>
+#include <string>
+#include <utility>
+
+#include "aid/crosscutting/Logger.h"
+
+namespace aid::adapters::davical::internal {
+
+SnapshotWriter::SnapshotWriter(std::filesystem::path path)
+    : path_(std::move(path)), worker_([this] { run(); }) {
+}
+
+SnapshotWriter::~SnapshotWriter() {
+    {
+        std::lock_guard lk{mtx_};
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    worker_.join();
+}
+
+void SnapshotWriter::schedule(Snapshot snapshot) {
+    {
+        std::lock_guard lk{mtx_};
+        pending_ = std::move(snapshot);
+    }
+    cv_.notify_all();
+}
+
+void SnapshotWriter::drain() {
+    std::unique_lock lk{mtx_};
+    cv_.wait(lk, [this] { return !pending_ && !writing_; });
+}
+
+void SnapshotWriter::run() {
+    std::unique_lock lk{mtx_};
+    for (;;) {
+        cv_.wait(lk, [this] { return pending_ || stopping_; });
+        if (!pending_) {
+            return; // stopping, nothing left to write
+        }
+        auto snapshot = std::move(*pending_);
+        pending_.reset();
+        writing_ = true;
+        lk.unlock();
+
+        bool ok = false;
+        try {
+            ok = ContactSnapshot::save(path_, ContactSnapshot::encode(snapshot));
+        } catch (const std::exception&) {
+            ok = false; // bad_alloc from encode(); the mirror itself is unaffected
+        }
+
+        lk.lock();
+        writing_ = false;
+        if (!ok && !warned_) {
+            warned_ = true;
+            aid::crosscutting::Logger::instance().warn(
+                "davical plugin: cannot write contact snapshot " + path_.string() +
+                "; the next restart starts cold");
+        }
+        cv_.notify_all();
+    }
+}
+
+} // namespace aid::adapters::davical::internal
@@ -3,9 +3,10 @@
 #include <trantor/net/EventLoop.h>
 
 #include <chrono>
-#include <coroutine>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <filesystem>
 #include <memory>
 #include <new>
 #include <nlohmann/json.hpp>
@@ -18,8 +19,10 @@
 #include "aid/adapters/openproject/internal/CustomFieldMap.h"
 #include "aid/adapters/openproject/internal/HttpDispatcher.h"
 #include "aid/adapters/openproject/internal/payload.h"
+#include "aid/adapters/openproject/internal/url.h"
 #include "aid/adapters/support/HttpSupport.h"
 #include "aid/crosscutting/Logger.h"
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Error.h"
 
 // Plugin entry visibility: the rest of the .so is built with
@@ -31,18 +34,39 @@
 
 namespace aid::adapters::openproject {
 
+namespace {
+
+// False only when the work package names a type and it is not `typeCall`; a
+// payload without a type link is given the benefit of the doubt.
+bool isCallWorkPackage(const nlohmann::json& wp, const std::string& typeCall) {
+    auto links = wp.find("_links");
+    if (links == wp.end() || !links->is_object())
+        return true;
+    auto type = links->find("type");
+    if (type == links->end() || !type->is_object())
+        return true;
+    auto href = type->find("href");
+    if (href == type->end() || !href->is_string())
+        return true;
+    return hrefTail(href->get<std::string>()) == typeCall;
+}
+
+} // namespace
+
 // ─── Façade construction + forwards ────────────────────────────────────
 
 OpenProjectAdapter::OpenProjectAdapter(std::unique_ptr<aid::infrastructure::HttpClient> http,
                                        aid::crosscutting::TicketSystemConfig opCfg,
                                        aid::crosscutting::UiConfig uiCfg, CustomFieldMap fields,
-                                       Sleeper sleeper)
+                                       Sleeper sleeper,
+                                       std::optional<std::filesystem::path> callidIndexPath)
     : httpClient_(std::move(http)), opCfg_(std::move(opCfg)), uiCfg_(std::move(uiCfg)),
       fields_(std::move(fields)), sleeper_(std::move(sleeper)), dispatcher_(*httpClient_),
-      statusMap_(OpStatusMap::fromConfig(opCfg_)),
+      statusMap_(OpStatusMap::fromConfig(opCfg_)), callidIndex_(std::move(callidIndexPath)),
       http_(dispatcher_, opCfg_.baseUrl, opCfg_.apiToken, sleeper_), users_(http_),
-      tickets_(http_, users_, statusMap_, opCfg_, fields_, &producedLedger_, &handlerLedger_),
-      dashboard_(users_, tickets_, opCfg_, uiCfg_) {
+      tickets_(http_, users_, statusMap_, opCfg_, fields_, &producedLedger_, &handlerLedger_,
+               &callidIndex_, &openCalls_, &ticketCache_, &recipientCache_),
+      dashboard_(users_, tickets_, opCfg_, uiCfg_, &openCalls_) {
 }
 
 void OpenProjectAdapter::cancelPendingRequests() noexcept {
@@ -87,6 +111,15 @@ OpenProjectAdapter::findOpenInProjectByCallerNumber(aid::ProjectId project,
     return tickets_.findOpenInProjectByCallerNumber(std::move(project), std::move(caller));
 }
 
+aid::plumbing::Task<aid::plumbing::Result<std::vector<std::optional<aid::Ticket>>>>
+OpenProjectAdapter::findOpenByCallerNumberInProjects(std::span<const aid::ProjectId> projects,
+                                                     aid::PhoneNumber caller) {
+    // Materialise the span: the repo coroutine owns its copy, not a view into
+    // the caller's storage.
+    return tickets_.findOpenByCallerNumberInProjects(
+        std::vector<aid::ProjectId>(projects.begin(), projects.end()), std::move(caller));
+}
+
 aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::UserHandle>>>
 OpenProjectAdapter::resolveUser(std::string_view login) {
     return users_.resolveLogin(login);
@@ -102,16 +135,32 @@ OpenProjectAdapter::listDashboard(aid::UserHandle viewer) {
     return dashboard_.build(std::move(viewer));
 }
 
+aid::plumbing::Task<aid::plumbing::Result<aid::DashboardListing>>
+OpenProjectAdapter::listDashboardStamped(aid::UserHandle viewer) {
+    return dashboard_.buildListing(std::move(viewer));
+}
+
 aid::DashboardEntry OpenProjectAdapter::buildEntry(const aid::Ticket& ticket,
                                                    aid::UserHandle viewer) {
     return dashboard_.buildEntry(ticket, std::move(viewer));
 }
 
+aid::SharedDashboardEntry
+OpenProjectAdapter::buildEntries(const aid::Ticket& ticket,
+                                 const std::vector<aid::UserHandle>& viewers) {
+    return dashboard_.buildEntries(ticket, viewers);
+}
+
 aid::plumbing::Task<aid::plumbing::Result<aid::TicketId>>
 OpenProjectAdapter::create(const aid::NewTicket& ticket) {
     return tickets_.create(ticket);
 }
 
+aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
+OpenProjectAdapter::createAndGet(const aid::NewTicket& ticket) {
+    return tickets_.createAndGet(ticket);
+}
+
 aid::plumbing::Task<aid::plumbing::Result<aid::Ticket>>
 OpenProjectAdapter::save(aid::TicketId id, aid::ports::TicketReducer reduce) {
     // OpTicketRepo::save fetches the ticket, applies the reducer to the fresh
@@ -124,6 +173,11 @@ OpenProjectAdapter::addCallHandler(aid::TicketId id, aid::UserHandle login) {
     return tickets_.addCallHandler(std::move(id), std::move(login));
 }
 
+aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
+OpenProjectAdapter::addCallHandlerAndGet(aid::TicketId id, aid::UserHandle login) {
+    return tickets_.addCallHandlerAndGet(std::move(id), std::move(login));
+}
+
 aid::plumbing::Task<aid::plumbing::Result<std::vector<aid::UserHandle>>>
 OpenProjectAdapter::recipientsFor(const aid::Ticket& ticket) {
     return tickets_.recipientsFor(ticket);
@@ -134,9 +188,19 @@ OpenProjectAdapter::openCallsInProject(aid::ProjectId project) {
     return tickets_.openCallsInProject(std::move(project));
 }
 
+RecipientCache::Stats OpenProjectAdapter::recipientsForStats() const noexcept {
+    return recipientCache_.stats();
+}
+
 aid::plumbing::Task<aid::plumbing::Result<std::vector<aid::MembershipDelta>>>
 OpenProjectAdapter::refreshMembership() {
-    return users_.refreshMembership();
+    auto deltas = co_await users_.refreshMembership();
+    // A membership change moves projects in or out of some viewer's cached
+    // project list; re-read them all on the next dashboard load. The rows
+    // themselves are per project and stay valid.
+    if (deltas && !deltas->empty())
+        openCalls_.forgetProjects();
+    co_return deltas;
 }
 
 aid::plumbing::Task<aid::plumbing::Result<void>> OpenProjectAdapter::close(aid::TicketId id) {
@@ -179,15 +243,30 @@ OpenProjectAdapter::decodeWebhook(std::string payload) {
     }
     aid::Ticket ticket = std::move(*parsed);
 
-    // Grace delay: a create()/save() this daemon just issued records its
-    // produced version only once OpenProject answers the PATCH/POST. With
-    // journal aggregation set to 0 the echo webhook can race that response, so
-    // we wait briefly before consulting the ledger. This delay is NOT the match
-    // criterion — suppression is still an EXACT (id, version) hit, so a human
-    // edit landing within the window (necessarily at a higher version) passes.
-    co_await sleeper_(ProducedLedger::kEchoGraceDelay);
-
-    if (producedLedger_.contains(ticket.id, ticket.lockVersion)) {
+    // Every webhook — echo or not — carries the authoritative callId field, so it
+    // keeps the callid index current for tickets this daemon did not write
+    // (e.g. a callid an admin pasted onto another work package).
+    callidIndex_.recordTicket(ticket);
+    // Likewise the dashboard view: every webhook is the ticket's current server
+    // state. A work package whose type is not the call type (never was, or was
+    // retyped away) has no place on a dashboard.
+    if (isCallWorkPackage(*wp, opCfg_.typeCall))
+        openCalls_.apply(ticket);
+    else
+        openCalls_.forget(ticket.id);
+    // A version newer than the one save() would seed from means someone else
+    // wrote the ticket; our own echo carries exactly the cached version.
+    ticketCache_.invalidateBelow(ticket.id, ticket.lockVersion);
+
+    // Echo check. A create()/save() this daemon just issued records its
+    // produced version only once OpenProject answers the PATCH/POST, and with
+    // journal aggregation set to 0 the echo webhook can race that response. So
+    // only while such a write is still in flight do we wait — re-checking every
+    // kEchoPollInterval, for at most kEchoGraceDelay — for its version to land.
+    // An edit with no local write pending is forwarded at once. The wait is NOT
+    // the match criterion — suppression is still an EXACT (id, version) hit, so
+    // a human edit landing meanwhile (necessarily at a higher version) passes.
+    if (co_await producedLedger_.isEcho(ticket.id, ticket.lockVersion, sleeper_)) {
         // Our own echo — already pushed as a live delta by the originating use
         // case, and the originating write already refreshed the handler ledger,
         // so there is nothing to diff. Drop it.
@@ -225,31 +304,6 @@ aid::plumbing::Task<aid::plumbing::Result<void>> OpenProjectAdapter::ping() {
 
 namespace {
 
-// Sleep awaiter that schedules its continuation on a trantor::EventLoop
-// after the requested duration. Same pattern as HttpClient.cpp's local
-// SleepAwaiter — duplicated here so the plugin doesn't poke at
-// infrastructure internals.
-struct LoopSleepAwaiter {
-    trantor::EventLoop& loop;
-    std::chrono::milliseconds dur;
-
-    [[nodiscard]] bool await_ready() const noexcept { return dur.count() <= 0; }
-
-    void await_suspend(std::coroutine_handle<> h) const noexcept {
-        const double secs = static_cast<double>(dur.count()) / 1000.0;
-        loop.runAfter(secs, [h]() noexcept { h.resume(); });
-    }
-
-    void await_resume() const noexcept {}
-};
-
-Sleeper makeLoopSleeper(trantor::EventLoop& loop) {
-    return [&loop](std::chrono::milliseconds d) -> aid::plumbing::Task<void> {
-        co_await LoopSleepAwaiter{loop, d};
-        co_return;
-    };
-}
-
 // Parse the slice of config.json the factory was handed. The factory
 // must NEVER let an exception escape: catch every parse failure here,
 // log it, and return nullopt so the daemon can refuse the plugin with a
@@ -258,6 +312,7 @@ struct ParsedFactoryConfig {
     aid::crosscutting::TicketSystemConfig op;
     aid::crosscutting::UiConfig ui;
     CustomFieldMap fields;
+    std::optional<std::filesystem::path> callidIndexPath;
 };
 
 std::optional<ParsedFactoryConfig> parseFactoryConfig(const std::string& configJson) {
@@ -329,6 +384,18 @@ std::optional<ParsedFactoryConfig> parseFactoryConfig(const std::string& configJ
             }
         }
 
+        // callidIndexPath is optional — without it the callid index lives in
+        // memory only and starts cold after every restart.
+        if (auto ci = j.find("callidIndexPath"); ci != j.end()) {
+            if (!ci->is_string() || ci->get<std::string>().empty()) {
+                Logger::instance().error(
+                    "openproject plugin: callidIndexPath must be a non-empty string",
+                    LogType::BACKEND);
+                return std::nullopt;
+            }
+            out.callidIndexPath = std::filesystem::path{ci->get<std::string>()};
+        }
+
         // Ui.projectWebBaseUrl — embedded in the same slice so a single
         // factory call carries everything the adapter needs.
         if (auto v = requireString(j, "projectWebBaseUrl"); v)
@@ -448,7 +515,8 @@ extern "C" AID_PLUGIN_EXPORT aid::ports::TicketStore* create_TicketStore(const c
             httpClientBaseUrl(parsed->op.baseUrl), httpCfg, *loop);
 
         return new OpenProjectAdapter(std::move(http), std::move(parsed->op), std::move(parsed->ui),
-                                      std::move(parsed->fields), makeLoopSleeper(*loop));
+                                      std::move(parsed->fields), makeLoopSleeper(*loop),
+                                      std::move(parsed->callidIndexPath));
     } catch (const std::bad_alloc&) {
         // OOM at construction. No exception crosses the
         // boundary; convert to nullptr return.
@@ -489,3 +557,10 @@ extern "C" AID_PLUGIN_EXPORT std::uint64_t aid_plugin_abi_layout_tag(void) {
 extern "C" AID_PLUGIN_EXPORT const char* aid_plugin_contract_tag(void) {
     return aid::abi::kPluginContractTag;
 }
+
+// Event-deadline bridge: the daemon hands over its per-thread deadline slot
+// (plumbing/Deadline.h) before the factory runs, so this `.so`'s HttpClient
+// clamps requests to the budget the daemon's mailbox installed.
+extern "C" AID_PLUGIN_EXPORT void aid_plugin_bind_deadline_slot(std::int64_t* (*slot)()) {
+    aid::plumbing::bindDeadlineSlot(slot);
+}
@@ -0,0 +1,178 @@
+#include "aid/adapters/openproject/internal/CallidIndex.h"
+
+#include <algorithm>
+#include <fstream>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "aid/crosscutting/Logger.h"
+
+namespace aid::adapters::openproject {
+
+namespace {
+
+// A field that would break the line format is kept in memory but never written.
+bool persistable(std::string_view s) {
+    return s.find_first_of("\t\r\n") == std::string_view::npos;
+}
+
+} // namespace
+
+CallidIndex::CallidIndex(std::optional<std::filesystem::path> persistPath)
+    : path_(std::move(persistPath)) {
+    if (!path_) {
+        return;
+    }
+    std::lock_guard lk{mtx_};
+    std::error_code ec;
+    if (std::filesystem::exists(*path_, ec)) {
+        std::ifstream in(*path_);
+        if (!in) {
+            persistFailed("cannot read " + path_->string());
+        }
+        std::string line;
+        while (std::getline(in, line)) {
+            const auto tab = line.find('\t');
+            if (tab == std::string::npos || tab == 0) {
+                continue; // torn tail of an interrupted append, or garbage — skip
+            }
+            std::string callid = line.substr(0, tab);
+            std::string id = line.substr(tab + 1);
+            if (id.empty()) {
+                byCallid_.erase(callid);
+            } else {
+                put(callid, aid::TicketId{std::move(id)});
+            }
+        }
+    }
+    compact();
+}
+
+void CallidIndex::put(const std::string& callid, const aid::TicketId& id) {
+    auto& entry = byCallid_[callid];
+    entry.id = id;
+    entry.seq = nextSeq_++;
+    if (byCallid_.size() <= kMaxEntries) {
+        return;
+    }
+    // Over the cap: evict the oldest-recorded entry. Only ever runs at the cap, so
+    // the O(n) scan is rare; the evicted line stays on disk until the next compact
+    // and is dropped by the same cap on replay.
+    auto victim = std::min_element(byCallid_.begin(), byCallid_.end(),
+                                   [](const auto& a, const auto& b) {
+                                       return a.second.seq < b.second.seq;
+                                   });
+    if (victim != byCallid_.end()) {
+        byCallid_.erase(victim);
+    }
+}
+
+void CallidIndex::append(const std::string& callid, const std::string& id) {
+    if (!path_ || !persistable(callid) || !persistable(id)) {
+        return;
+    }
+    if (linesOnDisk_ >= 2 * std::max<std::size_t>(byCallid_.size(), 1024)) {
+        compact();
+        return;
+    }
+    std::ofstream out(*path_, std::ios::app);
+    out << callid << '\t' << id << '\n';
+    out.flush();
+    if (!out) {
+        persistFailed("append to " + path_->string() + " failed");
+        return;
+    }
+    ++linesOnDisk_;
+}
+
+void CallidIndex::compact() {
+    if (!path_) {
+        return;
+    }
+    // Oldest first, so a replay re-establishes the same eviction order.
+    std::vector<const std::pair<const std::string, Entry>*> live;
+    live.reserve(byCallid_.size());
+    for (const auto& kv : byCallid_) {
+        if (persistable(kv.first) && persistable(kv.second.id.v)) {
+            live.push_back(&kv);
+        }
+    }
+    std::sort(live.begin(), live.end(),
+              [](const auto* a, const auto* b) { return a->second.seq < b->second.seq; });
+
+    auto tmpPath = *path_;
+    tmpPath += ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::trunc);
+        for (const auto* kv : live) {
+            out << kv->first << '\t' << kv->second.id.v << '\n';
+        }
+        out.flush();
+        if (!out) {
+            persistFailed("write " + tmpPath.string() + " failed");
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, *path_, ec);
+    if (ec) {
+        persistFailed("rename to " + path_->string() + ": " + ec.message());
+        return;
+    }
+    linesOnDisk_ = live.size();
+}
+
+void CallidIndex::persistFailed(const std::string& what) {
+    if (warned_) {
+        return;
+    }
+    warned_ = true;
+    aid::crosscutting::Logger::instance().warn(
+        "openproject plugin: callid index persistence degraded (" + what +
+        "); continuing in memory");
+}
+
+void CallidIndex::record(const aid::CallId& callid, const aid::TicketId& id) {
+    if (callid.v.empty() || id.v.empty()) {
+        return;
+    }
+    std::lock_guard lk{mtx_};
+    if (auto it = byCallid_.find(callid.v); it != byCallid_.end() && it->second.id.v == id.v) {
+        return;
+    }
+    put(callid.v, id);
+    append(callid.v, id.v);
+}
+
+void CallidIndex::recordTicket(const aid::Ticket& t) {
+    for (const auto& callid : t.callIds) {
+        record(callid, t.id);
+    }
+}
+
+std::optional<aid::TicketId> CallidIndex::lookup(const aid::CallId& callid) {
+    std::lock_guard lk{mtx_};
+    if (auto it = byCallid_.find(callid.v); it != byCallid_.end()) {
+        return it->second.id;
+    }
+    return std::nullopt;
+}
+
+void CallidIndex::forget(const aid::CallId& callid, const aid::TicketId& id) {
+    std::lock_guard lk{mtx_};
+    auto it = byCallid_.find(callid.v);
+    if (it == byCallid_.end() || it->second.id.v != id.v) {
+        return;
+    }
+    byCallid_.erase(it);
+    append(callid.v, std::string{});
+}
+
+std::size_t CallidIndex::size() {
+    std::lock_guard lk{mtx_};
+    return byCallid_.size();
+}
+
+} // namespace aid::adapters::openproject
@@ -1,7 +1,10 @@
 #include "aid/adapters/openproject/internal/OpDashboardBuilder.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <utility>
 
@@ -17,8 +20,9 @@ namespace aid::adapters::openproject {
 
 OpDashboardBuilder::OpDashboardBuilder(OpUserRepo& users, OpTicketRepo& tickets,
                                        const aid::crosscutting::TicketSystemConfig& opCfg,
-                                       const aid::crosscutting::UiConfig& uiCfg)
-    : users_(users), tickets_(tickets), opCfg_(opCfg), uiCfg_(uiCfg) {
+                                       const aid::crosscutting::UiConfig& uiCfg,
+                                       OpenCallView* openCalls)
+    : users_(users), tickets_(tickets), opCfg_(opCfg), uiCfg_(uiCfg), openCalls_(openCalls) {
 }
 
 std::vector<aid::Ticket> OpDashboardBuilder::mergeById(std::vector<aid::Ticket> callTickets,
@@ -54,22 +58,46 @@ std::string OpDashboardBuilder::projectName(const aid::ProjectId& id) const {
 }
 
 Task<Result<std::vector<aid::DashboardEntry>>> OpDashboardBuilder::build(aid::UserHandle viewer) {
+    auto listing = co_await buildListing(std::move(viewer));
+    if (!listing)
+        co_return unexpected(listing.error());
+    co_return std::move(listing->entries);
+}
+
+Task<Result<aid::DashboardListing>> OpDashboardBuilder::buildListing(aid::UserHandle viewer) {
+    if (openCalls_ != nullptr) {
+        auto selected = co_await selectFromView(viewer);
+        if (!selected)
+            co_return unexpected(selected.error());
+        co_return aid::DashboardListing{entriesFor(std::move(selected->tickets), viewer),
+                                        selected->stamp};
+    }
+
+    // Step 3 — open call tickets where the viewer is a recorded call handler.
+    // This is the cross-project visibility arm: a user who handled a call in a
+    // project they are NOT a member of must still see that ticket. It replaces
+    // the old assignee arm (which was then re-filtered down to member projects,
+    // hiding exactly those cross-project tickets).
+    //
+    // It depends on nothing but the viewer, so it is launched first and runs
+    // alongside steps 1–2: the load then costs max(handler arm, steps 1 + 2)
+    // instead of their sum. It is awaited on every path, errors included — a
+    // Task destroyed while suspended in the HttpClient would leave its
+    // completion resuming a freed frame.
+    auto handlerArm = tickets_.findCallTicketsWithHandler(viewer);
+
     // Step 1 — projects-for-viewer.
     auto projects = co_await users_.projectsForUser(viewer);
-    if (!projects)
+    if (!projects) {
+        (void)co_await handlerArm;
         co_return unexpected(projects.error());
+    }
 
     // Step 2 — open call tickets in those projects.
     auto callTickets = co_await tickets_.findCallTicketsInProjectsOpen(*projects);
+    auto handlerTickets = co_await handlerArm;
     if (!callTickets)
         co_return unexpected(callTickets.error());
-
-    // Step 3 — open call tickets where the viewer is a recorded call handler.
-    // This is the cross-project visibility arm: a user who handled a call in a
-    // project they are NOT a member of must still see that ticket. It replaces
-    // the old assignee arm (which was then re-filtered down to member projects,
-    // hiding exactly those cross-project tickets).
-    auto handlerTickets = co_await tickets_.findCallTicketsWithHandler(viewer);
     if (!handlerTickets)
         co_return unexpected(handlerTickets.error());
 
@@ -79,6 +107,66 @@ Task<Result<std::vector<aid::DashboardEntry>>> OpDashboardBuilder::build(aid::Us
     // exactly (members ∪ callHandlers), so no ghost rows and no missing rows.
     auto merged = mergeById(std::move(*callTickets), std::move(*handlerTickets));
 
+    co_return aid::DashboardListing{entriesFor(std::move(merged), viewer), std::nullopt};
+}
+
+Task<Result<OpenCallView::Selection>> OpDashboardBuilder::selectFromView(aid::UserHandle viewer) {
+    // Step 3 — the cross-project handler arm, once per reconcile interval.
+    // Launched ahead of steps 1–2 for the same reason as in buildListing; its
+    // seed is still installed after the project seed below.
+    std::optional<Task<Result<std::vector<aid::Ticket>>>> handlerArm;
+    std::uint64_t handlerSince = 0;
+    if (openCalls_->handlerStale(viewer)) {
+        handlerSince = openCalls_->version();
+        handlerArm.emplace(tickets_.findCallTicketsWithHandler(viewer));
+    }
+
+    auto members = co_await memberProjectsFromView(viewer);
+
+    if (handlerArm) {
+        auto& arm = *handlerArm;
+        auto handlerTickets = co_await arm;
+        if (!members)
+            co_return unexpected(members.error());
+        if (!handlerTickets)
+            co_return unexpected(handlerTickets.error());
+        openCalls_->seedHandler(viewer, std::move(*handlerTickets), handlerSince);
+    }
+    if (!members)
+        co_return unexpected(members.error());
+
+    // Step 4 — the view holds each ticket once, so the select IS the merge.
+    co_return openCalls_->select(viewer, *members);
+}
+
+Task<Result<std::vector<aid::ProjectId>>>
+OpDashboardBuilder::memberProjectsFromView(aid::UserHandle viewer) {
+    // Step 1 — projects-for-viewer, from the view's cache while it is current.
+    auto projects = openCalls_->projectsFor(viewer);
+    if (!projects) {
+        auto fetched = co_await users_.projectsForUser(viewer);
+        if (!fetched)
+            co_return unexpected(fetched.error());
+        openCalls_->rememberProjects(viewer, *fetched);
+        projects = std::move(*fetched);
+    }
+
+    // Step 2 — reseed only the member projects the view holds no current
+    // scan of. The version is read BEFORE the query so a write landing while
+    // it is in flight is not dropped as "missing from the scan".
+    auto stale = openCalls_->staleProjects(*projects);
+    if (!stale.empty()) {
+        const auto since = openCalls_->version();
+        auto callTickets = co_await tickets_.findCallTicketsInProjectsOpen(stale);
+        if (!callTickets)
+            co_return unexpected(callTickets.error());
+        openCalls_->seedProjects(stale, std::move(*callTickets), since);
+    }
+    co_return std::move(*projects);
+}
+
+std::vector<aid::DashboardEntry> OpDashboardBuilder::entriesFor(std::vector<aid::Ticket> merged,
+                                                                const aid::UserHandle& viewer) const {
     // Step 5 (done before the step-6 projection) — sort on the Ticket side so we still
     // have updatedAt available. Status rank first (New < InProgress <
     // Closed); ties broken by updatedAt descending,
@@ -113,12 +201,55 @@ Task<Result<std::vector<aid::DashboardEntry>>> OpDashboardBuilder::build(aid::Us
     for (const auto& t : merged) {
         entries.push_back(buildEntry(t, viewer));
     }
+    return entries;
+}
+
+namespace {
 
-    co_return entries;
+// findUsersWithOpenCalls over the open lines alone: each names at most one
+// user, so this reads the few live lines rather than the whole call log.
+std::vector<aid::UserHandle> usersOnCall(const std::vector<std::string_view>& openLines) {
+    std::vector<aid::UserHandle> users;
+    for (const auto line : openLines) {
+        for (auto& u : aid::domain::CallLineFormatter::findUsersWithOpenCalls(line)) {
+            const bool seen = std::any_of(users.begin(), users.end(),
+                                          [&](const aid::UserHandle& v) { return v.v == u.v; });
+            if (!seen)
+                users.push_back(std::move(u));
+        }
+    }
+    return users;
 }
 
+} // namespace
+
 aid::DashboardEntry OpDashboardBuilder::buildEntry(const aid::Ticket& t,
                                                    aid::UserHandle viewer) const {
+    auto e = baseEntry(t);
+    const auto openLines = aid::domain::CallLineFormatter::findOpenLines(t.callLength);
+    auto overlay = overlayFor(openLines, usersOnCall(openLines), std::move(viewer));
+    e.activeCallForViewer = std::move(overlay.activeCallForViewer);
+    e.otherActiveUsers = std::move(overlay.otherActiveUsers);
+    return e;
+}
+
+aid::SharedDashboardEntry
+OpDashboardBuilder::buildEntries(const aid::Ticket& t,
+                                 const std::vector<aid::UserHandle>& viewers) const {
+    aid::SharedDashboardEntry shared;
+    shared.entry = baseEntry(t);
+    // One pass over the call log for all viewers; the users on a call and
+    // each overlay then only look at the open lines, one per live call.
+    const auto openLines = aid::domain::CallLineFormatter::findOpenLines(t.callLength);
+    const auto onCall = usersOnCall(openLines);
+    shared.viewers.reserve(viewers.size());
+    for (const auto& viewer : viewers) {
+        shared.viewers.push_back(overlayFor(openLines, onCall, viewer));
+    }
+    return shared;
+}
+
+aid::DashboardEntry OpDashboardBuilder::baseEntry(const aid::Ticket& t) const {
     aid::DashboardEntry e;
     e.id = t.id;
     e.subject = t.subject;
@@ -145,22 +276,36 @@ aid::DashboardEntry OpDashboardBuilder::buildEntry(const aid::Ticket& t,
     e.href = std::move(href);
     e.projectName = std::move(proj);
 
+    e.description = t.description;
+    e.lockVersion = t.lockVersion;
+    e.updatedAt = t.updatedAt;
+    return e;
+}
+
+aid::ViewerOverlay OpDashboardBuilder::overlayFor(const std::vector<std::string_view>& openLines,
+                                                  const std::vector<aid::UserHandle>& onCall,
+                                                  aid::UserHandle viewer) {
+    aid::ViewerOverlay o;
     // Active-call detection scans the call-log lines, which now live in the
     // `callLength` field (not `description`, which holds only human comments).
-    e.activeCallForViewer =
-        aid::domain::CallLineFormatter::findOpenLineForUser(t.callLength, viewer);
+    // The first open line that findOpenLineForUser accepts is the one it would
+    // have found scanning the whole log.
+    for (const auto line : openLines) {
+        if (auto callid = aid::domain::CallLineFormatter::findOpenLineForUser(line, viewer)) {
+            o.activeCallForViewer = std::move(callid);
+            break;
+        }
+    }
     // Other users with a live call on this ticket — surfaced uncolored in
     // the UI. Exclude the viewer here so the hint never duplicates the
     // row's own activeCallForViewer ("Live") state.
-    for (auto& u : aid::domain::CallLineFormatter::findUsersWithOpenCalls(t.callLength)) {
+    for (const auto& u : onCall) {
         if (u.v != viewer.v) {
-            e.otherActiveUsers.push_back(std::move(u));
+            o.otherActiveUsers.push_back(u);
         }
     }
-    e.description = t.description;
-    e.lockVersion = t.lockVersion;
-    e.updatedAt = t.updatedAt;
-    return e;
+    o.viewer = std::move(viewer);
+    return o;
 }
 
 } // namespace aid::adapters::openproject
@@ -1,14 +1,19 @@
 #include "aid/adapters/openproject/internal/OpHttp.h"
 
+#include <trantor/net/EventLoop.h>
+
 #include <array>
 #include <chrono>
+#include <coroutine>
 #include <cstddef>
 #include <cstdint>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <string>
 #include <utility>
 
 #include "aid/adapters/support/HttpSupport.h"
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Error.h"
 
 using aid::plumbing::Error;
@@ -30,6 +35,29 @@ constexpr int kMaxConflictAttempts = 5;
 constexpr std::array<std::chrono::milliseconds, kMaxConflictAttempts> kConflictBackoff{
     50ms, 100ms, 200ms, 400ms, 800ms};
 
+// Sleep awaiter that schedules its continuation on a trantor::EventLoop
+// after the requested duration. Same pattern as HttpClient.cpp's local
+// SleepAwaiter — duplicated here so the plugin doesn't poke at
+// infrastructure internals.
+struct LoopSleepAwaiter {
+    trantor::EventLoop& loop;
+    std::chrono::milliseconds dur;
+    // Reinstalled around the resume so the caller chain keeps its budget.
+    std::optional<aid::plumbing::Deadline> deadline;
+
+    [[nodiscard]] bool await_ready() const noexcept { return dur.count() <= 0; }
+
+    void await_suspend(std::coroutine_handle<> h) const noexcept {
+        const double secs = static_cast<double>(dur.count()) / 1000.0;
+        loop.runAfter(secs, [h, d = deadline]() noexcept {
+            const aid::plumbing::DeadlineScope scope{d};
+            h.resume();
+        });
+    }
+
+    void await_resume() const noexcept {}
+};
+
 aid::infrastructure::Headers jsonHeaders(const std::string& authHeader, bool withContentType) {
     aid::infrastructure::Headers h;
     h.kv.emplace_back("Authorization", authHeader);
@@ -107,6 +135,13 @@ Result<nlohmann::json> parseJsonBody(const aid::infrastructure::HttpResponse& re
 
 } // namespace
 
+Sleeper makeLoopSleeper(trantor::EventLoop& loop) {
+    return [&loop](std::chrono::milliseconds d) -> Task<void> {
+        co_await LoopSleepAwaiter{loop, d, aid::plumbing::currentDeadline()};
+        co_return;
+    };
+}
+
 OpHttp::OpHttp(HttpDispatcher& dispatcher, std::string baseUrl, std::string_view apiToken,
                Sleeper sleeper)
     : dispatcher_(dispatcher), baseUrl_(std::move(baseUrl)),
@@ -123,6 +158,16 @@ Task<Result<nlohmann::json>> OpHttp::get(std::string path) {
     co_return parseJsonBody(*resp, "GET", path);
 }
 
+Task<Result<std::string>> OpHttp::getBody(std::string path) {
+    const auto headers = jsonHeaders(authHeader_, /*withContentType=*/false);
+    auto resp = co_await dispatcher_.send("GET", path, {}, headers);
+    if (!resp)
+        co_return unexpected(resp.error());
+    if (resp->status < 200 || resp->status >= 300)
+        co_return unexpected(httpStatusError(resp->status, "GET", path, resp->body));
+    co_return std::move(resp->body);
+}
+
 Task<Result<nlohmann::json>> OpHttp::post(std::string path, const nlohmann::json& body) {
     const auto headers = jsonHeaders(authHeader_, /*withContentType=*/true);
     const std::string serialized = body.dump();
@@ -1,7 +1,13 @@
 #include "aid/adapters/openproject/internal/OpTicketRepo.h"
 
 #include <algorithm>
+#include <coroutine>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
 #include <optional>
 #include <string>
@@ -10,11 +16,17 @@
 #include <utility>
 #include <vector>
 
+#include "aid/adapters/openproject/internal/CallidIndex.h"
 #include "aid/adapters/openproject/internal/HandlerLedger.h"
+#include "aid/adapters/openproject/internal/OpenCallView.h"
 #include "aid/adapters/openproject/internal/ProducedLedger.h"
+#include "aid/adapters/openproject/internal/RecipientCache.h"
+#include "aid/adapters/openproject/internal/TicketCache.h"
+#include "aid/adapters/openproject/internal/halstream.h"
 #include "aid/adapters/openproject/internal/payload.h"
 #include "aid/adapters/openproject/internal/url.h"
 #include "aid/domain/StateTransitions.h"
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Error.h"
 
 using aid::plumbing::Error;
@@ -28,9 +40,27 @@ namespace aid::adapters::openproject {
 OpTicketRepo::OpTicketRepo(OpHttp& http, OpUserRepo& users, const OpStatusMap& statusMap,
                            const aid::crosscutting::TicketSystemConfig& cfg,
                            const CustomFieldMap& fieldMap, ProducedLedger* producedLedger,
-                           HandlerLedger* handlerLedger)
+                           HandlerLedger* handlerLedger, CallidIndex* callidIndex,
+                           OpenCallView* openCalls, TicketCache* ticketCache,
+                           RecipientCache* recipientCache)
     : http_(http), users_(users), statusMap_(statusMap), cfg_(cfg), fieldMap_(fieldMap),
-      producedLedger_(producedLedger), handlerLedger_(handlerLedger) {
+      producedLedger_(producedLedger), handlerLedger_(handlerLedger), callidIndex_(callidIndex),
+      openCalls_(openCalls), ticketCache_(ticketCache), recipientCache_(recipientCache) {
+}
+
+void OpTicketRepo::indexCallids(const aid::Ticket& t) {
+    if (callidIndex_ != nullptr)
+        callidIndex_->recordTicket(t);
+}
+
+void OpTicketRepo::trackOpenCall(const aid::Ticket& t) {
+    if (openCalls_ != nullptr)
+        openCalls_->apply(t);
+}
+
+void OpTicketRepo::cacheTicket(const aid::Ticket& t) {
+    if (ticketCache_ != nullptr)
+        ticketCache_->record(t);
 }
 
 Task<Result<aid::Ticket>> OpTicketRepo::fetchById(aid::TicketId id) {
@@ -43,6 +73,11 @@ Task<Result<aid::Ticket>> OpTicketRepo::fetchById(aid::TicketId id) {
     // admin's handler-drop edit against the freshest set we have observed.
     if (parsed && handlerLedger_ != nullptr)
         handlerLedger_->record(parsed->id, parsed->callHandlers);
+    if (parsed) {
+        indexCallids(*parsed);
+        trackOpenCall(*parsed);
+        cacheTicket(*parsed);
+    }
     co_return parsed;
 }
 
@@ -59,6 +94,32 @@ namespace {
 // bug this fixes.)
 constexpr int kDashboardPageSize = 1000;
 
+// How many getAllPaged pages may be in flight at once once page 1 has fixed the
+// page count. Small on purpose: it bounds the burst a single dashboard load can
+// put on OpenProject while still collapsing a 10-page scan to ~3 round trips.
+constexpr std::size_t kPageFanOut = 4;
+
+// `base` (which already carries `?filters=<…>`) plus the page `offset` and our
+// requested `pageSize`.
+std::string pagedUrl(const std::string& base, int page) {
+    std::string path = base;
+    path.append("&offset=");
+    path.append(std::to_string(page));
+    path.append("&pageSize=");
+    path.append(std::to_string(kDashboardPageSize));
+    return path;
+}
+
+// `path` (a work_packages collection query) narrowed to the `projection`
+// sparse fieldset. Only collection reads are projected: by-id fetches feed
+// save()'s reducers and must see the whole ticket.
+std::string withSelect(std::string path, const CustomFieldMap& fieldMap,
+                       HalProjection projection) {
+    path.append("&select=");
+    path.append(urlEncode(workPackageSelect(fieldMap, projection)));
+    return path;
+}
+
 // True when s is non-empty and every character is an ASCII digit — i.e. an
 // already-numeric OpenProject user id (e.g. "6"), not a login.
 bool isAllDigits(std::string_view s) {
@@ -83,26 +144,6 @@ Result<std::optional<aid::Ticket>> firstFromCollection(const nlohmann::json& res
     return std::optional<aid::Ticket>{std::move(*parsed)};
 }
 
-Result<std::vector<aid::Ticket>> allFromCollection(const nlohmann::json& resp,
-                                                   const CustomFieldMap& fieldMap,
-                                                   const OpStatusMap& statusMap) {
-    std::vector<aid::Ticket> out;
-    auto embIt = resp.find("_embedded");
-    if (embIt == resp.end() || !embIt->is_object())
-        return out;
-    auto elIt = embIt->find("elements");
-    if (elIt == embIt->end() || !elIt->is_array())
-        return out;
-    out.reserve(elIt->size());
-    for (const auto& e : *elIt) {
-        auto parsed = parseFromHal(e, fieldMap, statusMap);
-        if (!parsed)
-            return unexpected(parsed.error());
-        out.push_back(std::move(*parsed));
-    }
-    return out;
-}
-
 } // namespace
 
 Task<Result<std::optional<aid::Ticket>>> OpTicketRepo::findByExactCallid(aid::CallId callid) {
@@ -111,16 +152,46 @@ Task<Result<std::optional<aid::Ticket>>> OpTicketRepo::findByExactCallid(aid::Ca
     auto resp = co_await http_.get(path);
     if (!resp)
         co_return unexpected(resp.error());
-    co_return firstFromCollection(*resp, fieldMap_, statusMap_);
+    auto found = firstFromCollection(*resp, fieldMap_, statusMap_);
+    if (found && found->has_value())
+        indexCallids(**found);
+    co_return found;
 }
 
 Task<Result<std::optional<aid::Ticket>>> OpTicketRepo::findByCallidContains(aid::CallId callid) {
+    // Local index first: a by-id GET is far cheaper than OpenProject's LIKE scan
+    // over customField values. The entry is only a hint — keep the fetched
+    // ticket only if it STILL carries the callid (a hangup removes it; an admin
+    // may have moved it), otherwise drop the entry and ask OpenProject.
+    if (callidIndex_ != nullptr) {
+        if (auto hinted = callidIndex_->lookup(callid)) {
+            auto fetched = co_await fetchById(*hinted);
+            if (fetched) {
+                const bool carries =
+                    std::any_of(fetched->callIds.begin(), fetched->callIds.end(),
+                                [&callid](const aid::CallId& c) { return c.v == callid.v; });
+                if (carries)
+                    co_return std::optional<aid::Ticket>{std::move(*fetched)};
+            } else if (fetched.error().code != ErrorCode::NotFound &&
+                       fetched.error().code != ErrorCode::Forbidden) {
+                // Transport / auth failure: the filter query would hit the same
+                // upstream, so surface it rather than pay for a second failure.
+                // 404/403 just mean the hinted ticket is gone or out of reach.
+                co_return unexpected(fetched.error());
+            }
+            callidIndex_->forget(callid, *hinted);
+        }
+    }
+
     const std::string path =
         singleFilterUrl("/api/v3/work_packages", customFieldName(fieldMap_.callId), "~", callid.v);
     auto resp = co_await http_.get(path);
     if (!resp)
         co_return unexpected(resp.error());
-    co_return firstFromCollection(*resp, fieldMap_, statusMap_);
+    auto found = firstFromCollection(*resp, fieldMap_, statusMap_);
+    if (found && found->has_value())
+        indexCallids(**found);
+    co_return found;
 }
 
 Task<Result<std::optional<aid::Ticket>>>
@@ -139,6 +210,7 @@ OpTicketRepo::findLatestOpenCallInProject(aid::ProjectId project) {
     std::string path = multiFilterUrl("/api/v3/work_packages", filters);
     path.append("&sortBy=");
     path.append(urlEncode("[[\"updatedAt\",\"desc\"]]"));
+    path = withSelect(std::move(path), fieldMap_, HalProjection::Routing);
     auto resp = co_await http_.get(path);
     if (!resp)
         co_return unexpected(resp.error());
@@ -175,13 +247,60 @@ OpTicketRepo::findOpenInProjectByCallerNumber(aid::ProjectId project, aid::Phone
         {{"status",
           {{"operator", "!"}, {"values", {statusMap_.hrefIdFor(aid::TicketStatus::Closed).v}}}}});
 
-    const std::string path = multiFilterUrl("/api/v3/work_packages", filters);
+    const std::string path = withSelect(multiFilterUrl("/api/v3/work_packages", filters),
+                                        fieldMap_, HalProjection::Routing);
     auto resp = co_await http_.get(path);
     if (!resp)
         co_return unexpected(resp.error());
     co_return firstFromCollection(*resp, fieldMap_, statusMap_);
 }
 
+Task<Result<std::vector<std::optional<aid::Ticket>>>>
+OpTicketRepo::findOpenByCallerNumberInProjects(std::vector<aid::ProjectId> projects,
+                                               aid::PhoneNumber caller) {
+    std::vector<std::optional<aid::Ticket>> latest(projects.size());
+    if (projects.empty())
+        co_return latest;
+
+    // Same predicate as findOpenInProjectByCallerNumber, with the project
+    // filter widened to the whole set (operator "=" with several values is
+    // OpenProject's IN) and sorted newest update first, so the first row seen
+    // for a project is that project's latest open ticket.
+    nlohmann::json projectValues = nlohmann::json::array();
+    for (const auto& p : projects)
+        projectValues.push_back(p.v);
+
+    nlohmann::json filters = nlohmann::json::array();
+    filters.push_back({{"project", {{"operator", "="}, {"values", projectValues}}}});
+    filters.push_back(
+        {{customFieldName(fieldMap_.callerNumber), {{"operator", "="}, {"values", {caller.v}}}}});
+    filters.push_back(
+        {{"status",
+          {{"operator", "!"}, {"values", {statusMap_.hrefIdFor(aid::TicketStatus::Closed).v}}}}});
+
+    std::string path = multiFilterUrl("/api/v3/work_packages", filters);
+    path.append("&sortBy=");
+    path.append(urlEncode("[[\"updatedAt\",\"desc\"]]"));
+    path = withSelect(std::move(path), fieldMap_, HalProjection::Routing);
+    // Paged, not a single GET: one caller's open tickets across many projects
+    // is small, but the newest-per-project pick must never be decided on a
+    // truncated page.
+    auto open = co_await getAllPaged(std::move(path));
+    if (!open)
+        co_return unexpected(open.error());
+
+    // A ticket's projectId is the numeric tail of its project href, the same
+    // id form the filter above was given.
+    for (const auto& t : *open) {
+        for (std::size_t i = 0; i < projects.size(); ++i) {
+            if (!latest[i].has_value() && projects[i].v == t.projectId.v) {
+                latest[i] = t;
+            }
+        }
+    }
+    co_return latest;
+}
+
 Task<Result<std::optional<std::string>>>
 OpTicketRepo::resolveAssigneeHref(const std::optional<aid::UserHandle>& assignee,
                                   bool omitOnLookupFailure) {
@@ -221,7 +340,7 @@ OpTicketRepo::resolveAssigneeHref(const std::optional<aid::UserHandle>& assignee
     co_return unexpected(href.error());
 }
 
-Task<Result<aid::TicketId>> OpTicketRepo::create(const aid::NewTicket& nt) {
+Task<Result<nlohmann::json>> OpTicketRepo::postNew(const aid::NewTicket& nt) {
     const std::string path = "/api/v3/projects/" + urlEncode(nt.projectId.v) + "/work_packages";
 
     auto assigneeHref = co_await resolveAssigneeHref(nt.assignee, /*omitOnLookupFailure=*/false);
@@ -229,18 +348,18 @@ Task<Result<aid::TicketId>> OpTicketRepo::create(const aid::NewTicket& nt) {
         co_return unexpected(assigneeHref.error());
 
     auto body = toCreatePayload(nt, fieldMap_, statusMap_, cfg_, *assigneeHref);
-    auto resp = co_await http_.post(path, body);
-    if (!resp)
-        co_return unexpected(resp.error());
+    co_return co_await http_.post(path, body);
+}
 
-    // The POST response is a HAL representation of the new work_package.
-    // We only need its id; parsing the whole body would force assignee /
-    // status lookups for a value the caller doesn't read.
-    auto idIt = resp->find("id");
-    if (idIt == resp->end()) {
-        co_return unexpected(Error{ErrorCode::Unknown,
-                                   "OpTicketRepo::create: response has no top-level id",
-                                   std::nullopt});
+Result<aid::TicketId> OpTicketRepo::recordCreated(const nlohmann::json& resp,
+                                                  const aid::CallId& callid) {
+    // The POST response is a HAL representation of the new work_package; the
+    // id is all create() needs from it.
+    auto idIt = resp.find("id");
+    if (idIt == resp.end()) {
+        return unexpected(Error{ErrorCode::Unknown,
+                                "OpTicketRepo::create: response has no top-level id",
+                                std::nullopt});
     }
     aid::TicketId newId;
     if (idIt->is_number_integer())
@@ -248,16 +367,15 @@ Task<Result<aid::TicketId>> OpTicketRepo::create(const aid::NewTicket& nt) {
     else if (idIt->is_string())
         newId = aid::TicketId{idIt->get<std::string>()};
     else
-        co_return unexpected(Error{ErrorCode::Unknown,
-                                   "OpTicketRepo::create: id has unexpected type", std::nullopt});
+        return unexpected(Error{ErrorCode::Unknown,
+                                "OpTicketRepo::create: id has unexpected type", std::nullopt});
 
     // Phase 6 echo suppression: remember the version OpenProject assigned the
     // new work package so the matching "created" webhook is recognised as our
     // own and not re-emitted as a live delta. The POST response carries
     // lockVersion at the top level (no extra round-trip / assignee lookup).
     if (producedLedger_ != nullptr) {
-        if (auto lvIt = resp->find("lockVersion");
-            lvIt != resp->end() && lvIt->is_number_integer()) {
+        if (auto lvIt = resp.find("lockVersion"); lvIt != resp.end() && lvIt->is_number_integer()) {
             producedLedger_->record(newId, lvIt->get<int>());
         }
     }
@@ -268,11 +386,161 @@ Task<Result<aid::TicketId>> OpTicketRepo::create(const aid::NewTicket& nt) {
     if (handlerLedger_ != nullptr)
         handlerLedger_->record(newId, std::vector<aid::UserHandle>{});
 
-    co_return newId;
+    // The callid the ticket was opened for — the Accepted/Hangup events that
+    // follow look it up by exactly this value.
+    if (callidIndex_ != nullptr)
+        callidIndex_->record(callid, newId);
+
+    return newId;
+}
+
+Task<Result<aid::TicketId>> OpTicketRepo::create(const aid::NewTicket& nt) {
+    // Copy the callid out before the first co_await: `nt` is the caller's and
+    // the Task is eager.
+    const aid::CallId callid = nt.callId;
+    // Until its version is recorded, the "created" webhook may be our echo.
+    const ProducedLedger::PendingWrite pending{producedLedger_, std::nullopt};
+    auto resp = co_await postNew(nt);
+    if (!resp)
+        co_return unexpected(resp.error());
+    co_return recordCreated(*resp, callid);
+}
+
+Task<Result<std::optional<aid::Ticket>>> OpTicketRepo::createAndGet(const aid::NewTicket& nt) {
+    const aid::CallId callid = nt.callId;
+    const ProducedLedger::PendingWrite pending{producedLedger_, std::nullopt};
+    auto resp = co_await postNew(nt);
+    if (!resp)
+        co_return unexpected(resp.error());
+    auto newId = recordCreated(*resp, callid);
+    if (!newId)
+        co_return unexpected(newId.error());
+
+    // OpenProject answers the POST with the full work package, so parse it
+    // rather than GET it again. parseFromHal is synchronous (the assignee is
+    // read off the link, never resolved), so this costs no round trip.
+    auto parsed = parseFromHal(*resp, fieldMap_, statusMap_);
+    if (parsed) {
+        indexCallids(*parsed);
+        trackOpenCall(*parsed);
+        cacheTicket(*parsed);
+        co_return std::optional<aid::Ticket>{std::move(*parsed)};
+    }
+
+    // A body we cannot parse (a proxy trimming it, an older OpenProject) still
+    // created the ticket; read it back the old way, and report "created but
+    // unreadable" rather than an error if that fails too.
+    auto fresh = co_await fetchById(*newId);
+    if (!fresh)
+        co_return std::optional<aid::Ticket>{};
+    co_return std::optional<aid::Ticket>{std::move(*fresh)};
 }
 
+struct OpTicketRepo::SaveTurn {
+    std::mutex& mtx;
+    PendingSave& self;
+
+    bool await_ready() {
+        std::scoped_lock lk{mtx};
+        return self.result.has_value() || self.leads;
+    }
+
+    bool await_suspend(std::coroutine_handle<> h) {
+        std::scoped_lock lk{mtx};
+        if (self.result.has_value() || self.leads)
+            return false;
+        self.waiter = h;
+        self.deadline = aid::plumbing::currentDeadline();
+        return true;
+    }
+
+    void await_resume() const noexcept {}
+};
+
 Task<Result<aid::Ticket>> OpTicketRepo::save(aid::TicketId id, aid::ports::TicketReducer reduce) {
+    auto self = std::make_shared<PendingSave>();
+    self->reduce = std::move(reduce);
+
+    bool queued = false;
+    {
+        std::scoped_lock lk{saveMtx_};
+        auto [it, first] = saveQueues_.try_emplace(id.v);
+        if (!first) {
+            it->second.push_back(self);
+            queued = true;
+        }
+    }
+
+    // The batch this caller writes: just itself when nothing was in flight;
+    // when promoted, everything that queued behind the previous PATCH (itself
+    // first, the rest in arrival order).
+    std::vector<std::shared_ptr<PendingSave>> batch;
+    if (queued) {
+        co_await SaveTurn{saveMtx_, *self};
+        if (self->result)
+            co_return std::move(*self->result);
+        std::scoped_lock lk{saveMtx_};
+        batch = std::exchange(saveQueues_[id.v], {});
+    } else {
+        batch.push_back(self);
+    }
+
+    // Re-applied from scratch on every 409 refresh inside saveNow, so each
+    // queued delta is re-derived against the fresh server state exactly as a
+    // lone save's would be.
+    const aid::ports::TicketReducer combined = [&batch](aid::Ticket t) {
+        for (const auto& p : batch)
+            t = p->reduce(std::move(t));
+        return t;
+    };
+    // A throw (a reducer, OOM) becomes this batch's error, so the hand-off
+    // below always runs: otherwise the queue entry would outlive its leader
+    // and every later save to the ticket would wait behind it for good.
+    Result<aid::Ticket> result = unexpected(Error{ErrorCode::Unknown, "save threw", std::nullopt});
+    try {
+        result = co_await saveNow(id, combined);
+    } catch (const std::exception& e) {
+        result = unexpected(Error{ErrorCode::Unknown, std::string{"save threw: "} + e.what(),
+                                  std::nullopt});
+    } catch (...) {
+    }
+
+    // Hand the outcome to the rest of the batch and promote the head of
+    // whatever queued meanwhile; resume them only after dropping the lock.
+    std::vector<std::pair<std::coroutine_handle<>, std::optional<aid::plumbing::Deadline>>> wake;
+    {
+        std::scoped_lock lk{saveMtx_};
+        for (const auto& p : batch) {
+            if (p == self)
+                continue;
+            p->result = result;
+            if (p->waiter)
+                wake.emplace_back(std::exchange(p->waiter, {}), p->deadline);
+        }
+        auto it = saveQueues_.find(id.v);
+        if (it->second.empty()) {
+            saveQueues_.erase(it);
+        } else {
+            PendingSave& next = *it->second.front();
+            next.leads = true;
+            if (next.waiter)
+                wake.emplace_back(std::exchange(next.waiter, {}), next.deadline);
+        }
+    }
+    // Each under its own event's budget, not this leader's.
+    for (const auto& [h, deadline] : wake) {
+        const aid::plumbing::DeadlineScope scope{deadline};
+        h.resume();
+    }
+    co_return result;
+}
+
+Task<Result<aid::Ticket>> OpTicketRepo::saveNow(aid::TicketId id,
+                                                aid::ports::TicketReducer reduce) {
     const std::string path = "/api/v3/work_packages/" + urlEncode(id.v);
+    // Held until the post-PATCH version is recorded, so an echo webhook that
+    // overtakes the PATCH response waits for it instead of passing as external.
+    const ProducedLedger::PendingWrite pending{producedLedger_, id};
 
     // Seed from the freshest server state, then apply the caller's pure delta to
     // it. Re-deriving the delta from the server's CURRENT state — here, and on
@@ -281,10 +549,22 @@ Task<Result<aid::Ticket>> OpTicketRepo::save(aid::TicketId id, aid::ports::Ticke
     // snapshot's callLength / callId / description across a conflict. This
     // mirrors addCallHandler's refetch→apply→patch loop, generalised to any
     // field.
-    auto initial = co_await fetchById(id);
-    if (!initial)
-        co_return unexpected(initial.error());
-    aid::Ticket t = reduce(std::move(*initial));
+    //
+    // The seed is the cached copy when there is one — usually the response to
+    // this daemon's own previous write, so the PATCH below is the only round
+    // trip. If the ticket has moved on since, its lockVersion no longer matches,
+    // OpenProject answers 409 and refresh() re-fetches: the same path a lost race
+    // always took.
+    std::optional<aid::Ticket> seed;
+    if (ticketCache_ != nullptr)
+        seed = ticketCache_->lookup(id);
+    if (!seed) {
+        auto initial = co_await fetchById(id);
+        if (!initial)
+            co_return unexpected(initial.error());
+        seed = std::move(*initial);
+    }
+    aid::Ticket t = reduce(std::move(*seed));
 
     // 422-tolerance on the assignee link. OpenProject rejects assigning a work
     // package to a user who is not a member of its project with HTTP 422. The
@@ -332,8 +612,12 @@ Task<Result<aid::Ticket>> OpTicketRepo::save(aid::TicketId id, aid::ports::Ticke
         includeAssignee = false;
         patched = co_await http_.retryOn409(patchFn, refresh);
     }
-    if (!patched)
+    if (!patched) {
+        // Whatever went wrong, the cached copy is no longer a safe seed.
+        if (ticketCache_ != nullptr)
+            ticketCache_->forget(id);
         co_return unexpected(patched.error());
+    }
 
     auto result = parseFromHal(*patched, fieldMap_, statusMap_);
     // Phase 6 echo suppression: record the post-PATCH version so the webhook
@@ -346,11 +630,29 @@ Task<Result<aid::Ticket>> OpTicketRepo::save(aid::TicketId id, aid::ports::Ticke
     if (result && handlerLedger_ != nullptr) {
         handlerLedger_->record(result->id, result->callHandlers);
     }
+    // A reducer that appended a callid (roll-up of a repeat caller) makes the new
+    // callid resolvable locally from here on.
+    if (result) {
+        indexCallids(*result);
+        trackOpenCall(*result);
+        cacheTicket(*result);
+    } else if (ticketCache_ != nullptr) {
+        ticketCache_->forget(id);
+    }
     co_return result;
 }
 
 Task<Result<void>> OpTicketRepo::addCallHandler(aid::TicketId id, aid::UserHandle login) {
+    auto merged = co_await addCallHandlerAndGet(std::move(id), std::move(login));
+    if (!merged)
+        co_return unexpected(merged.error());
+    co_return Result<void>{};
+}
+
+Task<Result<std::optional<aid::Ticket>>>
+OpTicketRepo::addCallHandlerAndGet(aid::TicketId id, aid::UserHandle login) {
     const std::string path = "/api/v3/work_packages/" + urlEncode(id.v);
+    const ProducedLedger::PendingWrite pending{producedLedger_, id};
 
     auto contains = [&login](const aid::Ticket& tkt) {
         return std::any_of(tkt.callHandlers.begin(), tkt.callHandlers.end(),
@@ -364,7 +666,7 @@ Task<Result<void>> OpTicketRepo::addCallHandler(aid::TicketId id, aid::UserHandl
         co_return unexpected(initial.error());
     aid::Ticket fresh = std::move(*initial);
     if (contains(fresh))
-        co_return Result<void>{};
+        co_return std::optional<aid::Ticket>{std::move(fresh)};
     fresh.callHandlers.push_back(login);
 
     // Drive the PATCH through the shared 409 loop, but RE-MERGE on every retry:
@@ -393,8 +695,7 @@ Task<Result<void>> OpTicketRepo::addCallHandler(aid::TicketId id, aid::UserHandl
     // Phase 6 echo suppression: record the post-PATCH version so the webhook
     // OpenProject fires for this very edit is recognised as our own echo. The
     // PATCH response is a full work_package HAL with lockVersion at the top
-    // level, and `id` is already in scope — no parse of the full ticket is
-    // needed (this returns void), matching create()'s lighter recording path.
+    // level, and `id` is already in scope.
     if (producedLedger_ != nullptr) {
         if (auto lvIt = patched->find("lockVersion");
             lvIt != patched->end() && lvIt->is_number_integer()) {
@@ -406,7 +707,23 @@ Task<Result<void>> OpTicketRepo::addCallHandler(aid::TicketId id, aid::UserHandl
     // diffs against the set that includes `login`.
     if (handlerLedger_ != nullptr)
         handlerLedger_->record(id, fresh.callHandlers);
-    co_return Result<void>{};
+
+    // That same PATCH response is the post-merge ticket the caller's live delta
+    // needs. A body that does not parse is read back the old way, as in
+    // createAndGet; only if that fails too is it "merged, not readable here".
+    auto result = parseFromHal(*patched, fieldMap_, statusMap_);
+    if (!result) {
+        // The write moved the ticket on; a cached copy would only cost a 409.
+        if (ticketCache_ != nullptr)
+            ticketCache_->forget(id);
+        auto reread = co_await fetchById(id);
+        if (!reread)
+            co_return std::optional<aid::Ticket>{};
+        co_return std::optional<aid::Ticket>{std::move(*reread)};
+    }
+    trackOpenCall(*result);
+    cacheTicket(*result);
+    co_return std::optional<aid::Ticket>{std::move(*result)};
 }
 
 Task<Result<void>> OpTicketRepo::closeTwoStep(aid::TicketId id) {
@@ -445,9 +762,31 @@ Task<Result<void>> OpTicketRepo::closeTwoStep(aid::TicketId id) {
     co_return Result<void>{};
 }
 
+Result<std::size_t> OpTicketRepo::absorbPage(std::string_view body,
+                                             std::vector<aid::Ticket>& all, long long& total) {
+    // Streamed, not DOM-parsed: a full page is up to kDashboardPageSize
+    // elements, and each is parsed and indexed as soon as it has been read.
+    const HalElementSink sink = [this, &all](nlohmann::json&& element) -> Result<void> {
+        auto parsed = parseFromHal(element, fieldMap_, statusMap_);
+        if (!parsed)
+            return unexpected(parsed.error());
+        // Scans are the index's cold-start feed: a dashboard load or
+        // membership reconcile learns every open call's callids for free.
+        indexCallids(*parsed);
+        all.push_back(std::move(*parsed));
+        return Result<void>{};
+    };
+    auto page = streamHalCollection(body, workPackageFields(fieldMap_), sink);
+    if (!page)
+        return unexpected(page.error());
+    if (page->total >= 0)
+        total = page->total;
+    return page->elements;
+}
+
 Task<Result<std::vector<aid::Ticket>>> OpTicketRepo::getAllPaged(std::string baseUrlWithFilters) {
     // OpenProject API v3 paginates a HAL collection via `offset` (the 1-based
-    // page NUMBER, not a row offset) and `pageSize`. We loop offset=1,2,…
+    // page NUMBER, not a row offset) and `pageSize`. We read offset=1,2,…
     // accumulating each page's elements until the whole result set is collected.
     //
     // Termination is driven by the collection's `total` (the authoritative match
@@ -462,39 +801,85 @@ Task<Result<std::vector<aid::Ticket>>> OpTicketRepo::getAllPaged(std::string bas
     // is absent. A result set within one page still costs exactly one GET.
     // `baseUrlWithFilters` already carries `?filters=<…>`, so the pagination
     // params splice on with `&`.
+    //
+    // Page 1 is fetched alone: it tells us `total` and, by its row count, the
+    // page size the server actually applied. Every remaining page number is then
+    // known up front, so those are fetched kPageFanOut at a time instead of one
+    // round trip after another, and merged strictly in page order.
     std::vector<aid::Ticket> all;
     long long total = -1;
-    for (int page = 1;; ++page) {
-        std::string path = baseUrlWithFilters;
-        path.append("&offset=");
-        path.append(std::to_string(page));
-        path.append("&pageSize=");
-        path.append(std::to_string(kDashboardPageSize));
-
-        auto resp = co_await http_.get(path);
-        if (!resp)
-            co_return unexpected(resp.error());
-
-        if (auto it = resp->find("total"); it != resp->end() && it->is_number())
-            total = it->template get<long long>();
-
-        auto parsed = allFromCollection(*resp, fieldMap_, statusMap_);
-        if (!parsed)
-            co_return unexpected(parsed.error());
-
-        const std::size_t got = parsed->size();
-        for (auto& t : *parsed)
-            all.push_back(std::move(t));
 
-        // Authoritative stop: every matching row has been collected.
+    // Fallback stops (only when `total` was never reported): an empty page means
+    // nothing more to read; a short page means OpenProject honoured our full
+    // request and had no more rows.
+    const auto exhausted = [&all, &total](std::size_t got) {
         if (total >= 0 && static_cast<long long>(all.size()) >= total)
-            break;
-        // Fallbacks (only when `total` was never reported): an empty page means
-        // nothing more to read; a short page means OpenProject honoured our full
-        // request and had no more rows.
+            return true;
         if (got == 0)
-            break;
-        if (total < 0 && got < static_cast<std::size_t>(kDashboardPageSize))
+            return true;
+        return total < 0 && got < static_cast<std::size_t>(kDashboardPageSize);
+    };
+
+    const std::string firstPath = pagedUrl(baseUrlWithFilters, 1);
+    auto first = co_await http_.getBody(firstPath);
+    if (!first)
+        co_return unexpected(first.error());
+    auto firstGot = absorbPage(*first, all, total);
+    if (!firstGot)
+        co_return unexpected(firstGot.error());
+    if (exhausted(*firstGot))
+        co_return all;
+
+    int page = 2;
+    if (total >= 0) {
+        // Not exhausted with `total` known means page 1 was a full page, so its
+        // row count is the effective page size.
+        const auto effective = static_cast<long long>(*firstGot);
+        const long long lastPage = (total + effective - 1) / effective;
+
+        // A sliding window of in-flight pages, awaited oldest first. Every
+        // launched request is awaited even after a failure: destroying a Task
+        // still suspended in the HttpClient would leave its completion callback
+        // resuming a freed frame.
+        std::deque<Task<Result<std::string>>> inFlight;
+        std::optional<Error> failed;
+        for (;;) {
+            while (!failed && page <= lastPage && inFlight.size() < kPageFanOut) {
+                const std::string path = pagedUrl(baseUrlWithFilters, page++);
+                inFlight.push_back(http_.getBody(path));
+            }
+            if (inFlight.empty())
+                break;
+            Task<Result<std::string>> oldest{std::move(inFlight.front())};
+            inFlight.pop_front();
+            auto resp = co_await oldest;
+            if (failed)
+                continue;
+            if (!resp) {
+                failed = resp.error();
+                continue;
+            }
+            auto got = absorbPage(*resp, all, total);
+            if (!got)
+                failed = got.error();
+        }
+        if (failed)
+            co_return unexpected(std::move(*failed));
+        if (static_cast<long long>(all.size()) >= total)
+            co_return all;
+        // The set grew while we were paging (a later page reported a larger
+        // `total`): pick up the remainder one page at a time below.
+    }
+
+    for (;; ++page) {
+        const std::string path = pagedUrl(baseUrlWithFilters, page);
+        auto resp = co_await http_.getBody(path);
+        if (!resp)
+            co_return unexpected(resp.error());
+        auto got = absorbPage(*resp, all, total);
+        if (!got)
+            co_return unexpected(got.error());
+        if (exhausted(*got))
             break;
     }
     co_return all;
@@ -520,7 +905,8 @@ OpTicketRepo::findCallTicketsInProjectsOpen(const std::vector<aid::ProjectId>& p
                           {statusMap_.hrefIdFor(aid::TicketStatus::New).v,
                            statusMap_.hrefIdFor(aid::TicketStatus::InProgress).v}}}}});
 
-    auto open = co_await getAllPaged(multiFilterUrl("/api/v3/work_packages", filters));
+    auto open = co_await getAllPaged(withSelect(multiFilterUrl("/api/v3/work_packages", filters),
+                                                fieldMap_, HalProjection::Listing));
     // Warm the handler-drop baseline from this dashboard read (Phase 6/S7): a load
     // is the only path that touches a ticket the daemon has not otherwise fetched
     // since a restart, so without this an admin handler-drop on such a ticket would
@@ -550,7 +936,8 @@ Task<Result<std::vector<aid::Ticket>>> OpTicketRepo::openCallsInProject(aid::Pro
                           {statusMap_.hrefIdFor(aid::TicketStatus::New).v,
                            statusMap_.hrefIdFor(aid::TicketStatus::InProgress).v}}}}});
 
-    co_return co_await getAllPaged(multiFilterUrl("/api/v3/work_packages", filters));
+    co_return co_await getAllPaged(withSelect(multiFilterUrl("/api/v3/work_packages", filters),
+                                              fieldMap_, HalProjection::Listing));
 }
 
 Task<Result<std::vector<aid::Ticket>>>
@@ -568,7 +955,8 @@ OpTicketRepo::findOpenTicketsAssignedTo(aid::UserHandle user) {
         {{"status",
           {{"operator", "!"}, {"values", {statusMap_.hrefIdFor(aid::TicketStatus::Closed).v}}}}});
 
-    co_return co_await getAllPaged(multiFilterUrl("/api/v3/work_packages", filters));
+    co_return co_await getAllPaged(withSelect(multiFilterUrl("/api/v3/work_packages", filters),
+                                              fieldMap_, HalProjection::Listing));
 }
 
 Task<Result<std::vector<aid::Ticket>>>
@@ -587,7 +975,8 @@ OpTicketRepo::findCallTicketsWithHandler(aid::UserHandle viewer) {
     filters.push_back(
         {{customFieldName(fieldMap_.callHandler), {{"operator", "~"}, {"values", {viewer.v}}}}});
 
-    auto all = co_await getAllPaged(multiFilterUrl("/api/v3/work_packages", filters));
+    auto all = co_await getAllPaged(withSelect(multiFilterUrl("/api/v3/work_packages", filters),
+                                               fieldMap_, HalProjection::Listing));
     if (!all)
         co_return unexpected(all.error());
 
@@ -626,24 +1015,25 @@ Task<Result<std::vector<aid::UserHandle>>> OpTicketRepo::recipientsFor(const aid
     const aid::ProjectId project = t.projectId;
     const std::vector<aid::UserHandle> handlers = t.callHandlers;
 
+    // The version is read BEFORE the members: a refresh landing in between
+    // leaves the newer set stamped with the older version, where the next
+    // lookup misses it rather than serving it past a later change.
+    std::optional<std::uint64_t> version;
+    if (recipientCache_ != nullptr) {
+        version = users_.membershipVersion(project);
+        if (version) {
+            if (auto hit = recipientCache_->lookup(project, *version, handlers))
+                co_return *hit;
+        }
+    }
+
     auto members = co_await users_.projectMembers(project);
     if (!members)
         co_return unexpected(members.error());
 
-    // members ∪ callHandlers, deduped by login, members first for determinism.
-    std::vector<aid::UserHandle> out;
-    out.reserve(members->size() + handlers.size());
-    std::unordered_set<std::string> seen;
-    seen.reserve(members->size() + handlers.size());
-    for (auto& m : *members) {
-        if (seen.insert(m.v).second)
-            out.push_back(std::move(m));
-    }
-    for (const auto& h : handlers) {
-        if (seen.insert(h.v).second)
-            out.push_back(h);
-    }
-    co_return out;
+    if (recipientCache_ != nullptr)
+        co_return *recipientCache_->rebuild(project, version, *members, handlers);
+    co_return RecipientCache::unite(*members, handlers);
 }
 
 Task<Result<std::vector<aid::UserHandle>>>
@@ -1,8 +1,12 @@
 #include "aid/adapters/openproject/internal/OpUserRepo.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <deque>
 #include <mutex>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -10,8 +14,11 @@
 #include <utility>
 #include <vector>
 
+#include "aid/adapters/openproject/internal/halstream.h"
+#include "aid/adapters/openproject/internal/payload.h"
 #include "aid/adapters/openproject/internal/url.h"
 #include "aid/plumbing/Error.h"
+#include "aid/value-types/TimeFormat.h"
 
 using aid::plumbing::Error;
 using aid::plumbing::ErrorCode;
@@ -21,6 +28,38 @@ using aid::plumbing::unexpected;
 
 namespace aid::adapters::openproject {
 
+namespace {
+
+// Principal ids per bulk /api/v3/users request. Also sent as the pageSize, so
+// OpenProject's default 20-row page never truncates a chunk; it keeps the
+// encoded filter well inside any proxy's URL limit.
+constexpr std::size_t kPrincipalChunk = 100;
+
+// How many bulk user requests may be in flight at once — the same bound
+// getAllPaged puts on its page fan-out.
+constexpr std::size_t kPrincipalFanOut = 4;
+
+// `/api/v3/users?filters=[{"id":{"operator":"=","values":[<ids>]}}]` for one
+// chunk of numeric user ids.
+std::string usersByIdUrl(const std::vector<std::string>& ids) {
+    nlohmann::json values = nlohmann::json::array();
+    for (const auto& id : ids)
+        values.push_back(id);
+    nlohmann::json filters = nlohmann::json::array();
+    filters.push_back({{"id", {{"operator", "="}, {"values", std::move(values)}}}});
+    std::string url = multiFilterUrl("/api/v3/users", filters);
+    url.append("&pageSize=");
+    url.append(std::to_string(ids.size()));
+    return url;
+}
+
+} // namespace
+
+OpUserRepo::OpUserRepo(OpHttp& http, Clock clock) : http_(http), clock_(std::move(clock)) {
+    if (!clock_)
+        clock_ = [] { return std::chrono::system_clock::now(); };
+}
+
 Task<Result<std::optional<aid::UserHandle>>> OpUserRepo::resolveLogin(std::string_view login) {
     const std::string url = singleFilterUrl("/api/v3/users", "login", "=", login);
     auto resp = co_await http_.get(url);
@@ -192,6 +231,79 @@ Task<Result<std::optional<aid::UserHandle>>> OpUserRepo::loginForUserHref(std::s
     co_return std::optional<aid::UserHandle>{handle};
 }
 
+void OpUserRepo::absorbUsers(const nlohmann::json& resp,
+                             const std::unordered_map<std::string, std::string>& hrefById) {
+    auto embIt = resp.find("_embedded");
+    if (embIt == resp.end() || !embIt->is_object())
+        return;
+    auto elIt = embIt->find("elements");
+    if (elIt == embIt->end() || !elIt->is_array())
+        return;
+
+    std::scoped_lock lk{cacheMtx_};
+    for (const auto& u : *elIt) {
+        auto lg = u.find("login");
+        if (lg == u.end() || !lg->is_string())
+            continue; // no login exposed — left to loginForUserHref's verdict
+        std::string id;
+        if (auto idIt = u.find("id"); idIt != u.end() && idIt->is_number_integer())
+            id = std::to_string(idIt->get<long long>());
+        else if (idIt != u.end() && idIt->is_string())
+            id = idIt->get<std::string>();
+        auto hrefIt = hrefById.find(id);
+        if (hrefIt == hrefById.end())
+            continue;
+        aid::UserHandle handle{lg->get<std::string>()};
+        // Keyed by the principal href exactly as the membership named it, so
+        // the loginForUserHref call that follows is a hit.
+        loginByHref_.emplace(hrefIt->second, handle);
+        hrefCache_.emplace(std::move(handle), hrefIt->second);
+    }
+}
+
+Task<void> OpUserRepo::resolvePrincipals(std::vector<std::string> principalHrefs) {
+    // The user principals not yet in loginByHref_, by numeric id.
+    std::unordered_map<std::string, std::string> hrefById;
+    std::vector<std::string> ids;
+    {
+        std::scoped_lock lk{cacheMtx_};
+        for (const auto& href : principalHrefs) {
+            if (href.find("/users/") == std::string::npos || loginByHref_.count(href) != 0)
+                continue;
+            std::string id = hrefTail(href);
+            if (hrefById.emplace(id, href).second)
+                ids.push_back(std::move(id));
+        }
+    }
+    if (ids.empty())
+        co_return;
+
+    // One filtered GET per kPrincipalChunk ids, kPrincipalFanOut of them in
+    // flight at a time. Best-effort: a failed chunk only leaves its principals
+    // cold for loginForUserHref to fetch one by one, as before. Every launched
+    // request is awaited so no Task is destroyed while suspended in the
+    // HttpClient.
+    std::deque<Task<Result<nlohmann::json>>> inFlight;
+    std::size_t next = 0;
+    for (;;) {
+        while (next < ids.size() && inFlight.size() < kPrincipalFanOut) {
+            const std::size_t end = std::min(ids.size(), next + kPrincipalChunk);
+            const std::vector<std::string> chunk(ids.begin() + static_cast<std::ptrdiff_t>(next),
+                                                 ids.begin() + static_cast<std::ptrdiff_t>(end));
+            next = end;
+            const std::string url = usersByIdUrl(chunk);
+            inFlight.push_back(http_.get(url));
+        }
+        if (inFlight.empty())
+            break;
+        Task<Result<nlohmann::json>> oldest{std::move(inFlight.front())};
+        inFlight.pop_front();
+        auto resp = co_await oldest;
+        if (resp)
+            absorbUsers(*resp, hrefById);
+    }
+}
+
 Task<Result<std::vector<aid::UserHandle>>> OpUserRepo::projectMembers(aid::ProjectId project) {
     // Cache hit: a project resolved once is served from cache until
     // refreshMembership swaps in a fresh set.
@@ -213,10 +325,16 @@ Task<Result<std::vector<aid::UserHandle>>> OpUserRepo::projectMembers(aid::Proje
     // Collect principal hrefs first so no json iterator is held across the
     // per-principal co_await below.
     std::vector<std::string> principalHrefs;
+    std::optional<aid::Timestamp> highWater;
     if (auto embIt = resp->find("_embedded"); embIt != resp->end() && embIt->is_object()) {
         if (auto elIt = embIt->find("elements"); elIt != embIt->end() && elIt->is_array()) {
             principalHrefs.reserve(elIt->size());
             for (const auto& el : *elIt) {
+                if (auto up = el.find("updatedAt"); up != el.end() && up->is_string()) {
+                    auto at = parseIso8601Utc(up->get<std::string>());
+                    if (at && (!highWater || *highWater < *at))
+                        highWater = at;
+                }
                 auto links = el.find("_links");
                 if (links == el.end() || !links->is_object())
                     continue;
@@ -232,7 +350,10 @@ Task<Result<std::vector<aid::UserHandle>>> OpUserRepo::projectMembers(aid::Proje
     // Resolve each user principal to its login so the result unions cleanly with
     // the callHandler CSV (logins) and matches the session handle the WS hub keys
     // on. Only user principals carry a login; skip group/placeholder principals.
-    // Dedup so a user who is a member through several roles appears once.
+    // Dedup so a user who is a member through several roles appears once. The
+    // cold ones are warmed in bulk first, so the loop below is cache hits except
+    // for principals the bulk query did not return.
+    co_await resolvePrincipals(principalHrefs);
     std::vector<aid::UserHandle> members;
     std::unordered_set<std::string> seen;
     members.reserve(principalHrefs.size());
@@ -248,7 +369,14 @@ Task<Result<std::vector<aid::UserHandle>>> OpUserRepo::projectMembers(aid::Proje
 
     {
         std::scoped_lock lk{cacheMtx_};
-        membersCache_.emplace(project, members);
+        if (membersCache_.emplace(project, members).second)
+            versions_.insert_or_assign(project, nextVersion_++);
+        // The newest membership seen is where refreshMembership's incremental
+        // pass reads this project forward from. A project with none gets no
+        // watermark, so the next refresh is a full sweep: our own clock is no
+        // bound on the server's updatedAt.
+        if (highWater)
+            watermarks_.emplace(project, *highWater);
     }
     co_return members;
 }
@@ -258,27 +386,52 @@ Task<Result<std::vector<aid::MembershipDelta>>> OpUserRepo::refreshMembership()
     // page and stop on the collection's authoritative `total` (same discipline
     // as OpTicketRepo::getAllPaged).
     constexpr int kMembershipPageSize = 200;
+    const HalElementFields membershipFields{{"_links", "updatedAt"}, {"project", "principal"}};
 
     // Snapshot the projects we already track. A project enters membersCache_
     // only via projectMembers; if nothing has been resolved yet there is
-    // nothing to reconcile.
+    // nothing to reconcile. Pick the mode while holding the lock: incremental
+    // only when a full sweep ran within kFullSweepInterval and every tracked
+    // project has a watermark to read forward from.
     std::vector<aid::ProjectId> projects;
+    std::optional<aid::Timestamp> since;
+    const aid::Timestamp now = clock_();
     {
         std::scoped_lock lk{cacheMtx_};
         projects.reserve(membersCache_.size());
         for (const auto& kv : membersCache_)
             projects.push_back(kv.first);
+        if (lastFullSweep_ && now - *lastFullSweep_ < kFullSweepInterval) {
+            for (const auto& p : projects) {
+                auto wm = watermarks_.find(p);
+                if (wm == watermarks_.end()) {
+                    since.reset();
+                    break;
+                }
+                if (!since || wm->second < *since)
+                    since = wm->second;
+            }
+        }
     }
     if (projects.empty())
         co_return std::vector<aid::MembershipDelta>{};
+    const bool incremental = since.has_value();
 
     // One batched filter for every tracked project:
-    // [{"project":{"operator":"=","values":["<id>","<id>",…]}}].
+    // [{"project":{"operator":"=","values":["<id>","<id>",…]}}], narrowed on an
+    // incremental pass to the memberships created or changed at or after the
+    // oldest watermark. The bound is inclusive (the watermark has second
+    // resolution), so the rows at it come back again and are no-ops.
     nlohmann::json values = nlohmann::json::array();
     for (const auto& p : projects)
         values.push_back(p.v);
     nlohmann::json filters = nlohmann::json::array();
     filters.push_back({{"project", {{"operator", "="}, {"values", std::move(values)}}}});
+    if (incremental) {
+        nlohmann::json window = nlohmann::json::array({aid::formatIso8601Utc(*since), ""});
+        filters.push_back(
+            {{"updatedAt", {{"operator", "<>d"}, {"values", std::move(window)}}}});
+    }
     const std::string base = multiFilterUrl("/api/v3/memberships", filters);
 
     // Page through the collection, accumulating (project, principal-href) rows.
@@ -286,8 +439,10 @@ Task<Result<std::vector<aid::MembershipDelta>>> OpUserRepo::refreshMembership()
     struct Row {
         aid::ProjectId project;
         std::string principalHref;
+        std::optional<aid::Timestamp> updatedAt;
     };
     std::vector<Row> rows;
+    std::optional<aid::Timestamp> firstPageHigh;
     long long total = -1;
     std::size_t accumulated = 0;
     for (int page = 1;; ++page) {
@@ -297,39 +452,48 @@ Task<Result<std::vector<aid::MembershipDelta>>> OpUserRepo::refreshMembership()
         path.append("&pageSize=");
         path.append(std::to_string(kMembershipPageSize));
 
-        auto resp = co_await http_.get(path);
+        auto resp = co_await http_.getBody(path);
         if (!resp)
             // SAFETY GUARD: a failed fetch ⇒ NO change. Keep every cached entry
             // and emit no delta — never read a transport/HTTP error as "all
             // members removed".
             co_return std::vector<aid::MembershipDelta>{};
 
-        if (auto it = resp->find("total"); it != resp->end() && it->is_number())
-            total = it->template get<long long>();
-
-        std::size_t got = 0;
-        if (auto embIt = resp->find("_embedded"); embIt != resp->end() && embIt->is_object()) {
-            if (auto elIt = embIt->find("elements"); elIt != embIt->end() && elIt->is_array()) {
-                got = elIt->size();
-                for (const auto& el : *elIt) {
-                    auto links = el.find("_links");
-                    if (links == el.end() || !links->is_object())
-                        continue;
-                    std::string projId;
-                    if (auto pj = links->find("project"); pj != links->end() && pj->is_object()) {
-                        if (auto hr = pj->find("href"); hr != pj->end() && hr->is_string())
-                            projId = hrefTail(hr->get<std::string>());
-                    }
-                    std::string prinHref;
-                    if (auto pr = links->find("principal"); pr != links->end() && pr->is_object()) {
-                        if (auto hr = pr->find("href"); hr != pr->end() && hr->is_string())
-                            prinHref = hr->get<std::string>();
-                    }
-                    if (!projId.empty() && !prinHref.empty())
-                        rows.push_back({aid::ProjectId{std::move(projId)}, std::move(prinHref)});
-                }
+        // Streamed: only each membership's project and principal links and its
+        // updatedAt are materialised, not its roles, self/update links or
+        // embedded objects.
+        const HalElementSink sink = [&rows](nlohmann::json&& el) -> Result<void> {
+            auto links = el.find("_links");
+            if (links == el.end() || !links->is_object())
+                return Result<void>{};
+            std::string projId;
+            if (auto pj = links->find("project"); pj != links->end() && pj->is_object()) {
+                if (auto hr = pj->find("href"); hr != pj->end() && hr->is_string())
+                    projId = hrefTail(hr->get<std::string>());
             }
-        }
+            std::string prinHref;
+            if (auto pr = links->find("principal"); pr != links->end() && pr->is_object()) {
+                if (auto hr = pr->find("href"); hr != pr->end() && hr->is_string())
+                    prinHref = hr->get<std::string>();
+            }
+            std::optional<aid::Timestamp> updatedAt;
+            if (auto up = el.find("updatedAt"); up != el.end() && up->is_string())
+                updatedAt = parseIso8601Utc(up->get<std::string>());
+            if (!projId.empty() && !prinHref.empty())
+                rows.push_back({aid::ProjectId{std::move(projId)}, std::move(prinHref), updatedAt});
+            return Result<void>{};
+        };
+        auto streamed = streamHalCollection(*resp, membershipFields, sink);
+        if (!streamed)
+            // Same guard for a body that does not parse: no change.
+            co_return std::vector<aid::MembershipDelta>{};
+        if (streamed->total >= 0)
+            total = streamed->total;
+        const std::size_t got = streamed->elements;
+        if (page == 1)
+            for (const auto& row : rows)
+                if (row.updatedAt && (!firstPageHigh || *firstPageHigh < *row.updatedAt))
+                    firstPageHigh = row.updatedAt;
 
         accumulated += got;
         if (total >= 0 && static_cast<long long>(accumulated) >= total)
@@ -340,18 +504,28 @@ Task<Result<std::vector<aid::MembershipDelta>>> OpUserRepo::refreshMembership()
             break;
     }
 
-    // SAFETY GUARD: a wholly-empty response while we still track projects is the
-    // signature of lost API-token permission, NOT every project simultaneously
-    // losing every member. Treat it as no change.
+    // SAFETY GUARD: a wholly-empty full sweep while we still track projects is
+    // the signature of lost API-token permission, NOT every project
+    // simultaneously losing every member. Treat it as no change. (An empty
+    // incremental pass is the common, quiet case.)
     if (rows.empty())
         co_return std::vector<aid::MembershipDelta>{};
 
     // Build the fresh per-project login set. Seed every queried project with an
     // empty set so a project that lost its *last* member still diffs against a
     // present-but-empty fresh set. Resolve each user principal to its login;
-    // warmed logins (every prior member) are loginByHref_ hits ⇒ 0 GETs.
+    // warmed logins (every prior member) are loginByHref_ hits ⇒ 0 GETs, and
+    // the newly seen ones are resolved together in bulk beforehand.
+    {
+        std::vector<std::string> principalHrefs;
+        principalHrefs.reserve(rows.size());
+        for (const auto& row : rows)
+            principalHrefs.push_back(row.principalHref);
+        co_await resolvePrincipals(std::move(principalHrefs));
+    }
     std::unordered_map<aid::ProjectId, std::vector<aid::UserHandle>> fresh;
     std::unordered_map<aid::ProjectId, std::unordered_set<std::string>> seen;
+    std::unordered_map<aid::ProjectId, aid::Timestamp> highWater;
     std::unordered_set<aid::ProjectId> tainted;
     fresh.reserve(projects.size());
     seen.reserve(projects.size());
@@ -360,13 +534,18 @@ Task<Result<std::vector<aid::MembershipDelta>>> OpUserRepo::refreshMembership()
         seen.emplace(p, std::unordered_set<std::string>{});
     }
     for (auto& row : rows) {
+        if (row.updatedAt) {
+            auto [hw, inserted] = highWater.emplace(row.project, *row.updatedAt);
+            if (!inserted && hw->second < *row.updatedAt)
+                hw->second = *row.updatedAt;
+        }
         if (row.principalHref.find("/users/") == std::string::npos)
             continue; // group / placeholder principal — no login to notify
         auto login = co_await loginForUserHref(row.principalHref);
         if (!login) {
             // Per-principal resolve failed: do not risk reading a transient
             // error as a removal. Taint this project so it is left untouched
-            // (cache kept, no delta) this cycle.
+            // (cache kept, no delta, watermark not advanced) this cycle.
             tainted.insert(row.project);
             continue;
         }
@@ -388,33 +567,73 @@ Task<Result<std::vector<aid::MembershipDelta>>> OpUserRepo::refreshMembership()
         if (cacheIt == membersCache_.end())
             continue; // defensive: vanished mid-flight
 
+        if (auto hw = highWater.find(p); hw != highWater.end()) {
+            auto [wm, inserted] = watermarks_.emplace(p, hw->second);
+            if (!inserted && wm->second < hw->second)
+                wm->second = hw->second;
+        } else if (firstPageHigh) {
+            // No dated row (typically: no memberships at all). The newest row
+            // on the first page is a server-side time no later than that page
+            // was served, so any membership the project gains afterwards is
+            // dated at or after it. Our own clock would be no such bound.
+            watermarks_.try_emplace(p, *firstPageHigh);
+        }
+
         std::vector<aid::UserHandle>& freshSet = fresh[p];
 
         std::unordered_set<std::string> oldLogins;
         oldLogins.reserve(cacheIt->second.size());
         for (const auto& u : cacheIt->second)
             oldLogins.insert(u.v);
-        std::unordered_set<std::string> newLogins;
-        newLogins.reserve(freshSet.size());
-        for (const auto& u : freshSet)
-            newLogins.insert(u.v);
 
         aid::MembershipDelta delta;
         delta.project = p;
         for (const auto& u : freshSet)
             if (oldLogins.count(u.v) == 0)
                 delta.added.push_back(u);
+
+        if (incremental) {
+            // Only the memberships that changed came back, so the fresh set is
+            // a slice, not the whole: fold its new logins in and remove nobody.
+            // A deleted membership leaves no row to see — the next full sweep
+            // catches it.
+            for (const auto& u : delta.added)
+                cacheIt->second.push_back(u);
+            if (!delta.added.empty()) {
+                versions_.insert_or_assign(p, nextVersion_++);
+                deltas.push_back(std::move(delta));
+            }
+            continue;
+        }
+
+        std::unordered_set<std::string> newLogins;
+        newLogins.reserve(freshSet.size());
+        for (const auto& u : freshSet)
+            newLogins.insert(u.v);
         for (const auto& u : cacheIt->second)
             if (newLogins.count(u.v) == 0)
                 delta.removed.push_back(u);
 
         // Swap in the fresh set (idempotent when unchanged); emit a delta only
         // when the set actually moved.
+        // Bumped on any difference, order included: recipientsFor lists the
+        // members in cached order.
+        if (cacheIt->second != freshSet)
+            versions_.insert_or_assign(p, nextVersion_++);
         cacheIt->second = std::move(freshSet);
         if (!delta.added.empty() || !delta.removed.empty())
             deltas.push_back(std::move(delta));
     }
+    if (!incremental)
+        lastFullSweep_ = now;
     co_return deltas;
 }
 
+std::optional<std::uint64_t> OpUserRepo::membershipVersion(const aid::ProjectId& project) {
+    std::scoped_lock lk{cacheMtx_};
+    if (auto it = versions_.find(project); it != versions_.end())
+        return it->second;
+    return std::nullopt;
+}
+
 } // namespace aid::adapters::openproject
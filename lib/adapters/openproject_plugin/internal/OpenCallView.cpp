@@ -0,0 +1,212 @@
+#include "aid/adapters/openproject/internal/OpenCallView.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace aid::adapters::openproject {
+
+namespace {
+
+bool isOpen(aid::TicketStatus s) {
+    return s == aid::TicketStatus::New || s == aid::TicketStatus::InProgress;
+}
+
+bool hasHandler(const aid::Ticket& t, const aid::UserHandle& viewer) {
+    return std::any_of(t.callHandlers.begin(), t.callHandlers.end(),
+                       [&viewer](const aid::UserHandle& h) { return h.v == viewer.v; });
+}
+
+} // namespace
+
+OpenCallView::OpenCallView(Clock clock) : clock_(std::move(clock)) {
+    if (!clock_)
+        clock_ = [] { return std::chrono::system_clock::now(); };
+}
+
+bool OpenCallView::fresh(aid::Timestamp seededAt, aid::Timestamp now) const {
+    return now - seededAt < kReconcileInterval;
+}
+
+void OpenCallView::pruneTombstones(aid::Timestamp now) {
+    std::erase_if(tombstones_, [this, now](const auto& kv) { return !fresh(kv.second.at, now); });
+}
+
+void OpenCallView::upsert(aid::Ticket t) {
+    if (auto tomb = tombstones_.find(t.id.v); tomb != tombstones_.end()) {
+        if (tomb->second.lockVersion >= t.lockVersion)
+            return;
+        tombstones_.erase(tomb); // reopened since it closed
+    }
+    auto it = rows_.find(t.id.v);
+    if (it != rows_.end() && it->second.ticket.lockVersion >= t.lockVersion)
+        return;
+    const std::string key = t.id.v;
+    rows_[key] = Row{std::move(t), ++version_};
+}
+
+void OpenCallView::apply(const aid::Ticket& t) {
+    std::scoped_lock lk{mtx_};
+    if (isOpen(t.status)) {
+        upsert(t);
+        return;
+    }
+    auto it = rows_.find(t.id.v);
+    if (it != rows_.end()) {
+        if (it->second.ticket.lockVersion > t.lockVersion)
+            return; // a stale read of a ticket since reopened
+        rows_.erase(it);
+    }
+    auto& tomb = tombstones_[t.id.v];
+    tomb.lockVersion = std::max(tomb.lockVersion, t.lockVersion);
+    tomb.at = clock_();
+    ++version_;
+}
+
+void OpenCallView::forget(const aid::TicketId& id) {
+    std::scoped_lock lk{mtx_};
+    if (rows_.erase(id.v) > 0)
+        ++version_;
+}
+
+std::uint64_t OpenCallView::version() {
+    std::scoped_lock lk{mtx_};
+    return version_;
+}
+
+std::vector<aid::ProjectId>
+OpenCallView::staleProjects(const std::vector<aid::ProjectId>& projects) {
+    std::scoped_lock lk{mtx_};
+    const aid::Timestamp now = clock_();
+    std::vector<aid::ProjectId> out;
+    for (const auto& p : projects) {
+        auto it = projectSeededAt_.find(p.v);
+        if (it == projectSeededAt_.end() || !fresh(it->second, now))
+            out.push_back(p);
+    }
+    return out;
+}
+
+void OpenCallView::seedProjects(const std::vector<aid::ProjectId>& projects,
+                                std::vector<aid::Ticket> open, std::uint64_t since) {
+    std::scoped_lock lk{mtx_};
+    const aid::Timestamp now = clock_();
+    pruneTombstones(now);
+
+    std::unordered_set<std::string> seeded;
+    for (const auto& p : projects)
+        seeded.insert(p.v);
+    std::unordered_set<std::string> listed;
+    for (auto& t : open) {
+        listed.insert(t.id.v);
+        upsert(std::move(t));
+    }
+    // A row of a seeded project the scan no longer returns has been closed,
+    // moved or retyped upstream — unless it was written after the scan began.
+    const auto dropped = std::erase_if(rows_, [&](const auto& kv) {
+        const Row& row = kv.second;
+        return seeded.count(row.ticket.projectId.v) > 0 && listed.count(kv.first) == 0 &&
+               row.touched <= since;
+    });
+    if (dropped > 0)
+        ++version_;
+    for (const auto& p : projects)
+        projectSeededAt_[p.v] = now;
+}
+
+bool OpenCallView::handlerStale(const aid::UserHandle& viewer) {
+    std::scoped_lock lk{mtx_};
+    auto it = handlerSeededAt_.find(viewer.v);
+    return it == handlerSeededAt_.end() || !fresh(it->second, clock_());
+}
+
+void OpenCallView::seedHandler(const aid::UserHandle& viewer, std::vector<aid::Ticket> open,
+                               std::uint64_t since) {
+    std::scoped_lock lk{mtx_};
+    const aid::Timestamp now = clock_();
+    pruneTombstones(now);
+
+    std::unordered_set<std::string> listed;
+    for (auto& t : open) {
+        listed.insert(t.id.v);
+        upsert(std::move(t));
+    }
+    // A row of a project with a current seed of its own is that seed's to
+    // drop; the handler scan only prunes the cross-project rest.
+    auto ownedByProjectSeed = [this, now](const aid::ProjectId& p) {
+        auto it = projectSeededAt_.find(p.v);
+        return it != projectSeededAt_.end() && fresh(it->second, now);
+    };
+    const auto dropped = std::erase_if(rows_, [&](const auto& kv) {
+        const Row& row = kv.second;
+        return hasHandler(row.ticket, viewer) && listed.count(kv.first) == 0 &&
+               row.touched <= since && !ownedByProjectSeed(row.ticket.projectId);
+    });
+    if (dropped > 0)
+        ++version_;
+    handlerSeededAt_[viewer.v] = now;
+}
+
+std::optional<std::vector<aid::ProjectId>>
+OpenCallView::projectsFor(const aid::UserHandle& viewer) {
+    std::scoped_lock lk{mtx_};
+    auto it = viewerProjects_.find(viewer.v);
+    if (it == viewerProjects_.end() || !fresh(it->second.at, clock_()))
+        return std::nullopt;
+    return it->second.projects;
+}
+
+void OpenCallView::rememberProjects(const aid::UserHandle& viewer,
+                                    std::vector<aid::ProjectId> projects) {
+    std::scoped_lock lk{mtx_};
+    viewerProjects_[viewer.v] = ViewerProjects{std::move(projects), clock_()};
+}
+
+void OpenCallView::forgetProjects() {
+    std::scoped_lock lk{mtx_};
+    viewerProjects_.clear();
+}
+
+OpenCallView::Selection OpenCallView::select(const aid::UserHandle& viewer,
+                                             const std::vector<aid::ProjectId>& projects) {
+    std::scoped_lock lk{mtx_};
+    std::unordered_set<std::string> member;
+    for (const auto& p : projects)
+        member.insert(p.v);
+
+    Selection out;
+    for (const auto& [id, row] : rows_) {
+        if (member.count(row.ticket.projectId.v) > 0 || hasHandler(row.ticket, viewer))
+            out.tickets.push_back(row.ticket);
+    }
+
+    // Stamp with the oldest seed the rows rest on: every member project's and
+    // the viewer's own handler scan.
+    std::optional<aid::Timestamp> oldest;
+    auto consider = [&oldest](aid::Timestamp at) {
+        if (!oldest || at < *oldest)
+            oldest = at;
+    };
+    for (const auto& p : projects) {
+        if (auto it = projectSeededAt_.find(p.v); it != projectSeededAt_.end())
+            consider(it->second);
+    }
+    if (auto it = handlerSeededAt_.find(viewer.v); it != handlerSeededAt_.end())
+        consider(it->second);
+    out.stamp = aid::DashboardStamp{version_, oldest.value_or(aid::Timestamp{})};
+    return out;
+}
+
+std::size_t OpenCallView::size() {
+    std::scoped_lock lk{mtx_};
+    return rows_.size();
+}
+
+} // namespace aid::adapters::openproject
@@ -1,6 +1,7 @@
 #include "aid/adapters/openproject/internal/ProducedLedger.h"
 
 #include <algorithm>
+#include <utility>
 
 namespace aid::adapters::openproject {
 
@@ -43,4 +44,44 @@ bool ProducedLedger::contains(const aid::TicketId& id, int version) {
     return hit;
 }
 
+ProducedLedger::PendingWrite::PendingWrite(ProducedLedger* ledger, std::optional<aid::TicketId> id)
+    : ledger_(ledger), id_(std::move(id)) {
+    if (ledger_ == nullptr)
+        return;
+    std::lock_guard lk{ledger_->mtx_};
+    if (id_)
+        ++ledger_->writesInFlight_[id_->v];
+    else
+        ++ledger_->createsInFlight_;
+}
+
+ProducedLedger::PendingWrite::~PendingWrite() {
+    if (ledger_ == nullptr)
+        return;
+    std::lock_guard lk{ledger_->mtx_};
+    if (!id_) {
+        --ledger_->createsInFlight_;
+        return;
+    }
+    auto it = ledger_->writesInFlight_.find(id_->v);
+    if (it != ledger_->writesInFlight_.end() && --it->second <= 0)
+        ledger_->writesInFlight_.erase(it);
+}
+
+bool ProducedLedger::writeInFlight(const aid::TicketId& id) {
+    std::lock_guard lk{mtx_};
+    return createsInFlight_ > 0 || writesInFlight_.count(id.v) > 0;
+}
+
+aid::plumbing::Task<bool> ProducedLedger::isEcho(aid::TicketId id, int version,
+                                                 Sleeper sleeper) {
+    bool echo = contains(id, version);
+    for (auto waited = std::chrono::milliseconds{0};
+         !echo && waited < kEchoGraceDelay && writeInFlight(id); waited += kEchoPollInterval) {
+        co_await sleeper(kEchoPollInterval);
+        echo = contains(id, version);
+    }
+    co_return echo;
+}
+
 } // namespace aid::adapters::openproject
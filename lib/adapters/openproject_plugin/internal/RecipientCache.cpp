@@ -0,0 +1,86 @@
+#include "aid/adapters/openproject/internal/RecipientCache.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace aid::adapters::openproject {
+
+std::string RecipientCache::extrasKey(const Entry& entry,
+                                      const std::vector<aid::UserHandle>& handlers) {
+    std::string key;
+    std::vector<const std::string*> seen;
+    for (const auto& h : handlers) {
+        if (entry.memberLogins.count(h.v) != 0)
+            continue;
+        if (std::any_of(seen.begin(), seen.end(), [&h](const std::string* s) { return *s == h.v; }))
+            continue;
+        seen.push_back(&h.v);
+        key.append(h.v);
+        key.push_back('\n');
+    }
+    return key;
+}
+
+RecipientCache::Recipients RecipientCache::lookup(const aid::ProjectId& project,
+                                                  std::uint64_t version,
+                                                  const std::vector<aid::UserHandle>& handlers) {
+    std::scoped_lock lk{mtx_};
+    const auto it = byProject_.find(project);
+    if (it == byProject_.end() || it->second.version != version)
+        return nullptr;
+    const auto set = it->second.byExtras.find(extrasKey(it->second, handlers));
+    if (set == it->second.byExtras.end())
+        return nullptr;
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return set->second;
+}
+
+RecipientCache::Recipients RecipientCache::rebuild(const aid::ProjectId& project,
+                                                   std::optional<std::uint64_t> version,
+                                                   const std::vector<aid::UserHandle>& members,
+                                                   const std::vector<aid::UserHandle>& handlers) {
+    rebuilds_.fetch_add(1, std::memory_order_relaxed);
+    Recipients built = std::make_shared<const std::vector<aid::UserHandle>>(unite(members, handlers));
+    if (!version)
+        return built; // membership not cached yet: nothing to stamp it with
+
+    std::scoped_lock lk{mtx_};
+    auto [it, inserted] = byProject_.try_emplace(project);
+    Entry& entry = it->second;
+    if (!inserted && entry.version > *version)
+        return built; // a newer membership already has the entry
+    if (inserted || entry.version < *version) {
+        entry = Entry{};
+        entry.version = *version;
+        entry.memberLogins.reserve(members.size());
+        for (const auto& m : members)
+            entry.memberLogins.insert(m.v);
+    } else if (entry.byExtras.size() >= kMaxSetsPerProject) {
+        entry.byExtras.clear();
+    }
+    entry.byExtras.insert_or_assign(extrasKey(entry, handlers), built);
+    return built;
+}
+
+std::vector<aid::UserHandle> RecipientCache::unite(const std::vector<aid::UserHandle>& members,
+                                                  const std::vector<aid::UserHandle>& handlers) {
+    std::vector<aid::UserHandle> out;
+    out.reserve(members.size() + handlers.size());
+    std::unordered_set<std::string> seen;
+    seen.reserve(members.size() + handlers.size());
+    for (const auto& m : members) {
+        if (seen.insert(m.v).second)
+            out.push_back(m);
+    }
+    for (const auto& h : handlers) {
+        if (seen.insert(h.v).second)
+            out.push_back(h);
+    }
+    return out;
+}
+
+RecipientCache::Stats RecipientCache::stats() const noexcept {
+    return Stats{hits_.load(std::memory_order_relaxed), rebuilds_.load(std::memory_order_relaxed)};
+}
+
+} // namespace aid::adapters::openproject
@@ -0,0 +1,63 @@
+#include "aid/adapters/openproject/internal/TicketCache.h"
+
+#include <algorithm>
+
+namespace aid::adapters::openproject {
+
+void TicketCache::evictIfOverCapacity(std::chrono::steady_clock::time_point now) {
+    if (byTicket_.size() <= kMaxTickets)
+        return;
+    std::erase_if(byTicket_, [now](const auto& kv) { return kv.second.expiresAt <= now; });
+    while (byTicket_.size() > kMaxTickets) {
+        auto victim =
+            std::min_element(byTicket_.begin(), byTicket_.end(), [](const auto& a, const auto& b) {
+                return a.second.expiresAt < b.second.expiresAt;
+            });
+        if (victim == byTicket_.end())
+            break;
+        byTicket_.erase(victim);
+    }
+}
+
+void TicketCache::record(const aid::Ticket& t) {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard lk{mtx_};
+    auto it = byTicket_.find(t.id.v);
+    if (it != byTicket_.end() && it->second.expiresAt > now &&
+        it->second.ticket.lockVersion > t.lockVersion)
+        return; // a slower read of an older version
+    byTicket_[t.id.v] = Entry{t, now + kTtl};
+    evictIfOverCapacity(now);
+}
+
+std::optional<aid::Ticket> TicketCache::lookup(const aid::TicketId& id) {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard lk{mtx_};
+    auto it = byTicket_.find(id.v);
+    if (it == byTicket_.end())
+        return std::nullopt;
+    if (it->second.expiresAt <= now) {
+        byTicket_.erase(it);
+        return std::nullopt;
+    }
+    return it->second.ticket;
+}
+
+void TicketCache::invalidateBelow(const aid::TicketId& id, int lockVersion) {
+    std::lock_guard lk{mtx_};
+    auto it = byTicket_.find(id.v);
+    if (it != byTicket_.end() && it->second.ticket.lockVersion < lockVersion)
+        byTicket_.erase(it);
+}
+
+void TicketCache::forget(const aid::TicketId& id) {
+    std::lock_guard lk{mtx_};
+    byTicket_.erase(id.v);
+}
+
+std::size_t TicketCache::size() {
+    std::lock_guard lk{mtx_};
+    return byTicket_.size();
+}
+
+} // namespace aid::adapters::openproject
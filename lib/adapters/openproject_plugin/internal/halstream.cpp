@@ -0,0 +1,238 @@
+#include "aid/adapters/openproject/internal/halstream.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "aid/plumbing/Error.h"
+
+using aid::plumbing::Error;
+using aid::plumbing::ErrorCode;
+using aid::plumbing::Result;
+using aid::plumbing::unexpected;
+
+namespace aid::adapters::openproject {
+
+namespace {
+
+bool listed(const std::vector<std::string>& names, const std::string& name) {
+    return std::find(names.begin(), names.end(), name) != names.end();
+}
+
+// nlohmann SAX handler. Tracks where in the envelope it is with a small frame
+// stack; inside an element it rebuilds the kept keys into `element_` through
+// `build_` (the chain of open containers). A value whose key was not wanted is
+// skipped by counting its nesting depth down to zero, without building it.
+class CollectionSax {
+public:
+    CollectionSax(const HalElementFields& fields, const HalElementSink& sink)
+        : fields_(fields), sink_(sink) {}
+
+    bool null() { return scalar(nlohmann::json(nullptr)); }
+    bool boolean(bool v) { return scalar(nlohmann::json(v)); }
+    bool number_integer(nlohmann::json::number_integer_t v) { return scalar(nlohmann::json(v)); }
+    bool number_unsigned(nlohmann::json::number_unsigned_t v) {
+        return scalar(nlohmann::json(v));
+    }
+    bool number_float(nlohmann::json::number_float_t v, const nlohmann::json::string_t& /*raw*/) {
+        return scalar(nlohmann::json(v));
+    }
+    bool string(nlohmann::json::string_t& v) { return scalar(nlohmann::json(std::move(v))); }
+    // JSON text never produces binary values; present only to satisfy the
+    // SAX interface.
+    bool binary(nlohmann::json::binary_t& /*v*/) { return scalar(nlohmann::json()); }
+
+    bool start_object(std::size_t /*elements*/) { return open(nlohmann::json::object()); }
+    bool start_array(std::size_t /*elements*/) { return open(nlohmann::json::array()); }
+    bool end_object() { return close(); }
+    bool end_array() { return close(); }
+
+    bool key(nlohmann::json::string_t& k) {
+        if (skipDepth_ > 0)
+            return true;
+        switch (frames_.back()) {
+        case Frame::Root:
+            skipNext_ = k != "total" && k != "_embedded";
+            break;
+        case Frame::Embedded:
+            skipNext_ = k != "elements";
+            break;
+        case Frame::Build:
+            if (build_.size() == 1) {
+                skipNext_ = !listed(fields_.attributes, k);
+                elementKey_ = k;
+            } else if (build_.size() == 2 && (elementKey_ == "_links" || elementKey_ == "_embedded")) {
+                skipNext_ = !listed(fields_.relations, k);
+            } else {
+                skipNext_ = false;
+            }
+            break;
+        case Frame::Elements:
+            break;
+        }
+        key_ = std::move(k);
+        return true;
+    }
+
+    bool parse_error(std::size_t /*position*/, const std::string& /*lastToken*/,
+                     const nlohmann::json::exception& e) {
+        error_ = Error{ErrorCode::Unknown,
+                       std::string{"HAL collection is not valid JSON: "} + e.what(),
+                       std::nullopt};
+        return false;
+    }
+
+    [[nodiscard]] const std::optional<Error>& error() const noexcept { return error_; }
+    [[nodiscard]] const HalCollectionPage& page() const noexcept { return page_; }
+
+private:
+    enum class Frame { Root, Embedded, Elements, Build };
+
+    bool scalar(nlohmann::json v) {
+        if (skipDepth_ > 0)
+            return true;
+        if (skipNext_) {
+            skipNext_ = false;
+            return true;
+        }
+        if (frames_.empty())
+            return true; // a bare scalar body: no collection, no elements
+        switch (frames_.back()) {
+        case Frame::Root:
+            if (key_ == "total" && v.is_number())
+                page_.total = v.get<long long>();
+            return true;
+        case Frame::Embedded:
+            return true;
+        case Frame::Elements:
+            // Not an object; hand it over so the element parser rejects it
+            // exactly as it would from the DOM.
+            return emit(std::move(v));
+        case Frame::Build:
+            place(std::move(v));
+            return true;
+        }
+        return true;
+    }
+
+    bool open(nlohmann::json container) {
+        if (skipDepth_ > 0) {
+            ++skipDepth_;
+            return true;
+        }
+        if (skipNext_) {
+            skipNext_ = false;
+            skipDepth_ = 1;
+            return true;
+        }
+        if (frames_.empty()) {
+            if (!container.is_object()) {
+                skipDepth_ = 1; // a top-level array is not a collection
+                return true;
+            }
+            frames_.push_back(Frame::Root);
+            return true;
+        }
+        switch (frames_.back()) {
+        case Frame::Root:
+            if (!container.is_object()) {
+                skipDepth_ = 1;
+                return true;
+            }
+            frames_.push_back(Frame::Embedded);
+            return true;
+        case Frame::Embedded:
+            if (!container.is_array()) {
+                skipDepth_ = 1;
+                return true;
+            }
+            frames_.push_back(Frame::Elements);
+            return true;
+        case Frame::Elements:
+            element_ = std::move(container);
+            build_.push_back(&element_);
+            frames_.push_back(Frame::Build);
+            return true;
+        case Frame::Build:
+            build_.push_back(place(std::move(container)));
+            frames_.push_back(Frame::Build);
+            return true;
+        }
+        return true;
+    }
+
+    bool close() {
+        if (skipDepth_ > 0) {
+            --skipDepth_;
+            return true;
+        }
+        const Frame f = frames_.back();
+        frames_.pop_back();
+        if (f != Frame::Build)
+            return true;
+        build_.pop_back();
+        if (!build_.empty())
+            return true;
+        return emit(std::move(element_));
+    }
+
+    // Store `v` under the pending key (or append it) in the innermost open
+    // container, returning where it landed.
+    nlohmann::json* place(nlohmann::json v) {
+        nlohmann::json& parent = *build_.back();
+        if (parent.is_array()) {
+            parent.push_back(std::move(v));
+            return &parent.back();
+        }
+        nlohmann::json& slot = parent[key_];
+        slot = std::move(v);
+        return &slot;
+    }
+
+    bool emit(nlohmann::json element) {
+        ++page_.elements;
+        auto r = sink_(std::move(element));
+        if (!r) {
+            error_ = std::move(r.error());
+            return false;
+        }
+        return true;
+    }
+
+    const HalElementFields& fields_;
+    const HalElementSink& sink_;
+    std::vector<Frame> frames_;
+    std::vector<nlohmann::json*> build_;
+    nlohmann::json element_;
+    std::string key_;
+    std::string elementKey_;
+    std::size_t skipDepth_{0};
+    bool skipNext_{false};
+    HalCollectionPage page_;
+    std::optional<Error> error_;
+};
+
+} // namespace
+
+Result<HalCollectionPage> streamHalCollection(std::string_view body,
+                                              const HalElementFields& fields,
+                                              const HalElementSink& sink) {
+    if (body.empty())
+        return HalCollectionPage{};
+    CollectionSax sax{fields, sink};
+    const bool ok = nlohmann::json::sax_parse(body.begin(), body.end(), &sax);
+    if (!ok) {
+        if (sax.error())
+            return unexpected(*sax.error());
+        return unexpected(
+            Error{ErrorCode::Unknown, "HAL collection is not valid JSON", std::nullopt});
+    }
+    return sax.page();
+}
+
+} // namespace aid::adapters::openproject
@@ -1,5 +1,6 @@
 #include "aid/adapters/openproject/internal/payload.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <ctime>
@@ -22,15 +23,6 @@ using aid::plumbing::unexpected;
 
 namespace aid::adapters::openproject {
 
-namespace {
-
-Error makeInvalid(std::string msg) {
-    return Error{ErrorCode::InvalidInput, std::move(msg), std::nullopt};
-}
-
-// Parse OpenProject's ISO-8601 "YYYY-MM-DDTHH:MM:SSZ" or with fractional
-// seconds (e.g. "2024-01-15T10:30:00.000Z"). Returns nullopt on any parse
-// failure. We deliberately parse to UTC; OpenProject always serializes UTC.
 std::optional<aid::Timestamp> parseIso8601Utc(std::string_view s) {
     if (s.empty())
         return std::nullopt;
@@ -57,6 +49,12 @@ std::optional<aid::Timestamp> parseIso8601Utc(std::string_view s) {
     return std::chrono::system_clock::from_time_t(tt);
 }
 
+namespace {
+
+Error makeInvalid(std::string msg) {
+    return Error{ErrorCode::InvalidInput, std::move(msg), std::nullopt};
+}
+
 // Parse a custom-field timestamp. OpenProject is inconsistent here:
 // some installs serve callStart/callEnd as full ISO-8601
 // ("2024-01-15T10:30:00Z", UTC with a 'Z'), others as the plain
@@ -346,6 +344,50 @@ Result<aid::Ticket> parseFromHal(const nlohmann::json& hal, const CustomFieldMap
     return out;
 }
 
+namespace {
+
+// The element keys parseFromHal reads under `projection`. Attributes and
+// custom fields are plain keys; `project`, `status` and `assignee` are
+// relations (their _links entries, and _embedded.assignee).
+std::vector<std::string> consumedKeys(const CustomFieldMap& fields, HalProjection projection) {
+    std::vector<std::string> keys{"id",      "subject", "lockVersion", "updatedAt",
+                                  "project", "status",  "assignee"};
+    keys.push_back(customFieldName(fields.callId));
+    keys.push_back(customFieldName(fields.callerNumber));
+    keys.push_back(customFieldName(fields.calledNumber));
+    keys.push_back(customFieldName(fields.callStart));
+    keys.push_back(customFieldName(fields.callEnd));
+    keys.push_back(customFieldName(fields.callHandler));
+    if (projection == HalProjection::Listing) {
+        keys.emplace_back("description");
+        keys.push_back(customFieldName(fields.callLength));
+    }
+    return keys;
+}
+
+} // namespace
+
+std::string workPackageSelect(const CustomFieldMap& fields, HalProjection projection) {
+    std::string out = "total,count";
+    for (const auto& k : consumedKeys(fields, projection)) {
+        out.append(",elements/");
+        out.append(k);
+    }
+    return out;
+}
+
+HalElementFields workPackageFields(const CustomFieldMap& fields) {
+    HalElementFields out;
+    out.relations = {"project", "status", "assignee"};
+    for (auto& k : consumedKeys(fields, HalProjection::Listing)) {
+        if (std::find(out.relations.begin(), out.relations.end(), k) == out.relations.end())
+            out.attributes.push_back(std::move(k));
+    }
+    out.attributes.emplace_back("_links");
+    out.attributes.emplace_back("_embedded");
+    return out;
+}
+
 nlohmann::json toCreatePayload(const aid::NewTicket& nt, const CustomFieldMap& fields,
                                const OpStatusMap& statusMap,
                                const aid::crosscutting::TicketSystemConfig& cfg,
@@ -1,8 +1,11 @@
 #include "aid/adapters/ws/WsHubAdapter.h"
 
+#include <algorithm>
+#include <iterator>
 #include <nlohmann/json.hpp>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "aid/crosscutting/Logger.h"
 #include "aid/serialization/ActionResultJson.h"
@@ -30,7 +33,7 @@ std::string makeActionResultPayload(const aid::plumbing::ActionResult& r) {
     return j.dump();
 }
 
-std::string makeTicketUpsertPayload(const aid::DashboardEntry& entry) {
+nlohmann::json makeTicketUpsertFrame(const aid::DashboardEntry& entry) {
     nlohmann::json j;
     j["type"] = "ticket_upsert";
     j["entry"] = aid::serialization::toJson(entry);
@@ -38,7 +41,11 @@ std::string makeTicketUpsertPayload(const aid::DashboardEntry& entry) {
     // byte-identical to the REST projection) so a viewer can drop a frame that
     // lost a race with a newer one for the same ticket.
     j["lockVersion"] = entry.lockVersion;
-    return j.dump();
+    return j;
+}
+
+std::string makeTicketUpsertPayload(const aid::DashboardEntry& entry) {
+    return makeTicketUpsertFrame(entry).dump();
 }
 
 std::string makeTicketRemovePayload(const aid::TicketId& ticketId, int lockVersion) {
@@ -143,6 +150,28 @@ void WsHubAdapter::pushTicketUpsert(aid::UserHandle user, const aid::DashboardEn
     sendToUser(user, makeTicketUpsertPayload(entry));
 }
 
+void WsHubAdapter::pushTicketUpserts(const aid::SharedDashboardEntry& shared) {
+    // Most recipients hold no call on the ticket and so share one overlay
+    // (activeCallForViewer null, otherActiveUsers = everyone on a call); each
+    // distinct overlay is dumped once. The frame is pushTicketUpsert's, built
+    // from the shared entry with the overlay keys rewritten in place.
+    auto frame = makeTicketUpsertFrame(shared.entry);
+
+    std::vector<std::pair<const aid::ViewerOverlay*, std::string>> payloads;
+    for (const auto& overlay : shared.viewers) {
+        auto it = std::find_if(payloads.begin(), payloads.end(), [&overlay](const auto& p) {
+            return p.first->activeCallForViewer == overlay.activeCallForViewer &&
+                   p.first->otherActiveUsers == overlay.otherActiveUsers;
+        });
+        if (it == payloads.end()) {
+            aid::serialization::applyOverlay(frame["entry"], overlay);
+            payloads.emplace_back(&overlay, frame.dump());
+            it = std::prev(payloads.end());
+        }
+        sendToUser(overlay.viewer, it->second);
+    }
+}
+
 void WsHubAdapter::pushTicketRemove(aid::UserHandle user, aid::TicketId ticketId, int lockVersion) {
     sendToUser(user, makeTicketRemovePayload(ticketId, lockVersion));
 }
@@ -0,0 +1,39 @@
+#include "aid/controllers/AdminController.h"
+
+#include <drogon/HttpTypes.h>
+
+#include <utility>
+
+#include "aid/crosscutting/Logger.h"
+#include "aid/ports/AddressBook.h"
+
+namespace aid::controllers {
+
+AdminController::AdminController(aid::ports::AddressBook& addressBook,
+                                 aid::crosscutting::Logger& logger)
+    : addressBook_(addressBook), logger_(logger) {
+}
+
+void AdminController::postContactsFlush(
+    const drogon::HttpRequestPtr& req,
+    std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
+    postContactsFlush(req->peerAddr(), std::move(callback));
+}
+
+void AdminController::postContactsFlush(
+    const trantor::InetAddress& peer,
+    std::function<void(const drogon::HttpResponsePtr&)>&& callback) {
+    auto resp = drogon::HttpResponse::newHttpResponse();
+    if (!peer.isLoopbackIp()) {
+        logger_.warn("AdminController: rejected /admin/contacts/flush from " + peer.toIp());
+        resp->setStatusCode(drogon::k403Forbidden);
+        callback(resp);
+        return;
+    }
+    addressBook_.flushContactCache();
+    logger_.info("contact cache flushed");
+    resp->setStatusCode(drogon::k204NoContent);
+    callback(resp);
+}
+
+} // namespace aid::controllers
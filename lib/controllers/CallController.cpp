@@ -128,8 +128,8 @@ std::optional<aid::CallEvent> CallController::decodeJson(std::string_view body)
 
 CallController::CallController(aid::infrastructure::Wal& wal, aid::infrastructure::Mailbox& mailbox,
                                aid::crosscutting::Logger& logger,
-                               aid::crosscutting::CorrelationId& cid)
-    : wal_(wal), mailbox_(mailbox), logger_(logger), cid_(cid) {
+                               aid::crosscutting::CorrelationId& cid, Prefetch prefetch)
+    : wal_(wal), mailbox_(mailbox), logger_(logger), cid_(cid), prefetch_(std::move(prefetch)) {
 }
 
 void CallController::handlePost(const drogon::HttpRequestPtr& req,
@@ -156,6 +156,13 @@ void CallController::handlePost(const drogon::HttpRequestPtr& req,
         return;
     }
 
+    // Before enqueue, so that on an idle mailbox the prefetch is queued on
+    // the domain loop ahead of the worker that consumes it. A 503 below
+    // leaves its reads unused; they expire with the prefetch TTL.
+    if (prefetch_) {
+        prefetch_(*eventOpt);
+    }
+
     const auto callid = aid::callidOf(*eventOpt);
     auto enq = mailbox_.enqueue(callid, std::move(*eventOpt), cidStr, *seqRes);
     if (!enq) {
@@ -28,6 +28,7 @@ drogon::HttpStatusCode httpStatusForError(aid::plumbing::ErrorCode code) noexcep
         // a 502, not a fault in this service.
         return drogon::k502BadGateway;
     case ErrorCode::UpstreamTimeout:
+    case ErrorCode::DeadlineExceeded:
         return drogon::k504GatewayTimeout;
     case ErrorCode::WalWriteFailed:
     case ErrorCode::WalSyncFailed:
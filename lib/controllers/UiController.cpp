@@ -27,6 +27,7 @@
 #include "aid/usecases/GetDashboard.h"
 #include "aid/value-types/Dashboard.h"
 #include "aid/value-types/Ids.h"
+#include "aid/value-types/TimeFormat.h"
 
 namespace aid::controllers {
 
@@ -101,6 +102,13 @@ void respondOnLoop(trantor::EventLoop* loop,
     return j;
 }
 
+[[nodiscard]] nlohmann::json toJson(const aid::DashboardStamp& s) {
+    nlohmann::json j;
+    j["version"] = s.version;
+    j["reconciledAt"] = aid::formatIso8601Utc(s.reconciledAt);
+    return j;
+}
+
 [[nodiscard]] nlohmann::json toJson(const aid::DashboardView& v) {
     nlohmann::json j;
     auto tickets = nlohmann::json::array();
@@ -118,6 +126,11 @@ void respondOnLoop(trantor::EventLoop* loop,
     } else {
         j["addressCallInformation"] = nullptr;
     }
+    if (v.stamp.has_value()) {
+        j["stamp"] = toJson(*v.stamp);
+    } else {
+        j["stamp"] = nullptr;
+    }
     return j;
 }
 
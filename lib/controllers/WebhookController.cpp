@@ -1,6 +1,7 @@
 #include "aid/controllers/WebhookController.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <nlohmann/json.hpp>
 #include <string>
@@ -39,6 +40,96 @@ bool constantTimeEquals(std::string_view a, std::string_view b) {
     return diff == 0;
 }
 
+// SAX handler behind lockVersionOf: tracks the nesting depth and records the
+// lockVersion of the top-level object or of its "work_package" object, aborting
+// the parse once the envelope's one is seen.
+class LockVersionScan : public nlohmann::json_sax<nlohmann::json> {
+public:
+    std::optional<std::int64_t> bare;
+    std::optional<std::int64_t> enveloped;
+
+    bool null() override {
+        return skipValue();
+    }
+    bool boolean(bool /*val*/) override {
+        return skipValue();
+    }
+    bool number_integer(number_integer_t val) override {
+        return take(static_cast<std::int64_t>(val));
+    }
+    bool number_unsigned(number_unsigned_t val) override {
+        return take(static_cast<std::int64_t>(val));
+    }
+    bool number_float(number_float_t /*val*/, const string_t& /*s*/) override {
+        return skipValue();
+    }
+    bool string(string_t& /*val*/) override {
+        return skipValue();
+    }
+    bool binary(binary_t& /*val*/) override {
+        return skipValue();
+    }
+    bool start_object(std::size_t /*elements*/) override {
+        inWorkPackage_ = inWorkPackage_ || (depth_ == 1 && key_ == Key::WorkPackage);
+        key_ = Key::Other;
+        ++depth_;
+        return true;
+    }
+    bool end_object() override {
+        --depth_;
+        if (depth_ == 1) {
+            inWorkPackage_ = false;
+        }
+        return true;
+    }
+    bool start_array(std::size_t /*elements*/) override {
+        key_ = Key::Other;
+        ++depth_;
+        return true;
+    }
+    bool end_array() override {
+        --depth_;
+        return true;
+    }
+    bool key(string_t& val) override {
+        if (val == "lockVersion") {
+            key_ = Key::LockVersion;
+        } else if (val == "work_package") {
+            key_ = Key::WorkPackage;
+        } else {
+            key_ = Key::Other;
+        }
+        return true;
+    }
+    bool parse_error(std::size_t /*position*/, const std::string& /*last_token*/,
+                     const nlohmann::detail::exception& /*ex*/) override {
+        return false;
+    }
+
+private:
+    enum class Key { Other, LockVersion, WorkPackage };
+
+    bool skipValue() {
+        key_ = Key::Other;
+        return true;
+    }
+    bool take(std::int64_t val) {
+        if (key_ == Key::LockVersion) {
+            if (depth_ == 1 && !bare) {
+                bare = val;
+            } else if (depth_ == 2 && inWorkPackage_) {
+                enveloped = val;
+                return false; // the envelope's value wins: done
+            }
+        }
+        return skipValue();
+    }
+
+    int depth_{0};
+    bool inWorkPackage_{false};
+    Key key_{Key::Other};
+};
+
 } // namespace
 
 std::optional<aid::TicketId> WebhookController::ticketIdOf(std::string_view body) {
@@ -73,6 +164,12 @@ std::optional<aid::TicketId> WebhookController::ticketIdOf(std::string_view body
     return std::nullopt;
 }
 
+std::optional<std::int64_t> WebhookController::lockVersionOf(std::string_view body) {
+    LockVersionScan scan;
+    (void)nlohmann::json::sax_parse(body, &scan);
+    return scan.enveloped ? scan.enveloped : scan.bare;
+}
+
 WebhookController::WebhookController(aid::infrastructure::Wal& wal,
                                      aid::infrastructure::WebhookMailbox& mailbox,
                                      aid::crosscutting::Logger& logger,
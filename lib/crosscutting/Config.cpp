@@ -407,6 +407,41 @@ Result<std::optional<WebhookConfig>> Config::webhook() const {
     return std::optional<WebhookConfig>{std::move(out)};
 }
 
+Result<EventBudgetsConfig> Config::eventBudgets() const {
+    assert(impl_ && "Config::eventBudgets() called on a moved-from instance");
+    EventBudgetsConfig out; // all 0 — unbudgeted.
+
+    const auto* section = find(impl_->root, "EventBudgets");
+    if (section == nullptr) {
+        return out;
+    }
+    if (!section->is_object()) {
+        return unexpected(makeError("config: EventBudgets section is not an object"));
+    }
+
+    const std::pair<std::string_view, int*> fields[] = {
+        {"incomingMs", &out.incomingMs}, {"outgoingMs", &out.outgoingMs},
+        {"acceptedMs", &out.acceptedMs}, {"transferMs", &out.transferMs},
+        {"hangupMs", &out.hangupMs},     {"webhookMs", &out.webhookMs},
+    };
+    for (const auto& [key, dst] : fields) {
+        const auto* node = find(*section, key);
+        if (node == nullptr) {
+            continue;
+        }
+        auto v = readInt(*node, "EventBudgets", key);
+        if (!v)
+            return unexpected(v.error());
+        if (*v < 0) {
+            std::ostringstream msg;
+            msg << "config: EventBudgets." << key << " must be >= 0 (0 = unbudgeted)";
+            return unexpected(makeError(msg.str()));
+        }
+        *dst = *v;
+    }
+    return out;
+}
+
 Result<std::string> Config::lanInterface() const {
     assert(impl_ && "Config::lanInterface() called on a moved-from instance");
     const auto* node = find(impl_->root, "lanInterface");
@@ -471,6 +506,26 @@ Result<int> Config::membershipPollIntervalSec() const {
     return secs < kFloor ? kFloor : static_cast<int>(secs);
 }
 
+Result<int> Config::callPrefetchMs() const {
+    assert(impl_ && "Config::callPrefetchMs() called on a moved-from instance");
+    const auto* node = find(impl_->root, "callPrefetchMs");
+    // Optional: absent → off.
+    if (node == nullptr) {
+        return 0;
+    }
+    if (!node->is_number_integer()) {
+        return unexpected(makeError("config: top-level callPrefetchMs must be an integer"));
+    }
+    const auto ms = node->get<std::int64_t>();
+    if (ms < 0) {
+        return unexpected(makeError("config: top-level callPrefetchMs must be >= 0 (0 disables)"));
+    }
+    if (ms > INT_MAX) {
+        return unexpected(makeError("config: top-level callPrefetchMs is out of int range"));
+    }
+    return static_cast<int>(ms);
+}
+
 Result<std::filesystem::path> Config::walPath() const {
     assert(impl_ && "Config::walPath() called on a moved-from instance");
     const auto* node = find(impl_->root, "walPath");
@@ -185,6 +185,25 @@ std::vector<UserHandle> CallLineFormatter::findUsersWithOpenCalls(std::string_vi
     return users;
 }
 
+std::vector<std::string_view> CallLineFormatter::findOpenLines(std::string_view description) {
+    std::vector<std::string_view> lines;
+    std::size_t pos = 0;
+    while (pos <= description.size()) {
+        const auto eol = description.find('\n', pos);
+        const std::size_t end = (eol == std::string_view::npos) ? description.size() : eol;
+        const auto line = description.substr(pos, end - pos);
+        if (line.find(CALL_START_PATTERN) != std::string_view::npos &&
+            line.find("Call End:") == std::string_view::npos) {
+            lines.push_back(line);
+        }
+        if (eol == std::string_view::npos) {
+            break;
+        }
+        pos = end + 1;
+    }
+    return lines;
+}
+
 bool CallLineFormatter::hasLine(std::string_view description, const UserHandle& user,
                                 const CallId& callid) {
     const std::string needle1 = user.v + ": Call start: ";
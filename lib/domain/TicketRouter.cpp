@@ -3,12 +3,12 @@
 namespace aid::domain {
 
 TicketRouter::RoutingDecision TicketRouter::decideKnown(const KnownInput& in) {
-    for (const auto& cand : in.perProject) {
-        if (cand.latestOpenCallTicket.has_value()) {
-            return ReuseExisting{cand.latestOpenCallTicket->id};
+    for (const auto& latest : in.latestOpenPerProject) {
+        if (latest.has_value()) {
+            return ReuseExisting{latest->id};
         }
     }
-    return CreateInProject{in.perProject.front().project};
+    return CreateInProject{in.projects.front()};
 }
 
 TicketRouter::RoutingDecision TicketRouter::decideUnknown(const UnknownInput& in) {
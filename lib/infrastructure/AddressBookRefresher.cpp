@@ -0,0 +1,112 @@
+#include "aid/infrastructure/AddressBookRefresher.h"
+
+#include <drogon/HttpAppFramework.h>
+#include <drogon/utils/coroutine.h>
+#include <trantor/net/EventLoop.h>
+
+#include <exception>
+#include <future>
+#include <string>
+#include <thread>
+
+#include "aid/crosscutting/Logger.h"
+#include "aid/ports/AddressBook.h"
+
+namespace aid::infrastructure {
+
+AddressBookRefresher::AddressBookRefresher(trantor::EventLoop& loop, aid::ports::AddressBook& ab,
+                                           aid::crosscutting::Logger& logger,
+                                           std::chrono::seconds interval) noexcept
+    : loop_(loop), ab_(ab), logger_(logger), interval_(interval) {
+}
+
+AddressBookRefresher::~AddressBookRefresher() {
+    // Backstop only — main() calls stop() while the domain loop is alive.
+    stop();
+}
+
+void AddressBookRefresher::start() {
+    kick();
+    // App-loop timer hopping onto the domain loop: a standalone
+    // trantor::EventLoop's runEvery fires only once (see MembershipReconciler).
+    timerLoop_ = drogon::app().getLoop();
+    timerId_ = timerLoop_->runEvery(static_cast<double>(interval_.count()),
+                                    [this]() { loop_.queueInLoop([this]() { launchRefresh(); }); });
+}
+
+void AddressBookRefresher::kick() {
+    if (stopped_.load(std::memory_order_acquire)) {
+        return;
+    }
+    loop_.queueInLoop([this]() { launchRefresh(); });
+}
+
+void AddressBookRefresher::stop() {
+    if (stopped_.exchange(true))
+        return;
+
+    // Cancel the timer on the app loop, unless that loop has already returned
+    // from run() (process teardown) — it fires nothing more then, and a
+    // queueInLoop + wait on it would block forever.
+    if (timerId_ != 0 && timerLoop_ != nullptr && timerLoop_->isRunning()) {
+        if (timerLoop_->isInLoopThread()) {
+            timerLoop_->invalidateTimer(timerId_);
+        } else {
+            std::promise<void> done;
+            auto fut = done.get_future();
+            timerLoop_->queueInLoop([this, &done]() {
+                timerLoop_->invalidateTimer(timerId_);
+                done.set_value();
+            });
+            fut.wait();
+        }
+    }
+
+    // Flush the domain loop so a launchRefresh hop already queued runs (and
+    // no-ops) before `this` goes away.
+    if (loop_.isRunning() && !loop_.isInLoopThread()) {
+        std::promise<void> flushed;
+        auto fut = flushed.get_future();
+        loop_.queueInLoop([&flushed]() { flushed.set_value(); });
+        fut.wait();
+    }
+
+    // Then wait out a refresh suspended in the plugin's HttpClient (bounded by
+    // the upstream timeout).
+    while (inFlight_.load(std::memory_order_acquire)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+}
+
+void AddressBookRefresher::launchRefresh() {
+    bool expected = false;
+    if (!inFlight_.compare_exchange_strong(expected, true)) {
+        return;
+    }
+    if (stopped_.load(std::memory_order_acquire)) {
+        inFlight_.store(false, std::memory_order_release);
+        return;
+    }
+
+    // Detached drogon::AsyncTask, as in MembershipReconciler::launchTick; the
+    // try/catch is mandatory because Drogon swallows exceptions thrown on a
+    // detached coroutine.
+    [](AddressBookRefresher* self) -> drogon::AsyncTask {
+        try {
+            // A failure leaves the plugin's copy as it was (or cold, so lookups
+            // keep going upstream); the next tick retries.
+            if (auto r = co_await self->ab_.refreshContacts(); !r) {
+                self->logger_.warn("AddressBookRefresher: refreshContacts failed: " +
+                                   r.error().message);
+            }
+        } catch (const std::exception& e) {
+            self->logger_.error(std::string{"AddressBookRefresher refresh threw: "} + e.what());
+        } catch (...) {
+            self->logger_.error("AddressBookRefresher refresh threw unknown");
+        }
+        self->inFlight_.store(false, std::memory_order_release);
+        co_return;
+    }(this);
+}
+
+} // namespace aid::infrastructure
@@ -13,6 +13,7 @@
 #include <chrono>
 #include <coroutine>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
@@ -23,6 +24,7 @@
 #include <utility>
 #include <vector>
 
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Error.h"
 #include "aid/plumbing/Result.h"
 #include "aid/plumbing/Task.h"
@@ -41,12 +43,18 @@ constexpr std::array<std::chrono::milliseconds, 3> kBackoff{50ms, 100ms, 200ms};
 struct SleepAwaiter {
     trantor::EventLoop& loop;
     std::chrono::milliseconds dur;
+    // Reinstalled around the resume so the caller chain keeps its budget
+    // (see plumbing/Deadline.h).
+    std::optional<aid::plumbing::Deadline> deadline;
 
     [[nodiscard]] bool await_ready() const noexcept { return dur.count() <= 0; }
 
     void await_suspend(std::coroutine_handle<> h) const noexcept {
         const double secs = static_cast<double>(dur.count()) / 1000.0;
-        loop.runAfter(secs, [h]() noexcept { h.resume(); });
+        loop.runAfter(secs, [h, d = deadline]() noexcept {
+            const aid::plumbing::DeadlineScope scope{d};
+            h.resume();
+        });
     }
 
     void await_resume() const noexcept {}
@@ -149,6 +157,10 @@ struct HttpReqControl {
     drogon::ReqResult rc{drogon::ReqResult::Ok};
     drogon::HttpResponsePtr resp{};
     bool cancelled{false};
+    // The event budget the request was issued under. Whoever wins `settled`
+    // reinstalls it around the resume, so every request the resumed chain
+    // issues next is clamped to the same budget (plumbing/Deadline.h).
+    std::optional<aid::plumbing::Deadline> deadline{};
 };
 
 // Registry of in-flight requests for one HttpClient, plus a sticky cancelled
@@ -190,6 +202,7 @@ public:
                     return; // drogon's completion callback already resumed it
                 }
                 c->cancelled = true;
+                const aid::plumbing::DeadlineScope scope{c->deadline};
                 c->handle.resume();
             });
         }
@@ -214,9 +227,12 @@ namespace {
 class HttpRequestAwaiter {
 public:
     HttpRequestAwaiter(std::shared_ptr<HttpCancelStation> station, drogon::HttpClientPtr client,
-                       drogon::HttpRequestPtr req, double timeout)
+                       drogon::HttpRequestPtr req, double timeout,
+                       std::optional<aid::plumbing::Deadline> deadline)
         : station_(std::move(station)), client_(std::move(client)), req_(std::move(req)),
-          timeout_(timeout), ctl_(std::make_shared<HttpReqControl>()) {}
+          timeout_(timeout), ctl_(std::make_shared<HttpReqControl>()) {
+        ctl_->deadline = deadline;
+    }
 
     [[nodiscard]] bool await_ready() const noexcept { return false; }
 
@@ -236,6 +252,7 @@ public:
                 }
                 ctl->rc = rc;
                 ctl->resp = resp;
+                const aid::plumbing::DeadlineScope scope{ctl->deadline};
                 ctl->handle.resume();
             },
             timeout_);
@@ -292,7 +309,25 @@ HttpClient::send(std::string method, std::string path, std::string_view body, co
 
     const int attempts = std::max(1, cfg_.networkRetries);
     auto req = buildRequest(m, path, body, hdrs);
-    const double timeoutSec = static_cast<double>(cfg_.readTimeout.count());
+    const auto readTimeout =
+        std::chrono::duration_cast<std::chrono::milliseconds>(cfg_.readTimeout);
+
+    // The event budget in scope when this send() started — read here, on the
+    // synchronous path, before the first suspension (plumbing/Deadline.h).
+    // Every attempt's drogon timeout is clamped to what is left of it, and a
+    // backoff that would outlast it is not slept. nullopt = unbudgeted: the
+    // plain readTimeout × networkRetries policy, exactly as before.
+    const std::optional<aid::plumbing::Deadline> deadline = aid::plumbing::currentDeadline();
+    auto deadlineExceeded = [&method, &path](int attemptsMade) {
+        std::string msg = "http ";
+        msg.append(method);
+        msg.push_back(' ');
+        msg.append(path);
+        msg.append(": event deadline exceeded after ");
+        msg.append(std::to_string(attemptsMade));
+        msg.append(attemptsMade == 1 ? " attempt" : " attempts");
+        return Error{ErrorCode::DeadlineExceeded, std::move(msg), std::nullopt};
+    };
 
     // Fresh drogon client per send() call — never a persistent, shared one.
     // A reused client carries the previous request's connection: if the server
@@ -326,7 +361,27 @@ HttpClient::send(std::string method, std::string path, std::string_view body, co
                                                       std::nullopt}};
         }
 
-        auto ctl = co_await detail::HttpRequestAwaiter{station, client, req, timeoutSec};
+        // Clamp this attempt to the remaining budget. `clamped` remembers
+        // whether the budget (not readTimeout) bounds it, so a drogon Timeout
+        // below is reported as the distinct DeadlineExceeded and not retried.
+        std::chrono::milliseconds attemptTimeout = readTimeout;
+        bool clamped = false;
+        if (deadline) {
+            const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                *deadline - aid::plumbing::DeadlineClock::now());
+            if (left.count() <= 0) {
+                co_return aid::plumbing::unexpected{deadlineExceeded(attempt)};
+            }
+            if (left < attemptTimeout) {
+                attemptTimeout = left;
+                clamped = true;
+            }
+        }
+        // drogon reads a 0 timeout as "none", so never hand it less than 1 ms.
+        const double timeoutSec =
+            static_cast<double>(std::max<std::int64_t>(attemptTimeout.count(), 1)) / 1000.0;
+
+        auto ctl = co_await detail::HttpRequestAwaiter{station, client, req, timeoutSec, deadline};
 
         // Terminal cancellation: the shutdown path resumed us early. Do not
         // retry; surface immediately so the worker reaches final_suspend.
@@ -340,6 +395,9 @@ HttpClient::send(std::string method, std::string path, std::string_view body, co
         }
 
         const drogon::ReqResult rc = ctl->rc;
+        if (clamped && rc == drogon::ReqResult::Timeout) {
+            co_return aid::plumbing::unexpected{deadlineExceeded(attempt + 1)};
+        }
         const bool retryable =
             rc == drogon::ReqResult::NetworkFailure || rc == drogon::ReqResult::Timeout;
         const bool lastAttempt = attempt + 1 >= attempts;
@@ -347,7 +405,10 @@ HttpClient::send(std::string method, std::string path, std::string_view body, co
         if (retryable && !lastAttempt) {
             const auto idx = static_cast<std::size_t>(attempt);
             const auto sleepDur = idx < kBackoff.size() ? kBackoff[idx] : kBackoff.back();
-            co_await SleepAwaiter{*loop, sleepDur};
+            if (deadline && aid::plumbing::DeadlineClock::now() + sleepDur >= *deadline) {
+                co_return aid::plumbing::unexpected{deadlineExceeded(attempt + 1)};
+            }
+            co_await SleepAwaiter{*loop, sleepDur, deadline};
         } else {
             // Boundary logging belongs to the adapter (where cid is in scope) /
             // mailbox worker. Propagate silently here.
@@ -1,5 +1,7 @@
 #include "aid/infrastructure/Mailbox.h"
 
+#include <chrono>
+#include <optional>
 #include <type_traits>
 #include <utility>
 #include <variant>
@@ -10,11 +12,37 @@
 namespace aid::infrastructure {
 
 Mailbox::Mailbox(trantor::EventLoop& domainLoop, Wal& wal, aid::crosscutting::Logger& logger,
-                 Handlers handlers, ReplayDecoder decoder)
+                 Handlers handlers, ReplayDecoder decoder, Budgets budgets)
     : logger_(logger), handlers_(std::move(handlers)), decoder_(std::move(decoder)),
+      budgets_(budgets),
       engine_(
           domainLoop, wal, logger, [this](Engine::Pending& p) { return dispatch(p); },
-          Engine::Labels{"mailbox", "handled event callid", "usecase failed"}) {
+          Engine::Labels{"mailbox", "handled event callid", "usecase failed"},
+          [this](const aid::CallEvent& e) -> std::optional<std::chrono::milliseconds> {
+              return budgetFor(budgets_, e);
+          }) {
+}
+
+std::chrono::milliseconds Mailbox::budgetFor(const Budgets& budgets,
+                                             const aid::CallEvent& event) {
+    return std::visit(
+        [&budgets](const auto& alt) {
+            using T = std::decay_t<decltype(alt)>;
+            if constexpr (std::is_same_v<T, aid::IncomingCall>) {
+                return budgets.incoming;
+            } else if constexpr (std::is_same_v<T, aid::OutgoingCall>) {
+                return budgets.outgoing;
+            } else if constexpr (std::is_same_v<T, aid::AcceptedCall>) {
+                return budgets.accepted;
+            } else if constexpr (std::is_same_v<T, aid::TransferCall>) {
+                return budgets.transfer;
+            } else {
+                static_assert(std::is_same_v<T, aid::HangupCall>,
+                              "CallEvent variant has an alternative no budget knows about");
+                return budgets.hangup;
+            }
+        },
+        event);
 }
 
 aid::plumbing::Task<aid::plumbing::Result<void>> Mailbox::dispatch(Engine::Pending& p) {
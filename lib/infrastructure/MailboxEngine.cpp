@@ -2,6 +2,7 @@
 
 #include <trantor/net/EventLoop.h>
 
+#include <algorithm>
 #include <cassert>
 #include <future>
 #include <string_view>
@@ -34,9 +35,56 @@ Error rejection(const std::string& msg, std::string_view cid = {}) {
 template <class Key, class Payload>
 MailboxEngine<Key, Payload>::MailboxEngine(trantor::EventLoop& domainLoop, Wal& wal,
                                            aid::crosscutting::Logger& logger, Dispatch dispatch,
-                                           Labels labels)
+                                           Labels labels, BudgetFor budgetFor,
+                                           VersionOf versionOf)
     : domainLoop_(domainLoop), wal_(wal), logger_(logger), dispatch_(std::move(dispatch)),
-      labels_(std::move(labels)) {
+      labels_(std::move(labels)), budgetFor_(std::move(budgetFor)),
+      versionOf_(std::move(versionOf)) {
+}
+
+template <class Key, class Payload>
+std::optional<aid::plumbing::Deadline>
+MailboxEngine<Key, Payload>::deadlineFor(const Payload& payload) const {
+    if (!budgetFor_) {
+        return std::nullopt;
+    }
+    const auto budget = budgetFor_(payload);
+    if (!budget || budget->count() <= 0) {
+        return std::nullopt;
+    }
+    return aid::plumbing::DeadlineClock::now() + *budget;
+}
+
+template <class Key, class Payload>
+bool MailboxEngine<Key, Payload>::supersede(std::deque<Pending>& dq, Pending& incoming) {
+    if (!incoming.version) {
+        return false;
+    }
+    // Out-of-order delivery: a newer state is already queued, so this one has
+    // nothing to add. Its seq rides along and is acked with the newer event.
+    auto newer = std::find_if(dq.begin(), dq.end(), [&incoming](const Pending& q) {
+        return q.version && *q.version > *incoming.version;
+    });
+    if (newer != dq.end()) {
+        newer->supersededSeqs.push_back(incoming.walSeq);
+        newer->supersededSeqs.insert(newer->supersededSeqs.end(),
+                                     incoming.supersededSeqs.begin(),
+                                     incoming.supersededSeqs.end());
+        return true;
+    }
+    // The usual case: the queued events at or below this version are replaced
+    // by it.
+    for (auto it = dq.begin(); it != dq.end();) {
+        if (it->version && *it->version <= *incoming.version) {
+            incoming.supersededSeqs.push_back(it->walSeq);
+            incoming.supersededSeqs.insert(incoming.supersededSeqs.end(),
+                                           it->supersededSeqs.begin(), it->supersededSeqs.end());
+            it = dq.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return false;
 }
 
 template <class Key, class Payload> MailboxEngine<Key, Payload>::~MailboxEngine() {
@@ -78,6 +126,8 @@ aid::plumbing::Result<void>
 MailboxEngine<Key, Payload>::enqueue(Key key, Payload payload, std::string correlationId,
                                      std::uint64_t walSeq, bool replay) {
     bool needSpawn = false;
+    auto deadline = deadlineFor(payload);
+    const auto version = versionOf_ ? versionOf_(payload) : std::nullopt;
     {
         std::lock_guard lk{mtx_};
         if (draining_.load(std::memory_order_acquire)) {
@@ -89,10 +139,18 @@ MailboxEngine<Key, Payload>::enqueue(Key key, Payload payload, std::string corre
                 rejection(labels_.prefix + " cap reached", correlationId)};
         }
         auto& dq = queues_[key];
+        Pending incoming{walSeq, std::move(payload), correlationId, replay, deadline, version};
+        // Superseding never grows the queue, so it runs before the full
+        // check: a burst of edits to one ticket collapses instead of
+        // tripping backpressure.
+        if (supersede(dq, incoming)) {
+            lastActivity_[key] = std::chrono::steady_clock::now();
+            return {};
+        }
         if (dq.size() >= MAX_QUEUE) {
             return aid::plumbing::unexpected{rejection(labels_.prefix + " full", correlationId)};
         }
-        dq.push_back(Pending{walSeq, std::move(payload), correlationId, replay});
+        dq.push_back(std::move(incoming));
         lastActivity_[key] = std::chrono::steady_clock::now();
         needSpawn = activeWorkers_.insert(key).second;
     }
@@ -106,10 +164,20 @@ template <class Key, class Payload>
 void MailboxEngine<Key, Payload>::enqueueBypass(Key key, Payload payload, std::string correlationId,
                                                 std::uint64_t walSeq, bool replay) {
     bool needSpawn = false;
+    // A replayed event's budget starts now: its original wait spanned a
+    // restart, and a zero budget would only fail it straight back to the WAL.
+    auto deadline = deadlineFor(payload);
+    const auto version = versionOf_ ? versionOf_(payload) : std::nullopt;
     {
         std::lock_guard lk{mtx_};
         auto& dq = queues_[key];
-        dq.push_back(Pending{walSeq, std::move(payload), std::move(correlationId), replay});
+        Pending incoming{walSeq, std::move(payload), std::move(correlationId), replay, deadline,
+                         version};
+        if (supersede(dq, incoming)) {
+            lastActivity_[key] = std::chrono::steady_clock::now();
+            return;
+        }
+        dq.push_back(std::move(incoming));
         lastActivity_[key] = std::chrono::steady_clock::now();
         needSpawn = activeWorkers_.insert(key).second;
     }
@@ -223,9 +291,25 @@ aid::plumbing::Task<void> MailboxEngine<Key, Payload>::workerCoroutine(Key key)
 
             // Top-level try-catch (below). The dispatch may throw or
             // return an Error; both must leave the WAL record in place for
-            // replay.
-            auto r = co_await dispatch_(p);
+            // replay. The event's budget is installed only for the dispatch's
+            // synchronous start; HttpClient re-installs it on every resume it
+            // drives, so it follows the chain without outliving this event.
+            auto step = [&] {
+                const aid::plumbing::DeadlineScope scope{p.deadline};
+                return dispatch_(p);
+            }();
+            auto r = co_await step;
             if (r) {
+                // The events this one superseded are settled by its success.
+                for (const auto seq : p.supersededSeqs) {
+                    if (const auto acked = wal_.ack(seq); !acked) {
+                        failedCount_.fetch_add(1, std::memory_order_release);
+                        logger_.error(labels_.prefix + ": WAL ack failed: " +
+                                          acked.error().message,
+                                      aid::crosscutting::LogType::BACKEND,
+                                      std::string_view{p.correlationId});
+                    }
+                }
                 const auto acked = wal_.ack(p.walSeq);
                 if (!acked) {
                     failedCount_.fetch_add(1, std::memory_order_release);
@@ -4,6 +4,7 @@
 #include <drogon/utils/coroutine.h>
 #include <trantor/net/EventLoop.h>
 
+#include <algorithm>
 #include <exception>
 #include <future>
 #include <string>
@@ -47,7 +48,21 @@ void MembershipReconciler::start() {
     // domain-loop timerfd re-arm bug is sidestepped entirely.
     timerLoop_ = drogon::app().getLoop();
     timerId_ = timerLoop_->runEvery(static_cast<double>(interval_.count()),
-                                    [this]() { loop_.queueInLoop([this]() { launchTick(); }); });
+                                    [this]() { loop_.queueInLoop([this]() { onTimer(); }); });
+}
+
+std::chrono::seconds MembershipReconciler::currentInterval() const noexcept {
+    return interval_ * backoff_.load(std::memory_order_acquire);
+}
+
+void MembershipReconciler::onTimer() {
+    // The app-loop timer keeps its fixed period (re-arming it on the app loop
+    // for every cadence change would race stop()); the backoff is applied here
+    // by skipping fires instead.
+    if (--ticksUntilPoll_ > 0)
+        return;
+    ticksUntilPoll_ = backoff_.load(std::memory_order_relaxed);
+    launchTick();
 }
 
 void MembershipReconciler::kick() {
@@ -133,12 +148,25 @@ void MembershipReconciler::launchTick() {
                     // the only place the failure reaches backend.log.
                     self->logger_.warn("MembershipReconciler: refreshMembership failed: " +
                                        deltas.error().message);
-                } else if (!deltas->empty()) {
-                    // Heavy openCallsInProject query is gated on a real change
-                    // (it lives inside applyDeltas / ReconcileMemberships).
-                    if (auto r = co_await self->applyDeltas_(std::move(*deltas)); !r) {
-                        self->logger_.warn("MembershipReconciler: reconcile failed: " +
-                                           r.error().message);
+                } else {
+                    // Adapt the cadence: poll at the configured interval while
+                    // membership is moving, back off while it is quiet. An
+                    // error or a closed gate says nothing either way.
+                    const int backoff =
+                        deltas->empty()
+                            ? std::min(self->backoff_.load(std::memory_order_relaxed) * 2,
+                                       kMaxBackoff)
+                            : 1;
+                    self->backoff_.store(backoff, std::memory_order_release);
+                    self->ticksUntilPoll_ = backoff;
+                    if (!deltas->empty()) {
+                        // Heavy openCallsInProject query is gated on a real
+                        // change (it lives inside applyDeltas /
+                        // ReconcileMemberships).
+                        if (auto r = co_await self->applyDeltas_(std::move(*deltas)); !r) {
+                            self->logger_.warn("MembershipReconciler: reconcile failed: " +
+                                               r.error().message);
+                        }
                     }
                 }
             }
@@ -1,5 +1,8 @@
 #include "aid/infrastructure/WebhookMailbox.h"
 
+#include <chrono>
+#include <optional>
+#include <string>
 #include <utility>
 
 #include "aid/crosscutting/Logger.h"
@@ -8,11 +11,18 @@ namespace aid::infrastructure {
 
 WebhookMailbox::WebhookMailbox(trantor::EventLoop& domainLoop, Wal& wal,
                                aid::crosscutting::Logger& logger, Handler handler,
-                               KeyExtractor extractor)
+                               KeyExtractor extractor, std::chrono::milliseconds budget,
+                               VersionPeek versionPeek)
     : logger_(logger), handler_(std::move(handler)), extractor_(std::move(extractor)),
       engine_(
           domainLoop, wal, logger, [this](Engine::Pending& p) { return dispatch(p); },
-          Engine::Labels{"webhook mailbox", "handled ticket", "handler failed"}) {
+          Engine::Labels{"webhook mailbox", "handled ticket", "handler failed"},
+          [budget](const std::string&) -> std::optional<std::chrono::milliseconds> {
+              return budget;
+          },
+          versionPeek ? Engine::VersionOf{[peek = std::move(versionPeek)](
+                                              const std::string& body) { return peek(body); }}
+                      : Engine::VersionOf{}) {
 }
 
 aid::plumbing::Task<aid::plumbing::Result<void>> WebhookMailbox::dispatch(Engine::Pending& p) {
@@ -0,0 +1,54 @@
+#include "aid/plumbing/Deadline.h"
+
+#include <atomic>
+
+namespace aid::plumbing {
+
+namespace {
+
+thread_local std::int64_t tlsDeadline = kNoDeadline;
+
+// Which slot this module reads/writes. Defaults to its own; a plugin is
+// rebound to the daemon's at load time. Written once before any event flows,
+// read on every send — relaxed is enough, the dlopen/factory call orders it.
+std::atomic<DeadlineSlotFn> slotFn{&localDeadlineSlot};
+
+std::int64_t* slot() noexcept {
+    return slotFn.load(std::memory_order_relaxed)();
+}
+
+std::int64_t encode(const std::optional<Deadline>& d) noexcept {
+    return d ? static_cast<std::int64_t>(d->time_since_epoch().count()) : kNoDeadline;
+}
+
+std::optional<Deadline> decode(std::int64_t raw) noexcept {
+    if (raw == kNoDeadline) {
+        return std::nullopt;
+    }
+    return Deadline{DeadlineClock::duration{raw}};
+}
+
+} // namespace
+
+std::int64_t* localDeadlineSlot() {
+    return &tlsDeadline;
+}
+
+void bindDeadlineSlot(DeadlineSlotFn fn) noexcept {
+    slotFn.store(fn != nullptr ? fn : &localDeadlineSlot, std::memory_order_relaxed);
+}
+
+std::optional<Deadline> currentDeadline() noexcept {
+    return decode(*slot());
+}
+
+DeadlineScope::DeadlineScope(std::optional<Deadline> deadline) noexcept
+    : previous_(currentDeadline()) {
+    *slot() = encode(deadline);
+}
+
+DeadlineScope::~DeadlineScope() {
+    *slot() = encode(previous_);
+}
+
+} // namespace aid::plumbing
@@ -20,6 +20,8 @@ std::string_view errorCodeName(ErrorCode code) noexcept {
         return "UpstreamUnavailable";
     case ErrorCode::UpstreamTimeout:
         return "UpstreamTimeout";
+    case ErrorCode::DeadlineExceeded:
+        return "DeadlineExceeded";
     case ErrorCode::Unauthenticated:
         return "Unauthenticated";
     case ErrorCode::Forbidden:
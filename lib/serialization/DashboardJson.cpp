@@ -3,8 +3,11 @@
 #include <chrono>
 #include <ctime>
 #include <iomanip>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "aid/value-types/Dashboard.h"
 #include "aid/value-types/Ids.h"
@@ -54,6 +57,22 @@ namespace {
     return aid::formatIso8601Utc(t);
 }
 
+// The per-viewer keys, shared by toJson and applyOverlay so both render them
+// identically.
+void writeViewerFields(nlohmann::json& j, const std::optional<aid::CallId>& activeCallForViewer,
+                       const std::vector<aid::UserHandle>& otherActiveUsers) {
+    if (activeCallForViewer.has_value()) {
+        j["activeCallForViewer"] = activeCallForViewer->v;
+    } else {
+        j["activeCallForViewer"] = nullptr;
+    }
+    auto others = nlohmann::json::array();
+    for (const auto& u : otherActiveUsers) {
+        others.push_back(u.v);
+    }
+    j["otherActiveUsers"] = std::move(others);
+}
+
 } // namespace
 
 nlohmann::json toJson(const aid::DashboardEntry& e) {
@@ -90,16 +109,7 @@ nlohmann::json toJson(const aid::DashboardEntry& e) {
     }
     j["href"] = e.href;
     j["projectName"] = e.projectName;
-    if (e.activeCallForViewer.has_value()) {
-        j["activeCallForViewer"] = e.activeCallForViewer->v;
-    } else {
-        j["activeCallForViewer"] = nullptr;
-    }
-    auto others = nlohmann::json::array();
-    for (const auto& u : e.otherActiveUsers) {
-        others.push_back(u.v);
-    }
-    j["otherActiveUsers"] = std::move(others);
+    writeViewerFields(j, e.activeCallForViewer, e.otherActiveUsers);
     j["description"] = e.description;
     // updatedAt rides inside the entry (REST + the WS ticket_upsert frame share
     // this projection) so the frontend can re-sort merged live deltas by the
@@ -110,4 +120,8 @@ nlohmann::json toJson(const aid::DashboardEntry& e) {
     return j;
 }
 
+void applyOverlay(nlohmann::json& entry, const aid::ViewerOverlay& overlay) {
+    writeViewerFields(entry, overlay.activeCallForViewer, overlay.otherActiveUsers);
+}
+
 } // namespace aid::serialization
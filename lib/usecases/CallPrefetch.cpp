@@ -0,0 +1,185 @@
+#include "aid/usecases/CallPrefetch.h"
+
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "aid/crosscutting/Clock.h"
+#include "aid/plumbing/Deadline.h"
+#include "aid/ports/AddressBook.h"
+#include "aid/ports/TicketStore.h"
+
+namespace aid::usecases {
+
+using aid::plumbing::Result;
+using aid::plumbing::Task;
+
+template <class T> struct CallPrefetch::FlightWait {
+    Flight<T>& flight;
+
+    [[nodiscard]] bool await_ready() const noexcept { return flight.result.has_value(); }
+
+    void await_suspend(std::coroutine_handle<> h) {
+        flight.waiters.push_back(Waiter{h, aid::plumbing::currentDeadline()});
+    }
+
+    void await_resume() const noexcept {}
+};
+
+CallPrefetch::CallPrefetch(aid::ports::TicketStore& ts, aid::ports::AddressBook& ab,
+                           aid::crosscutting::Clock& clock, std::chrono::milliseconds ttl,
+                           BudgetFor budgetFor)
+    : ts_(ts), ab_(ab), clock_(clock), ttl_(ttl), budgetFor_(std::move(budgetFor)) {
+}
+
+template <class T>
+Task<void> CallPrefetch::fill(std::shared_ptr<Flight<T>> flight, Task<Result<T>> query) {
+    auto result = co_await query;
+    flight->result = std::move(result);
+    // sweep() only reaps finished fill()s, so this frame outlives the
+    // use cases it resumes here.
+    auto wake = std::exchange(flight->waiters, {});
+    for (const auto& w : wake) {
+        const aid::plumbing::DeadlineScope scope{w.deadline};
+        w.handle.resume();
+    }
+}
+
+template <class T> bool CallPrefetch::fresh(const Flight<T>& flight) const {
+    return clock_.now() - flight.started <= ttl_;
+}
+
+std::optional<aid::plumbing::Deadline>
+CallPrefetch::deadlineFor(const aid::CallEvent& event) const {
+    if (!budgetFor_) {
+        return std::nullopt;
+    }
+    const auto budget = budgetFor_(event);
+    if (budget.count() <= 0) {
+        return std::nullopt;
+    }
+    return aid::plumbing::DeadlineClock::now() + budget;
+}
+
+void CallPrefetch::begin(const aid::CallEvent& event) {
+    sweep();
+    const auto callid = aid::callidOf(event);
+    // The port calls below start (eagerly) under the event's budget.
+    const aid::plumbing::DeadlineScope scope{deadlineFor(event)};
+
+    std::visit(
+        [&](const auto& alt) {
+            using T = std::decay_t<decltype(alt)>;
+            if constexpr (std::is_same_v<T, aid::IncomingCall> ||
+                          std::is_same_v<T, aid::OutgoingCall>) {
+                auto canonical = ab_.canonicalize(alt.remote);
+                if (canonical.empty()) {
+                    return;
+                }
+                auto& entry = entries_[callid];
+                if (entry.contact && entry.number == canonical && fresh(*entry.contact)) {
+                    const auto& settled = entry.contact->result;
+                    if (!settled || *settled) {
+                        return;
+                    }
+                }
+                entry.number = canonical;
+                entry.contact = std::make_shared<ContactFlight>();
+                entry.contact->started = clock_.now();
+                fills_.push_back(fill(entry.contact, ab_.lookup(std::move(canonical))));
+            } else {
+                auto& entry = entries_[callid];
+                if (entry.hungUp) {
+                    // The ticket may have lost this callid by the time this
+                    // event runs; let it ask the store itself.
+                    entry.ticket.reset();
+                    return;
+                }
+                if constexpr (std::is_same_v<T, aid::HangupCall>) {
+                    entry.hungUp = true;
+                }
+                // An in-flight read or a hit serves this event too; a miss or
+                // an error is worth asking again, the ticket may exist by now.
+                if (entry.ticket && fresh(*entry.ticket)) {
+                    const auto& settled = entry.ticket->result;
+                    if (!settled || (*settled && settled->value().has_value())) {
+                        return;
+                    }
+                }
+                entry.ticket = std::make_shared<TicketFlight>();
+                entry.ticket->started = clock_.now();
+                fills_.push_back(fill(entry.ticket, ts_.findByCallidContains(callid)));
+            }
+        },
+        event);
+}
+
+Task<Result<std::optional<aid::Contact>>> CallPrefetch::lookup(aid::CallId callid,
+                                                               aid::PhoneNumber canonical) {
+    std::shared_ptr<ContactFlight> flight;
+    if (const auto it = entries_.find(callid); it != entries_.end() && it->second.contact &&
+                                               it->second.number == canonical &&
+                                               fresh(*it->second.contact)) {
+        flight = it->second.contact;
+    }
+    if (flight) {
+        co_await FlightWait<std::optional<aid::Contact>>{*flight};
+        if (*flight->result) {
+            co_return *flight->result;
+        }
+    }
+    auto query = ab_.lookup(std::move(canonical));
+    co_return co_await query;
+}
+
+Task<Result<std::optional<aid::Ticket>>> CallPrefetch::findByCallidContains(aid::CallId callid) {
+    std::shared_ptr<TicketFlight> flight;
+    if (const auto it = entries_.find(callid);
+        it != entries_.end() && it->second.ticket && fresh(*it->second.ticket)) {
+        flight = it->second.ticket;
+    }
+    if (flight) {
+        co_await FlightWait<std::optional<aid::Ticket>>{*flight};
+        if (*flight->result && flight->result->value().has_value()) {
+            co_return *flight->result;
+        }
+    }
+    auto query = ts_.findByCallidContains(std::move(callid));
+    co_return co_await query;
+}
+
+bool CallPrefetch::drain() {
+    fills_.remove_if([](const Task<void>& t) { return t.done(); });
+    if (fills_.empty()) {
+        return true;
+    }
+    ts_.cancelPendingRequests();
+    ab_.cancelPendingRequests();
+    return false;
+}
+
+std::size_t CallPrefetch::size() const noexcept {
+    return entries_.size();
+}
+
+void CallPrefetch::sweep() {
+    // Only settled flights expire: a use case may still be parked on one in
+    // flight, and its fill() holds it anyway.
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        auto& entry = it->second;
+        if (entry.contact && entry.contact->result && !fresh(*entry.contact)) {
+            entry.contact.reset();
+        }
+        if (entry.ticket && entry.ticket->result && !fresh(*entry.ticket)) {
+            entry.ticket.reset();
+        }
+        if (!entry.contact && !entry.ticket) {
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    fills_.remove_if([](const Task<void>& t) { return t.done(); });
+}
+
+} // namespace aid::usecases
@@ -39,11 +39,11 @@ GetDashboard::GetDashboard(aid::ports::TicketStore& ts, aid::ports::AddressBook&
 }
 
 Task<Result<aid::DashboardView>> GetDashboard::run(aid::UserHandle viewer) {
-    auto listed = co_await ts_.listDashboard(std::move(viewer));
+    auto listed = co_await ts_.listDashboardStamped(std::move(viewer));
     if (!listed.has_value()) {
         co_return aid::plumbing::unexpected{listed.error()};
     }
-    auto tickets = std::move(*listed);
+    auto tickets = std::move(listed->entries);
 
     std::optional<aid::ActiveCall> active;
     for (const auto& e : tickets) {
@@ -69,7 +69,7 @@ Task<Result<aid::DashboardView>> GetDashboard::run(aid::UserHandle viewer) {
     }
 
     co_return aid::DashboardView{std::move(tickets), std::move(active),
-                                 std::move(addressCallInformation)};
+                                 std::move(addressCallInformation), listed->stamp};
 }
 
 } // namespace aid::usecases
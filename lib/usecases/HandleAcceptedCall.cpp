@@ -9,6 +9,7 @@
 #include "aid/plumbing/Error.h"
 #include "aid/ports/TicketStore.h"
 #include "aid/ports/UiNotifier.h"
+#include "aid/usecases/CallPrefetch.h"
 #include "aid/usecases/TicketDeltaEmitter.h"
 #include "aid/value-types/Ids.h"
 #include "aid/value-types/Ticket.h"
@@ -19,8 +20,8 @@ using aid::plumbing::Result;
 using aid::plumbing::Task;
 
 HandleAcceptedCall::HandleAcceptedCall(aid::ports::TicketStore& ts, aid::ports::UiNotifier& ui,
-                                       aid::crosscutting::Clock& clock)
-    : ts_(ts), ui_(ui), clock_(clock) {
+                                       aid::crosscutting::Clock& clock, CallPrefetch* prefetch)
+    : ts_(ts), ui_(ui), clock_(clock), prefetch_(prefetch) {
 }
 
 Task<Result<void>> HandleAcceptedCall::run(const aid::AcceptedCall& ev) {
@@ -29,7 +30,9 @@ Task<Result<void>> HandleAcceptedCall::run(const aid::AcceptedCall& ev) {
     // would miss the second-and-later accepts. Missing ticket is
     // non-fatal: the phone system can deliver Accept before Ring, or Ring may have been
     // dropped.
-    auto found = co_await ts_.findByCallidContains(ev.callid);
+    auto query = prefetch_ != nullptr ? prefetch_->findByCallidContains(ev.callid)
+                                      : ts_.findByCallidContains(ev.callid);
+    auto found = co_await query;
     if (!found) {
         co_return aid::plumbing::unexpected{found.error()};
     }
@@ -117,22 +120,26 @@ Task<Result<void>> HandleAcceptedCall::run(const aid::AcceptedCall& ev) {
     // mechanism that survives even when the handler is not the assignee /
     // not a project member, so a failure must propagate (the WAL keeps the
     // event for replay) rather than be swallowed.
+    //
+    // The delta must carry the authoritative post-write state — the lockVersion
+    // after BOTH the save and the callHandler merge, and the callHandlers CSV
+    // that recipientsFor targets (so a cross-project accepting operator reaches
+    // their own dashboard). addCallHandlerAndGet returns exactly that; with no
+    // handler, save()'s own result already is it. Neither needs a re-fetch.
+    std::optional<aid::Ticket> emitTicket = std::move(*saved);
     if (handler.has_value()) {
-        auto recorded = co_await ts_.addCallHandler(id, *handler);
+        auto recorded = co_await ts_.addCallHandlerAndGet(id, *handler);
         if (!recorded) {
             co_return aid::plumbing::unexpected{recorded.error()};
         }
+        emitTicket = std::move(*recorded);
     }
 
-    // Step 6: push the live delta. Re-fetch so the entry reflects the
-    // authoritative post-PATCH state — the lockVersion after BOTH the save and
-    // the callHandler merge, and the callHandlers CSV that recipientsFor targets
-    // (so a cross-project accepting operator reaches their own dashboard). A
-    // failed re-fetch is non-fatal: the save already succeeded.
-    auto fresh = co_await ts_.fetchById(id);
-    if (fresh.has_value()) {
+    // Step 6: push the live delta. A merged-but-unreadable ticket (nullopt) is
+    // non-fatal: the writes already succeeded.
+    if (emitTicket.has_value()) {
         TicketDeltaEmitter emitter{ts_, ui_};
-        (void)co_await emitter.emitTicketDelta(std::move(*fresh));
+        (void)co_await emitter.emitTicketDelta(std::move(*emitTicket));
     }
     co_return Result<void>{};
 }
@@ -10,6 +10,7 @@
 #include "aid/plumbing/Error.h"
 #include "aid/ports/TicketStore.h"
 #include "aid/ports/UiNotifier.h"
+#include "aid/usecases/CallPrefetch.h"
 #include "aid/usecases/TicketDeltaEmitter.h"
 #include "aid/value-types/Ids.h"
 #include "aid/value-types/Ticket.h"
@@ -20,14 +21,16 @@ using aid::plumbing::Result;
 using aid::plumbing::Task;
 
 HandleHangup::HandleHangup(aid::ports::TicketStore& ts, aid::ports::UiNotifier& ui,
-                           aid::crosscutting::Clock& clock)
-    : ts_(ts), ui_(ui), clock_(clock) {
+                           aid::crosscutting::Clock& clock, CallPrefetch* prefetch)
+    : ts_(ts), ui_(ui), clock_(clock), prefetch_(prefetch) {
 }
 
 Task<Result<void>> HandleHangup::run(const aid::HangupCall& ev) {
     // Step 1: lookup by callid substring. Missing ticket is a critical
     // error here — the only event that promotes "not found".
-    auto found = co_await ts_.findByCallidContains(ev.callid);
+    auto query = prefetch_ != nullptr ? prefetch_->findByCallidContains(ev.callid)
+                                      : ts_.findByCallidContains(ev.callid);
+    auto found = co_await query;
     if (!found) {
         co_return aid::plumbing::unexpected{found.error()};
     }
@@ -5,7 +5,6 @@
 #include <string>
 #include <utility>
 #include <variant>
-#include <vector>
 
 #include "aid/domain/CallTracker.h"
 #include "aid/domain/TicketRouter.h"
@@ -13,6 +12,7 @@
 #include "aid/ports/AddressBook.h"
 #include "aid/ports/TicketStore.h"
 #include "aid/ports/UiNotifier.h"
+#include "aid/usecases/CallPrefetch.h"
 #include "aid/usecases/TicketDeltaEmitter.h"
 #include "aid/value-types/Contact.h"
 #include "aid/value-types/Ids.h"
@@ -53,8 +53,9 @@ aid::NewTicket buildNewTicket(const aid::ProjectId& project, std::string subject
 
 HandleIncomingCall::HandleIncomingCall(aid::ports::TicketStore& ts, aid::ports::AddressBook& ab,
                                        aid::ports::UiNotifier& ui, aid::crosscutting::Clock& clock,
-                                       const aid::crosscutting::Config::TicketRouting& cfg)
-    : ts_(ts), ab_(ab), ui_(ui), clock_(clock), cfg_(cfg) {
+                                       const aid::crosscutting::Config::TicketRouting& cfg,
+                                       CallPrefetch* prefetch)
+    : ts_(ts), ab_(ab), ui_(ui), clock_(clock), cfg_(cfg), prefetch_(prefetch) {
 }
 
 Task<Result<void>> HandleIncomingCall::run(const aid::IncomingCall& ev, bool replay) {
@@ -103,21 +104,42 @@ Task<Result<void>> HandleIncomingCall::run(const aid::IncomingCall& ev, bool rep
         // NewTicket to a named local first.
         const auto nt = buildNewTicket(cfg_.unknownFallback, cfg_.incognitoSubject, ev,
                                        aid::PhoneNumber{"Incognito"});
-        auto created = co_await ts_.create(nt);
+        // createAndGet hands back the created ticket itself (nullopt only when
+        // it could not be read back — no delta then, as with a failed fetch).
+        auto created = co_await ts_.createAndGet(nt);
         if (!created) {
             co_return aid::plumbing::unexpected{created.error()};
         }
-        auto fresh = co_await ts_.fetchById(*created);
-        if (fresh.has_value()) {
+        if (created->has_value()) {
             TicketDeltaEmitter emitter{ts_, ui_};
-            (void)co_await emitter.emitTicketDelta(std::move(*fresh));
+            (void)co_await emitter.emitTicketDelta(std::move(**created));
         }
         co_return Result<void>{};
     }
 
     // Routable: step 1 — ab.lookup(canonical). NEVER pass ev.remote.
-    auto contactRes = co_await ab_.lookup(canonical);
+    //
+    // Task is eager, so the lookup is already under way here. When it could
+    // not answer at once (it went to the address system), the unknown
+    // branch's fallback-project query is started speculatively beside it:
+    // an unknown caller then costs max(lookup, query) instead of the sum. A
+    // known caller discards the speculative answer, but it is still awaited
+    // on every path below — a Task must not be destroyed while suspended.
+    // A lookup answered from the address book's mirror or cache, or already
+    // settled by the ingest prefetch, has nothing to overlap with, so no
+    // query is wasted on it.
+    auto lookup = prefetch_ != nullptr ? prefetch_->lookup(ev.callid, canonical)
+                                       : ab_.lookup(canonical);
+    std::optional<Task<Result<std::optional<aid::Ticket>>>> speculative;
+    if (!lookup.done()) {
+        speculative.emplace(ts_.findOpenInProjectByCallerNumber(cfg_.unknownFallback, canonical));
+    }
+    auto contactRes = co_await lookup;
     if (!contactRes) {
+        if (speculative) {
+            auto& discarded = *speculative;
+            (void)co_await discarded;
+        }
         co_return aid::plumbing::unexpected{contactRes.error()};
     }
     const std::optional<aid::Contact>& contactOpt = *contactRes;
@@ -137,24 +159,25 @@ Task<Result<void>> HandleIncomingCall::run(const aid::IncomingCall& ev, bool rep
         const aid::Contact& contact = *contactOpt;
         createSubject = contactName(contact);
 
-        std::vector<aid::domain::TicketRouter::RoutingCandidate> candidates;
-        candidates.reserve(contact.projectIds.size());
-        for (const auto& pid : contact.projectIds) {
-            auto open = co_await ts_.findOpenInProjectByCallerNumber(pid, canonical);
-            if (!open) {
-                co_return aid::plumbing::unexpected{open.error()};
-            }
-            candidates.push_back(
-                aid::domain::TicketRouter::RoutingCandidate{pid, std::move(*open)});
+        // One batch lookup across every project of the contact (a single
+        // filtered query in the ticket system) rather than one per project.
+        const std::span<const aid::ProjectId> projects{contact.projectIds};
+        auto batch = ts_.findOpenByCallerNumberInProjects(projects, canonical);
+        if (speculative) {
+            auto& discarded = *speculative;
+            (void)co_await discarded;
+        }
+        auto open = co_await batch;
+        if (!open) {
+            co_return aid::plumbing::unexpected{open.error()};
         }
 
         const auto decision = aid::domain::TicketRouter::decideKnown(
-            aid::domain::TicketRouter::KnownInput{std::span{candidates}});
+            aid::domain::TicketRouter::KnownInput{projects, std::span{*open}});
         if (const auto* re = std::get_if<aid::domain::TicketRouter::ReuseExisting>(&decision)) {
-            for (auto& c : candidates) {
-                if (c.latestOpenCallTicket.has_value() &&
-                    c.latestOpenCallTicket->id == re->ticket) {
-                    reuseTicket = std::move(c.latestOpenCallTicket);
+            for (auto& latest : *open) {
+                if (latest.has_value() && latest->id == re->ticket) {
+                    reuseTicket = std::move(latest);
                     break;
                 }
             }
@@ -178,8 +201,12 @@ Task<Result<void>> HandleIncomingCall::run(const aid::IncomingCall& ev, bool rep
         }
         createSubject = name.empty() ? canonical.v : name;
 
-        auto byNumber =
-            co_await ts_.findOpenInProjectByCallerNumber(cfg_.unknownFallback, canonical);
+        if (!speculative) {
+            speculative.emplace(
+                ts_.findOpenInProjectByCallerNumber(cfg_.unknownFallback, canonical));
+        }
+        auto& query = *speculative;
+        auto byNumber = co_await query;
         if (!byNumber) {
             co_return aid::plumbing::unexpected{byNumber.error()};
         }
@@ -198,11 +225,10 @@ Task<Result<void>> HandleIncomingCall::run(const aid::IncomingCall& ev, bool rep
     }
 
     // Step 4: apply decision. Incoming records no call handler (that happens on
-    // accept), so the save path already has the authoritative post-PATCH ticket
-    // and can emit from it directly; the create path returns only an id and is
-    // re-fetched below.
-    std::optional<aid::Ticket> emitSaved;
-    std::optional<aid::TicketId> emitCreated;
+    // accept), so both paths end holding the authoritative post-write ticket and
+    // emit it directly: save() returns it, createAndGet() returns the created one
+    // (or nullopt when it could not be read back — then there is no delta).
+    std::optional<aid::Ticket> emitTicket;
     if (reuseTicket.has_value()) {
         const aid::TicketId id = reuseTicket->id;
         const aid::CallId callid = ev.callid;
@@ -219,29 +245,24 @@ Task<Result<void>> HandleIncomingCall::run(const aid::IncomingCall& ev, bool rep
         if (!saved) {
             co_return aid::plumbing::unexpected{saved.error()};
         }
-        emitSaved = std::move(*saved);
+        emitTicket = std::move(*saved);
     } else {
         // See incognito-branch comment: hoist the NewTicket out of the
         // co_await operand to avoid the gcc-12 frame-lifetime bug.
         const auto nt = buildNewTicket(*createInProject, createSubject, ev, canonical);
-        auto created = co_await ts_.create(nt);
+        auto created = co_await ts_.createAndGet(nt);
         if (!created) {
             co_return aid::plumbing::unexpected{created.error()};
         }
-        emitCreated = *created;
+        emitTicket = std::move(*created);
     }
 
     // Step 5: push the live delta. clock_ is held for future steps that stamp
     // timestamps; the ring procedure itself doesn't touch it.
     (void)clock_;
-    TicketDeltaEmitter emitter{ts_, ui_};
-    if (emitSaved.has_value()) {
-        (void)co_await emitter.emitTicketDelta(std::move(*emitSaved));
-    } else {
-        auto fresh = co_await ts_.fetchById(*emitCreated);
-        if (fresh.has_value()) {
-            (void)co_await emitter.emitTicketDelta(std::move(*fresh));
-        }
+    if (emitTicket.has_value()) {
+        TicketDeltaEmitter emitter{ts_, ui_};
+        (void)co_await emitter.emitTicketDelta(std::move(*emitTicket));
     }
     co_return Result<void>{};
 }
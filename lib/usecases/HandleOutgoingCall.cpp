@@ -5,7 +5,6 @@
 #include <string>
 #include <utility>
 #include <variant>
-#include <vector>
 
 #include "aid/crosscutting/Clock.h"
 #include "aid/domain/CallTracker.h"
@@ -14,6 +13,7 @@
 #include "aid/ports/AddressBook.h"
 #include "aid/ports/TicketStore.h"
 #include "aid/ports/UiNotifier.h"
+#include "aid/usecases/CallPrefetch.h"
 #include "aid/usecases/TicketDeltaEmitter.h"
 #include "aid/value-types/Contact.h"
 #include "aid/value-types/Ids.h"
@@ -61,8 +61,9 @@ aid::NewTicket buildNewTicket(const aid::ProjectId& project, std::string subject
 
 HandleOutgoingCall::HandleOutgoingCall(aid::ports::TicketStore& ts, aid::ports::AddressBook& ab,
                                        aid::ports::UiNotifier& ui, aid::crosscutting::Clock& clock,
-                                       const aid::crosscutting::Config::TicketRouting& cfg)
-    : ts_(ts), ab_(ab), ui_(ui), clock_(clock), cfg_(cfg) {
+                                       const aid::crosscutting::Config::TicketRouting& cfg,
+                                       CallPrefetch* prefetch)
+    : ts_(ts), ab_(ab), ui_(ui), clock_(clock), cfg_(cfg), prefetch_(prefetch) {
 }
 
 Task<Result<void>> HandleOutgoingCall::run(const aid::OutgoingCall& ev, bool replay) {
@@ -95,14 +96,13 @@ Task<Result<void>> HandleOutgoingCall::run(const aid::OutgoingCall& ev, bool rep
                 // is idempotent — appends only if absent) in case the crash
                 // landed between create and addCallHandler, then re-emit the
                 // delta from the authoritative ticket. Skip the create.
-                auto recorded = co_await ts_.addCallHandler(id, user);
+                auto recorded = co_await ts_.addCallHandlerAndGet(id, user);
                 if (!recorded) {
                     co_return aid::plumbing::unexpected{recorded.error()};
                 }
-                auto fresh = co_await ts_.fetchById(id);
-                if (fresh.has_value()) {
+                if (recorded->has_value()) {
                     TicketDeltaEmitter emitter{ts_, ui_};
-                    (void)co_await emitter.emitTicketDelta(std::move(*fresh));
+                    (void)co_await emitter.emitTicketDelta(std::move(**recorded));
                 }
                 co_return Result<void>{};
             }
@@ -122,22 +122,24 @@ Task<Result<void>> HandleOutgoingCall::run(const aid::OutgoingCall& ev, bool rep
             co_return aid::plumbing::unexpected{created.error()};
         }
         // Record the calling operator in the callHandler CSV (visibility
-        // mechanism, propagate on failure so the WAL can replay).
-        auto recorded = co_await ts_.addCallHandler(*created, user);
+        // mechanism, propagate on failure so the WAL can replay). The merge
+        // hands back the post-merge ticket the delta needs.
+        auto recorded = co_await ts_.addCallHandlerAndGet(*created, user);
         if (!recorded) {
             co_return aid::plumbing::unexpected{recorded.error()};
         }
         (void)clock_; // held for later usecases; ring procedure doesn't use it.
-        auto fresh = co_await ts_.fetchById(*created);
-        if (fresh.has_value()) {
+        if (recorded->has_value()) {
             TicketDeltaEmitter emitter{ts_, ui_};
-            (void)co_await emitter.emitTicketDelta(std::move(*fresh));
+            (void)co_await emitter.emitTicketDelta(std::move(**recorded));
         }
         co_return Result<void>{};
     }
 
     // Routable: step 3 — ab.lookup(canonical). NEVER pass ev.remote.
-    auto contactRes = co_await ab_.lookup(canonical);
+    auto lookup = prefetch_ != nullptr ? prefetch_->lookup(ev.callid, canonical)
+                                       : ab_.lookup(canonical);
+    auto contactRes = co_await lookup;
     if (!contactRes) {
         co_return aid::plumbing::unexpected{contactRes.error()};
     }
@@ -155,24 +157,20 @@ Task<Result<void>> HandleOutgoingCall::run(const aid::OutgoingCall& ev, bool rep
         const aid::Contact& contact = *contactOpt;
         createSubject = contactName(contact);
 
-        std::vector<aid::domain::TicketRouter::RoutingCandidate> candidates;
-        candidates.reserve(contact.projectIds.size());
-        for (const auto& pid : contact.projectIds) {
-            auto open = co_await ts_.findOpenInProjectByCallerNumber(pid, canonical);
-            if (!open) {
-                co_return aid::plumbing::unexpected{open.error()};
-            }
-            candidates.push_back(
-                aid::domain::TicketRouter::RoutingCandidate{pid, std::move(*open)});
+        // One batch lookup across every project of the contact (a single
+        // filtered query in the ticket system) rather than one per project.
+        const std::span<const aid::ProjectId> projects{contact.projectIds};
+        auto open = co_await ts_.findOpenByCallerNumberInProjects(projects, canonical);
+        if (!open) {
+            co_return aid::plumbing::unexpected{open.error()};
         }
 
         const auto decision = aid::domain::TicketRouter::decideKnown(
-            aid::domain::TicketRouter::KnownInput{std::span{candidates}});
+            aid::domain::TicketRouter::KnownInput{projects, std::span{*open}});
         if (const auto* re = std::get_if<aid::domain::TicketRouter::ReuseExisting>(&decision)) {
-            for (auto& c : candidates) {
-                if (c.latestOpenCallTicket.has_value() &&
-                    c.latestOpenCallTicket->id == re->ticket) {
-                    reuseTicket = std::move(c.latestOpenCallTicket);
+            for (auto& latest : *open) {
+                if (latest.has_value() && latest->id == re->ticket) {
+                    reuseTicket = std::move(latest);
                     break;
                 }
             }
@@ -212,7 +210,9 @@ Task<Result<void>> HandleOutgoingCall::run(const aid::OutgoingCall& ev, bool rep
     // Step 4: apply decision. The calling operator is recorded in the
     // callHandler CSV either way; the assignee is set ONLY when empty (the CSV,
     // not the single assignee, is the visibility mechanism — see addCallHandler).
-    aid::TicketId emitId;
+    // The ticket as it stands after the save/create AND the callHandler merge,
+    // straight from addCallHandlerAndGet (nullopt: merged, but not readable).
+    std::optional<aid::Ticket> emitTicket;
     if (reuseTicket.has_value()) {
         const aid::TicketId id = reuseTicket->id;
         const aid::CallId callid = ev.callid;
@@ -239,31 +239,30 @@ Task<Result<void>> HandleOutgoingCall::run(const aid::OutgoingCall& ev, bool rep
         if (!saved) {
             co_return aid::plumbing::unexpected{saved.error()};
         }
-        auto recorded = co_await ts_.addCallHandler(id, user);
+        auto recorded = co_await ts_.addCallHandlerAndGet(id, user);
         if (!recorded) {
             co_return aid::plumbing::unexpected{recorded.error()};
         }
-        emitId = id;
+        emitTicket = std::move(*recorded);
     } else {
         const auto nt = buildNewTicket(*createInProject, createSubject, ev, canonical, user);
         auto created = co_await ts_.create(nt);
         if (!created) {
             co_return aid::plumbing::unexpected{created.error()};
         }
-        auto recorded = co_await ts_.addCallHandler(*created, user);
+        auto recorded = co_await ts_.addCallHandlerAndGet(*created, user);
         if (!recorded) {
             co_return aid::plumbing::unexpected{recorded.error()};
         }
-        emitId = *created;
+        emitTicket = std::move(*recorded);
     }
 
-    // Push the live delta from the authoritative post-PATCH ticket (re-fetched
-    // after the save/create AND the callHandler merge). Non-fatal on failure.
+    // Push the live delta from the authoritative post-merge ticket. A ticket
+    // that could not be read back just means no delta — the write succeeded.
     (void)clock_;
-    auto fresh = co_await ts_.fetchById(emitId);
-    if (fresh.has_value()) {
+    if (emitTicket.has_value()) {
         TicketDeltaEmitter emitter{ts_, ui_};
-        (void)co_await emitter.emitTicketDelta(std::move(*fresh));
+        (void)co_await emitter.emitTicketDelta(std::move(*emitTicket));
     }
     co_return Result<void>{};
 }
@@ -8,6 +8,7 @@
 #include "aid/plumbing/Error.h"
 #include "aid/ports/TicketStore.h"
 #include "aid/ports/UiNotifier.h"
+#include "aid/usecases/CallPrefetch.h"
 #include "aid/usecases/TicketDeltaEmitter.h"
 #include "aid/value-types/Ids.h"
 #include "aid/value-types/Ticket.h"
@@ -17,13 +18,16 @@ namespace aid::usecases {
 using aid::plumbing::Result;
 using aid::plumbing::Task;
 
-HandleTransferCall::HandleTransferCall(aid::ports::TicketStore& ts, aid::ports::UiNotifier& ui)
-    : ts_(ts), ui_(ui) {
+HandleTransferCall::HandleTransferCall(aid::ports::TicketStore& ts, aid::ports::UiNotifier& ui,
+                                       CallPrefetch* prefetch)
+    : ts_(ts), ui_(ui), prefetch_(prefetch) {
 }
 
 Task<Result<void>> HandleTransferCall::run(const aid::TransferCall& ev) {
     // Step 1: lookup by callid substring. Non-fatal if missing.
-    auto found = co_await ts_.findByCallidContains(ev.callid);
+    auto query = prefetch_ != nullptr ? prefetch_->findByCallidContains(ev.callid)
+                                      : ts_.findByCallidContains(ev.callid);
+    auto found = co_await query;
     if (!found) {
         co_return aid::plumbing::unexpected{found.error()};
     }
@@ -88,20 +92,19 @@ Task<Result<void>> HandleTransferCall::run(const aid::TransferCall& ev) {
     // Step 4: record the transferred-to operator in the callHandler CSV (dedup +
     // concurrency-safe merge inside the adapter). Visibility mechanism that
     // survives non-membership; a failure propagates so the WAL can replay.
-    auto recorded = co_await ts_.addCallHandler(id, newUser);
+    auto recorded = co_await ts_.addCallHandlerAndGet(id, newUser);
     if (!recorded) {
         co_return aid::plumbing::unexpected{recorded.error()};
     }
 
-    // Step 5: push the live delta. Re-fetch so the entry reflects the
-    // authoritative post-PATCH state — lockVersion after BOTH the save and the
-    // callHandler merge, and the callHandlers CSV recipientsFor targets (so the
-    // transferred-to operator reaches their own dashboard even cross-project). A
-    // failed re-fetch is non-fatal: the save already succeeded.
-    auto fresh = co_await ts_.fetchById(id);
-    if (fresh.has_value()) {
+    // Step 5: push the live delta from the post-merge ticket the merge returned
+    // — lockVersion after BOTH the save and the callHandler merge, and the
+    // callHandlers CSV recipientsFor targets (so the transferred-to operator
+    // reaches their own dashboard even cross-project). A merged-but-unreadable
+    // ticket (nullopt) is non-fatal: the writes already succeeded.
+    if (recorded->has_value()) {
         TicketDeltaEmitter emitter{ts_, ui_};
-        (void)co_await emitter.emitTicketDelta(std::move(*fresh));
+        (void)co_await emitter.emitTicketDelta(std::move(**recorded));
     }
     co_return Result<void>{};
 }
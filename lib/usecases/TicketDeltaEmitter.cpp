@@ -40,10 +40,13 @@ Task<Result<void>> TicketDeltaEmitter::emitTicketDelta(aid::Ticket ticket) {
     const bool onDashboard =
         ticket.status == aid::TicketStatus::New || ticket.status == aid::TicketStatus::InProgress;
 
-    for (const auto& viewer : *recipients) {
-        if (onDashboard) {
-            ui_.pushTicketUpsert(viewer, ts_.buildEntry(ticket, viewer));
-        } else {
+    if (onDashboard) {
+        // One projection for all recipients: the viewer-independent part is
+        // built (and serialized, by the WebSocket hub) once, and each viewer
+        // only adds its activeCallForViewer / otherActiveUsers overlay.
+        ui_.pushTicketUpserts(ts_.buildEntries(ticket, *recipients));
+    } else {
+        for (const auto& viewer : *recipients) {
             ui_.pushTicketRemove(viewer, ticket.id, ticket.lockVersion);
         }
     }
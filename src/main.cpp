@@ -44,6 +44,7 @@
 #include "aid/auth/SessionRepo.h"
 #include "aid/auth/UserGate.h"
 #include "aid/auth/UserRepo.h"
+#include "aid/controllers/AdminController.h"
 #include "aid/controllers/CallController.h"
 #include "aid/controllers/HealthController.h"
 #include "aid/controllers/LoginController.h"
@@ -55,6 +56,7 @@
 #include "aid/crosscutting/Config.h"
 #include "aid/crosscutting/CorrelationId.h"
 #include "aid/crosscutting/Logger.h"
+#include "aid/infrastructure/AddressBookRefresher.h"
 #include "aid/infrastructure/HealthService.h"
 #include "aid/infrastructure/Mailbox.h"
 #include "aid/infrastructure/MembershipReconciler.h"
@@ -68,6 +70,7 @@
 #include "aid/ports/AddressBook.h"
 #include "aid/ports/TicketStore.h"
 #include "aid/usecases/AppendComment.h"
+#include "aid/usecases/CallPrefetch.h"
 #include "aid/usecases/CloseTicket.h"
 #include "aid/usecases/GetDashboard.h"
 #include "aid/usecases/HandleAcceptedCall.h"
@@ -94,6 +97,7 @@ using aid::auth::PasswordHasher;
 using aid::auth::ResetGrantStore;
 using aid::auth::SessionRepo;
 using aid::auth::UserRepo;
+using aid::controllers::AdminController;
 using aid::controllers::CallController;
 using aid::controllers::HealthController;
 using aid::controllers::LoginController;
@@ -106,6 +110,7 @@ using aid::crosscutting::CorrelationId;
 using aid::crosscutting::Logger;
 using aid::crosscutting::LogLevel;
 using aid::crosscutting::RealClock;
+using aid::infrastructure::AddressBookRefresher;
 using aid::infrastructure::checkPluginAbiLayoutTag;
 using aid::infrastructure::checkPluginApiVersion;
 using aid::infrastructure::checkPluginContractTag;
@@ -123,6 +128,7 @@ using aid::plumbing::unexpected;
 using aid::ports::AddressBook;
 using aid::ports::TicketStore;
 using aid::usecases::AppendComment;
+using aid::usecases::CallPrefetch;
 using aid::usecases::CloseTicket;
 using aid::usecases::GetDashboard;
 using aid::usecases::HandleAcceptedCall;
@@ -510,13 +516,50 @@ int main(int argc, char** argv) {
         return 1;
     }
 
+    // Per-event-type time budgets (optional EventBudgets section). Each event
+    // carries its deadline from enqueue through the use case into every
+    // upstream request, prefetched reads included; 0 leaves that event type
+    // unbudgeted.
+    auto budgetsCfg = cfg->eventBudgets();
+    if (!budgetsCfg) {
+        Logger::instance().fatal(budgetsCfg.error().message);
+        return 1;
+    }
+    Mailbox::Budgets budgets;
+    budgets.incoming = std::chrono::milliseconds{budgetsCfg->incomingMs};
+    budgets.outgoing = std::chrono::milliseconds{budgetsCfg->outgoingMs};
+    budgets.accepted = std::chrono::milliseconds{budgetsCfg->acceptedMs};
+    budgets.transfer = std::chrono::milliseconds{budgetsCfg->transferMs};
+    budgets.hangup = std::chrono::milliseconds{budgetsCfg->hangupMs};
+
+    // Ingest-time prefetch (top-level callPrefetchMs; 0 = off): CallController
+    // posts each logged event to begin() on the domain loop, and the call use
+    // cases take their contact / callid lookups from it. Its reads need not
+    // have a mailbox worker awaiting them (expired, or the event got a 503),
+    // so the shutdown drain does not cover them: main's tail calls drain()
+    // until they have finished, before the plugins' releaseInstance().
+    auto prefetchMs = cfg->callPrefetchMs();
+    if (!prefetchMs) {
+        Logger::instance().fatal(prefetchMs.error().message);
+        return 1;
+    }
+    std::optional<CallPrefetch> prefetch;
+    if (*prefetchMs > 0) {
+        prefetch.emplace(*ticketStorePlugin.get(), *addressBookPlugin.get(), clock,
+                         std::chrono::milliseconds{*prefetchMs},
+                         [budgets](const aid::CallEvent& ev) {
+                             return Mailbox::budgetFor(budgets, ev);
+                         });
+    }
+    CallPrefetch* const prefetchPtr = prefetch ? &*prefetch : nullptr;
+
     HandleIncomingCall incoming{*ticketStorePlugin.get(), *addressBookPlugin.get(), wsHub, clock,
-                                *routing};
+                                *routing, prefetchPtr};
     HandleOutgoingCall outgoing{*ticketStorePlugin.get(), *addressBookPlugin.get(), wsHub, clock,
-                                *routing};
-    HandleAcceptedCall accepted{*ticketStorePlugin.get(), wsHub, clock};
-    HandleTransferCall transfer{*ticketStorePlugin.get(), wsHub};
-    HandleHangup hangup{*ticketStorePlugin.get(), wsHub, clock};
+                                *routing, prefetchPtr};
+    HandleAcceptedCall accepted{*ticketStorePlugin.get(), wsHub, clock, prefetchPtr};
+    HandleTransferCall transfer{*ticketStorePlugin.get(), wsHub, prefetchPtr};
+    HandleHangup hangup{*ticketStorePlugin.get(), wsHub, clock, prefetchPtr};
     GetDashboard dashboard{*ticketStorePlugin.get(), *addressBookPlugin.get()};
     AppendComment comment{*ticketStorePlugin.get(), wsHub};
     CloseTicket closeTk{*ticketStorePlugin.get(), wsHub};
@@ -556,7 +599,7 @@ int main(int argc, char** argv) {
         co_return co_await hangup.run(ev);
     };
     Mailbox mailbox{*domainLoop.get(), wal, Logger::instance(), std::move(handlers),
-                    &CallController::decodeJson};
+                    &CallController::decodeJson, budgets};
 
     // -------- 8. WAL replay BEFORE listeners open (at-least-once). --------
     // enqueueReplay posts work onto the domain loop; the loop isn't spinning
@@ -612,7 +655,9 @@ int main(int argc, char** argv) {
             co_return co_await emitter.emitWebhookDelta(std::move(wd));
         };
         webhookMailbox.emplace(*domainLoop.get(), *webhookWal, Logger::instance(),
-                               std::move(handler), &WebhookController::ticketIdOf);
+                               std::move(handler), &WebhookController::ticketIdOf,
+                               std::chrono::milliseconds{budgetsCfg->webhookMs},
+                               &WebhookController::lockVersionOf);
 
         for (auto& rec : webhookWal->readAll()) {
             webhookMailbox->enqueueReplay(rec);
@@ -662,10 +707,18 @@ int main(int argc, char** argv) {
     // -------- 10. Register controllers + filter + listeners. --------
     UiStreamController::install(wsHub, Logger::instance(), cid);
 
-    auto callCtl = std::make_shared<CallController>(wal, mailbox, Logger::instance(), cid);
+    CallController::Prefetch prefetchHook;
+    if (prefetch) {
+        prefetchHook = [&prefetch, loop = domainLoop.get()](const aid::CallEvent& ev) {
+            loop->queueInLoop([&prefetch, ev] { prefetch->begin(ev); });
+        };
+    }
+    auto callCtl = std::make_shared<CallController>(wal, mailbox, Logger::instance(), cid,
+                                                    std::move(prefetchHook));
     auto uiCtl =
         std::make_shared<UiController>(dashboard, comment, closeTk, cid, Logger::instance());
     auto healthCtl = std::make_shared<HealthController>(health);
+    auto adminCtl = std::make_shared<AdminController>(*addressBookPlugin.get(), Logger::instance());
     auto loginCtl = std::make_shared<LoginController>(authService, resetGrants, Logger::instance(),
                                                       cid, *authCfg);
 
@@ -704,6 +757,14 @@ int main(int argc, char** argv) {
                                   },
                                   {drogon::Get});
 
+    // /admin/contacts/flush → AdminController. Loopback-only: an operator runs
+    // it on the host after editing the books.
+    drogon::app().registerHandler("/admin/contacts/flush",
+                                  [adminCtl](const HttpRequestPtr& req, HttpCallback&& cb) {
+                                      adminCtl->postContactsFlush(req, std::move(cb));
+                                  },
+                                  {drogon::Post});
+
     // /ui/login → LoginController, no SessionGuard (this is how you get a session).
     drogon::app().registerHandler("/ui/login",
                                   [loginCtl](const HttpRequestPtr& req, HttpCallback&& cb) {
@@ -812,14 +873,15 @@ int main(int argc, char** argv) {
         drogon::app().setStaticFilesCacheTime(0);
 
         // setDefaultHandler runs ONLY after the registered handlers (/ui/*,
-        // /health, /call) and the static-file router both miss — so it cannot
+        // /health, /call, /admin/*) and the static-file router both miss — so it cannot
         // shadow them. Serve index.html for unknown GET routes that are not
         // API/event paths, so reloading a client-router deep link like /login
         // renders the SPA instead of 404.
         drogon::app().setDefaultHandler([docRoot](const HttpRequestPtr& req, HttpCallback&& cb) {
             const std::string& path = req->path();
             const bool isApi = path == "/health" || path == "/call" || path == "/ui" ||
-                               path.rfind("/ui/", 0) == 0 || path.rfind("/hook/", 0) == 0;
+                               path.rfind("/ui/", 0) == 0 || path.rfind("/hook/", 0) == 0 ||
+                               path.rfind("/admin/", 0) == 0;
             if (req->method() != drogon::Get || isApi) {
                 auto resp = drogon::HttpResponse::newHttpResponse();
                 resp->setStatusCode(drogon::k404NotFound);
@@ -872,6 +934,16 @@ int main(int argc, char** argv) {
         Logger::instance().info("membership reconciler disabled (membershipPollIntervalSec=0)");
     }
 
+    // -------- Address-book refresher. --------
+    // Keeps the address-book plugin's local copy of its books current
+    // (AddressBook::refreshContacts) so lookups answer without a round-trip.
+    // One refresh right away, then every minute, each on the domain loop.
+    // Same lifetime rules as the reconciler above: top-level scope, stopped in
+    // the teardown tail before the plugin is released.
+    AddressBookRefresher addressBookRefresher{*domainLoop.get(), *addressBookPlugin.get(),
+                                              Logger::instance()};
+    addressBookRefresher.start();
+
     // -------- 11. Hourly session prune. --------
     drogon::app().getLoop()->runEvery(3600.0, [&sessionRepo]() {
         if (auto r = sessionRepo.prune(); r && *r > 0) {
@@ -995,6 +1067,24 @@ int main(int argc, char** argv) {
     if (membershipReconciler) {
         membershipReconciler->stop();
     }
+    // Same for the address-book refresher: a refresh may be suspended in the
+    // plugin's HttpClient on the domain loop.
+    addressBookRefresher.stop();
+    // And for the call prefetch: drain() cancels the plugins' requests while a
+    // read it started is still in flight; wait on the domain loop until none
+    // is, so no fill() resumes on a released plugin.
+    if (prefetch) {
+        for (;;) {
+            std::promise<bool> idle;
+            auto fut = idle.get_future();
+            domainLoop.get()->queueInLoop(
+                [&prefetch, &idle]() { idle.set_value(prefetch->drain()); });
+            if (fut.get()) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        }
+    }
 
     // Ordered teardown. Several objects queue cleanup onto the
     // domain EventLoop from their destructors (the plugins' HttpClients and
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string>
+
+#include "aid/adapters/davical/internal/CanonicalMemo.h"
+#include "aid/value-types/Ids.h"
+
+using aid::PhoneNumber;
+using aid::adapters::davical::internal::CanonicalMemo;
+
+TEST(CanonicalMemo, RemembersBothOutcomesAndCountsLookups) {
+    CanonicalMemo memo;
+    EXPECT_FALSE(memo.lookup("DE", "0170 1234567").has_value());
+    memo.record("DE", "0170 1234567", PhoneNumber{"+491701234567"});
+    memo.record("DE", "anonymous", PhoneNumber{});
+
+    EXPECT_EQ(memo.lookup("DE", "0170 1234567"), PhoneNumber{"+491701234567"});
+    EXPECT_EQ(memo.lookup("DE", "anonymous"), PhoneNumber{});
+    EXPECT_EQ(memo.stats().hits, 2U);
+    EXPECT_EQ(memo.stats().misses, 1U);
+}
+
+// A national-format string is only remembered for the region it was parsed
+// under.
+TEST(CanonicalMemo, IsKeyedByRegion) {
+    CanonicalMemo memo;
+    memo.record("DE", "030 1234567", PhoneNumber{"+49301234567"});
+    EXPECT_FALSE(memo.lookup("AT", "030 1234567").has_value());
+    EXPECT_TRUE(memo.lookup("DE", "030 1234567").has_value());
+}
+
+// The E.164 result is its own canonical form: it hits without ever having
+// been looked up raw. An empty result seeds nothing.
+TEST(CanonicalMemo, SeedsTheCanonicalFormAsAFixedPoint) {
+    CanonicalMemo memo;
+    memo.record("DE", "0170 1234567", PhoneNumber{"+491701234567"});
+    memo.record("DE", "<unknown>", PhoneNumber{});
+    EXPECT_EQ(memo.lookup("DE", "+491701234567"), PhoneNumber{"+491701234567"});
+    EXPECT_EQ(memo.size(), 3U);
+}
+
+// Past the cap the least recently used string goes.
+TEST(CanonicalMemo, EvictsTheLeastRecentlyUsed) {
+    CanonicalMemo memo;
+    for (std::size_t i = 0; i < CanonicalMemo::kMaxEntries; ++i) {
+        memo.record("DE", "raw" + std::to_string(i), PhoneNumber{});
+    }
+    ASSERT_TRUE(memo.lookup("DE", "raw0").has_value()); // touch the oldest
+    memo.record("DE", "one more", PhoneNumber{});
+
+    EXPECT_EQ(memo.size(), CanonicalMemo::kMaxEntries);
+    EXPECT_TRUE(memo.lookup("DE", "raw0").has_value());
+    EXPECT_FALSE(memo.lookup("DE", "raw1").has_value());
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <optional>
+#include <string>
+
+#include "aid/adapters/davical/internal/ContactCache.h"
+#include "aid/value-types/Contact.h"
+#include "aid/value-types/Ids.h"
+
+using aid::PhoneNumber;
+using aid::adapters::davical::internal::ContactCache;
+
+namespace {
+
+aid::Contact contact(const std::string& name) {
+    aid::Contact c;
+    c.name = name;
+    return c;
+}
+
+// A clock the test moves by hand.
+struct FakeClock {
+    std::chrono::steady_clock::time_point now{};
+    ContactCache::Clock clock() {
+        return [this] { return now; };
+    }
+};
+
+} // namespace
+
+TEST(ContactCache, LookupUnknownIsAMiss) {
+    ContactCache cache;
+    EXPECT_FALSE(cache.lookup(PhoneNumber{"+491701234567"}).has_value());
+}
+
+// A found contact and a cached "no contact" are both hits, with their own TTLs.
+TEST(ContactCache, PositiveAndNegativeEntriesExpireSeparately) {
+    FakeClock clock;
+    ContactCache cache{clock.clock()};
+    const PhoneNumber alice{"+491701234567"};
+    const PhoneNumber unknown{"+493012345678"};
+    cache.record(alice, contact("Alice"), cache.generation());
+    cache.record(unknown, std::nullopt, cache.generation());
+
+    auto hit = cache.lookup(alice);
+    ASSERT_TRUE(hit.has_value());
+    ASSERT_TRUE(hit->has_value());
+    EXPECT_EQ((*hit)->name, "Alice");
+    auto miss = cache.lookup(unknown);
+    ASSERT_TRUE(miss.has_value());
+    EXPECT_FALSE(miss->has_value());
+
+    clock.now += ContactCache::kNegativeTtl;
+    EXPECT_TRUE(cache.lookup(alice).has_value());
+    EXPECT_FALSE(cache.lookup(unknown).has_value());
+
+    clock.now += ContactCache::kPositiveTtl;
+    EXPECT_FALSE(cache.lookup(alice).has_value());
+    EXPECT_EQ(cache.size(), 0U);
+}
+
+// Past the cap the least recently used number goes, not the oldest inserted.
+TEST(ContactCache, EvictsTheLeastRecentlyUsed) {
+    ContactCache cache;
+    for (std::size_t i = 0; i < ContactCache::kMaxEntries; ++i) {
+        cache.record(PhoneNumber{"+49" + std::to_string(1000000 + i)}, std::nullopt,
+                     cache.generation());
+    }
+    ASSERT_TRUE(cache.lookup(PhoneNumber{"+491000000"}).has_value()); // touch the oldest
+    cache.record(PhoneNumber{"+499999999"}, std::nullopt, cache.generation());
+
+    EXPECT_EQ(cache.size(), ContactCache::kMaxEntries);
+    EXPECT_TRUE(cache.lookup(PhoneNumber{"+491000000"}).has_value());
+    EXPECT_FALSE(cache.lookup(PhoneNumber{"+491000001"}).has_value());
+}
+
+// clear() empties the cache and stops a lookup that was in flight across it from
+// writing its pre-flush answer back.
+TEST(ContactCache, ClearDropsEntriesAndInFlightResults) {
+    ContactCache cache;
+    const PhoneNumber alice{"+491701234567"};
+    cache.record(alice, contact("Alice"), cache.generation());
+    const auto since = cache.generation();
+    cache.clear();
+    EXPECT_FALSE(cache.lookup(alice).has_value());
+
+    cache.record(alice, contact("Alice (old)"), since);
+    EXPECT_FALSE(cache.lookup(alice).has_value());
+    cache.record(alice, contact("Alice"), cache.generation());
+    EXPECT_TRUE(cache.lookup(alice).has_value());
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "aid/adapters/davical/internal/ContactMirror.h"
+#include "aid/value-types/Contact.h"
+#include "aid/value-types/Ids.h"
+
+using aid::PhoneNumber;
+using aid::adapters::davical::internal::ContactMirror;
+using Book = ContactMirror::Book;
+
+namespace {
+
+constexpr std::size_t kExtension = 5;
+
+aid::Contact contact(const std::string& name, std::vector<std::string> tels) {
+    aid::Contact c;
+    c.name = name;
+    for (auto& t : tels) {
+        c.phoneNumbers.push_back(PhoneNumber{std::move(t)});
+    }
+    return c;
+}
+
+// The name of the contact a warm mirror answers with, or "" for "no contact".
+std::string nameFor(const ContactMirror& mirror, const std::string& number) {
+    const auto hit = mirror.lookup(PhoneNumber{number}, kExtension);
+    EXPECT_TRUE(hit.has_value()) << "mirror is cold";
+    if (!hit || !hit->has_value()) {
+        return {};
+    }
+    return (*hit)->name;
+}
+
+} // namespace
+
+TEST(ContactMirror, ColdUntilBothBooksAreInstalled) {
+    ContactMirror mirror;
+    EXPECT_FALSE(mirror.lookup(PhoneNumber{"+491701234567"}, kExtension).has_value());
+    mirror.install(Book::Addresses, {contact("Alice", {"+491701234567"})}, "a1",
+                   mirror.generation());
+    EXPECT_FALSE(mirror.lookup(PhoneNumber{"+491701234567"}, kExtension).has_value());
+    mirror.install(Book::Companies, {}, std::nullopt, mirror.generation());
+    EXPECT_EQ(nameFor(mirror, "+491701234567"), "Alice");
+    EXPECT_EQ(mirror.ctag(Book::Addresses), std::optional<std::string>{"a1"});
+    EXPECT_EQ(mirror.ctag(Book::Companies), std::nullopt);
+}
+
+// Person pass: exact TEL only, the first contact on a tie, stamped Person.
+TEST(ContactMirror, PersonPassIsAnExactMatch) {
+    ContactMirror mirror;
+    mirror.install(Book::Addresses,
+                   {contact("Alice", {"+4930111", "+491701234567"}),
+                    contact("Alias", {"+491701234567"})},
+                   std::nullopt, mirror.generation());
+    mirror.install(Book::Companies, {}, std::nullopt, mirror.generation());
+
+    const auto hit = mirror.lookup(PhoneNumber{"+491701234567"}, kExtension);
+    ASSERT_TRUE(hit.has_value() && hit->has_value());
+    EXPECT_EQ((*hit)->name, "Alice");
+    EXPECT_EQ((*hit)->kind, aid::AddressKind::Person);
+    EXPECT_EQ(nameFor(mirror, "+49170123456"), "") << "a prefix is not a person match";
+    EXPECT_EQ(nameFor(mirror, "+4917012345678"), "") << "nor is a superstring";
+}
+
+// Company pass: the TEL must share the number minus its extension; the
+// longest common prefix wins, the first company on a tie.
+TEST(ContactMirror, CompanyPassPicksTheLongestCommonPrefix) {
+    ContactMirror mirror;
+    mirror.install(Book::Addresses, {}, std::nullopt, mirror.generation());
+    mirror.install(Book::Companies,
+                   {contact("Acme", {"+49304321"}), contact("Acme Sales", {"+493043219"}),
+                    contact("Acme Twin", {"+49304321"}), contact("Other", {"+4989 1234"})},
+                   std::nullopt, mirror.generation());
+
+    const auto hit = mirror.lookup(PhoneNumber{"+4930432100000"}, kExtension);
+    ASSERT_TRUE(hit.has_value() && hit->has_value());
+    EXPECT_EQ((*hit)->name, "Acme");
+    EXPECT_EQ((*hit)->kind, aid::AddressKind::Company);
+    EXPECT_EQ(nameFor(mirror, "+4930432190000"), "Acme Sales");
+    EXPECT_EQ(nameFor(mirror, "+4930432199"), "Acme Sales")
+        << "a longer TEL may still share the head";
+    EXPECT_EQ(nameFor(mirror, "+4930431100000"), "") << "the head +4930431 is not shared";
+    EXPECT_EQ(nameFor(mirror, "+49891234000"), "")
+        << "a TEL with a space is indexed only up to it";
+    EXPECT_EQ(nameFor(mirror, "+4930"), "") << "no longer than the extension";
+}
+
+// A flush empties the mirror, and a download that started before it is dropped.
+TEST(ContactMirror, ClearGoesColdAndDropsAnInstallFromBefore) {
+    ContactMirror mirror;
+    mirror.install(Book::Addresses, {contact("Alice", {"+491701234567"})}, "a1",
+                   mirror.generation());
+    mirror.install(Book::Companies, {}, "c1", mirror.generation());
+    const auto before = mirror.generation();
+
+    mirror.clear();
+    EXPECT_FALSE(mirror.lookup(PhoneNumber{"+491701234567"}, kExtension).has_value());
+    EXPECT_EQ(mirror.ctag(Book::Addresses), std::nullopt);
+
+    mirror.install(Book::Addresses, {contact("Alice", {"+491701234567"})}, "a1", before);
+    EXPECT_EQ(mirror.ctag(Book::Addresses), std::nullopt);
+    mirror.install(Book::Addresses, {}, "a2", mirror.generation());
+    EXPECT_EQ(mirror.ctag(Book::Addresses), std::optional<std::string>{"a2"});
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <system_error>
+
+#include "aid/adapters/davical/internal/ContactSnapshot.h"
+#include "aid/adapters/davical/internal/SnapshotWriter.h"
+#include "aid/value-types/Contact.h"
+#include "aid/value-types/Ids.h"
+
+using aid::adapters::davical::internal::ContactSnapshot;
+using aid::adapters::davical::internal::Snapshot;
+using aid::adapters::davical::internal::SnapshotWriter;
+
+namespace {
+
+Snapshot sample() {
+    aid::Contact alice;
+    alice.name = "Alice";
+    alice.companyName = "Example GmbH";
+    alice.phoneNumbers = {aid::PhoneNumber{"+491701234567"}, aid::PhoneNumber{"+4930111"}};
+    alice.projectIds = {aid::ProjectId{"7"}, aid::ProjectId{"8"}};
+    aid::Contact acme;
+    acme.name = "Acme";
+    acme.phoneNumbers = {aid::PhoneNumber{"+49304321"}};
+
+    Snapshot s;
+    s.bookAddresses = "http://dav/aid/addresses/";
+    s.bookCompanies = "http://dav/aid/companies/";
+    s.addresses.contacts = {alice};
+    s.addresses.ctag = "a1";
+    s.companies.contacts = {acme};
+    return s;
+}
+
+class ContactSnapshotFile : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto pid = static_cast<std::uint64_t>(::getpid());
+        static std::atomic<std::uint64_t> counter{0};
+        const auto n = counter.fetch_add(1, std::memory_order_relaxed);
+        dir_ = std::filesystem::temp_directory_path() /
+               ("aid_contact_snapshot_test_" + std::to_string(pid) + "_" + std::to_string(n));
+        std::filesystem::create_directories(dir_);
+        path_ = dir_ / "contacts.snapshot";
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(dir_, ec);
+    }
+
+    std::filesystem::path dir_;
+    std::filesystem::path path_;
+};
+
+} // namespace
+
+TEST(ContactSnapshot, EncodeDecodeRoundTrips) {
+    const auto decoded = ContactSnapshot::decode(ContactSnapshot::encode(sample()));
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->bookAddresses, "http://dav/aid/addresses/");
+    EXPECT_EQ(decoded->bookCompanies, "http://dav/aid/companies/");
+    EXPECT_EQ(decoded->addresses.ctag, std::optional<std::string>{"a1"});
+    EXPECT_EQ(decoded->companies.ctag, std::nullopt);
+    ASSERT_EQ(decoded->addresses.contacts.size(), 1U);
+    const auto& alice = decoded->addresses.contacts[0];
+    EXPECT_EQ(alice.name, "Alice");
+    EXPECT_EQ(alice.companyName, "Example GmbH");
+    ASSERT_EQ(alice.phoneNumbers.size(), 2U);
+    EXPECT_EQ(alice.phoneNumbers[1].v, "+4930111");
+    ASSERT_EQ(alice.projectIds.size(), 2U);
+    EXPECT_EQ(alice.projectIds[1].v, "8");
+    ASSERT_EQ(decoded->companies.contacts.size(), 1U);
+    EXPECT_EQ(decoded->companies.contacts[0].name, "Acme");
+}
+
+// Every byte matters: a truncation, a flipped bit or a trailing extra byte
+// rejects the whole file rather than yielding a partial mirror.
+TEST(ContactSnapshot, DecodeRejectsDamagedInput) {
+    const auto bytes = ContactSnapshot::encode(sample());
+    EXPECT_FALSE(ContactSnapshot::decode("").has_value());
+    EXPECT_FALSE(ContactSnapshot::decode(bytes.substr(0, bytes.size() - 1)).has_value());
+    EXPECT_FALSE(ContactSnapshot::decode(bytes + "x").has_value());
+    auto flipped = bytes;
+    flipped[bytes.size() / 2] = static_cast<char>(flipped[bytes.size() / 2] ^ 0x01);
+    EXPECT_FALSE(ContactSnapshot::decode(flipped).has_value());
+    auto otherMagic = bytes;
+    otherMagic[0] = 'X';
+    EXPECT_FALSE(ContactSnapshot::decode(otherMagic).has_value());
+}
+
+TEST_F(ContactSnapshotFile, SaveThenLoad) {
+    EXPECT_FALSE(ContactSnapshot::load(path_).has_value()) << "no file yet";
+    ASSERT_TRUE(ContactSnapshot::save(path_, ContactSnapshot::encode(sample())));
+    EXPECT_FALSE(std::filesystem::exists(path_.string() + ".tmp"));
+    const auto loaded = ContactSnapshot::load(path_);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->addresses.contacts.at(0).name, "Alice");
+}
+
+// Names and numbers are nobody else's business: owner-only under any umask,
+// including over a leftover world-readable .tmp from an older build.
+TEST_F(ContactSnapshotFile, SaveIsOwnerOnly) {
+    std::ofstream{path_.string() + ".tmp"} << "stale";
+    std::filesystem::permissions(path_.string() + ".tmp", std::filesystem::perms::all);
+    const ::mode_t old = ::umask(0);
+    const bool saved = ContactSnapshot::save(path_, ContactSnapshot::encode(sample()));
+    ::umask(old);
+    ASSERT_TRUE(saved);
+    const auto perms = std::filesystem::status(path_).permissions();
+    EXPECT_EQ(perms & std::filesystem::perms::all,
+              std::filesystem::perms::owner_read | std::filesystem::perms::owner_write);
+}
+
+TEST_F(ContactSnapshotFile, LoadRejectsGarbage) {
+    std::ofstream{path_} << "not a snapshot";
+    EXPECT_FALSE(ContactSnapshot::load(path_).has_value());
+}
+
+// The writer keeps only the latest snapshot and writes it off the caller's
+// thread; destruction flushes what is still pending.
+TEST_F(ContactSnapshotFile, WriterWritesTheLatestSnapshot) {
+    {
+        SnapshotWriter writer{path_};
+        writer.schedule(sample());
+        writer.drain();
+        ASSERT_TRUE(ContactSnapshot::load(path_).has_value());
+
+        auto next = sample();
+        next.addresses.ctag = "a2";
+        writer.schedule(next);
+    }
+    const auto loaded = ContactSnapshot::load(path_);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->addresses.ctag, std::optional<std::string>{"a2"});
+}
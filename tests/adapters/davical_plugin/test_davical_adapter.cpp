@@ -16,19 +16,24 @@
 #include <coroutine>
 #include <cstdint>
 #include <cstring>
+#include <filesystem>
 #include <functional>
 #include <future>
+#include <iostream>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "aid/adapters/davical/DaviCalAdapter.h"
 #include "aid/infrastructure/HttpClient.h"
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Error.h"
 #include "aid/plumbing/Result.h"
 #include "aid/plumbing/Task.h"
@@ -88,6 +93,19 @@ private:
            "<d:multistatus xmlns:d=\"DAV:\"/>";
 }
 
+// A multistatus that also carries the collection's CTag. PathRouterServer
+// answers every method on a path with one body, so the same text serves as
+// both the refresh's PROPFIND reply and its REPORT download.
+[[nodiscard]] std::string withCtag(std::string multistatus, std::string_view ctag) {
+    const std::string close = "</d:multistatus>";
+    multistatus.insert(multistatus.rfind(close),
+                       "<d:response><d:propstat><d:prop>"
+                       "<cs:getctag xmlns:cs=\"http://calendarserver.org/ns/\">" +
+                           std::string{ctag} +
+                           "</cs:getctag></d:prop></d:propstat></d:response>");
+    return multistatus;
+}
+
 // Path-router HTTP server. Maps incoming request paths to canned
 // response bodies (all 207 Multi-Status). The DaviCal adapter posts
 // REPORTs against two distinct paths (addresses + companies); the
@@ -379,6 +397,60 @@ INSTANTIATE_TEST_SUITE_P(SpecCoverage, CanonicalizeMatrix,
                              // Single digit is not a possible phone number in any region.
                              CanonRow{"1", "DE", ""}));
 
+// A repeat is answered by the memo with the same result, and so is the E.164
+// form of a number canonicalised before.
+TEST_F(DaviCalAdapterTest, CanonicalizeIsMemoised) {
+    auto adapter = makeAdapter(1, configFor());
+    EXPECT_EQ(adapter->canonicalize(aid::PhoneNumber{"0170 123 4567"}).v, "+491701234567");
+    EXPECT_EQ(adapter->canonicalize(aid::PhoneNumber{"0170 123 4567"}).v, "+491701234567");
+    EXPECT_EQ(adapter->canonicalize(aid::PhoneNumber{"+491701234567"}).v, "+491701234567");
+    EXPECT_EQ(adapter->canonicalize(aid::PhoneNumber{"anonymous"}).v, "");
+    EXPECT_EQ(adapter->canonicalize(aid::PhoneNumber{"anonymous"}).v, "");
+    EXPECT_EQ(adapter->canonicalizeStats().hits, 3U);
+    EXPECT_EQ(adapter->canonicalizeStats().misses, 2U);
+}
+
+// Not a pass/fail test: canonicalize() over the spellings a PBX hands us,
+// first pass (libphonenumber) against the memoised passes after it. Run with
+// --gtest_also_run_disabled_tests.
+TEST_F(DaviCalAdapterTest, DISABLED_CanonicalizeBenchmark) {
+    // National, spaced international, 00-prefixed, PBX punctuation and
+    // already-E.164 spellings; small enough that the memo holds them all.
+    std::vector<std::string> mix;
+    for (int i = 0; i < 300; ++i) {
+        const auto n = std::to_string(1000000 + i);
+        mix.push_back("0170" + n);
+        mix.push_back("+49 30 " + n);
+        mix.push_back("0049 40 " + n);
+        mix.push_back("030/" + n.substr(0, 4) + "-" + n.substr(4));
+        mix.push_back("+4989" + n);
+    }
+    mix.emplace_back("anonymous");
+    mix.emplace_back("<unknown>");
+    mix.emplace_back("21"); // internal extension
+
+    auto adapter = makeAdapter(1, configFor());
+    const auto pass = [&] {
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& raw : mix) {
+            (void)adapter->canonicalize(aid::PhoneNumber{raw});
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now() - start)
+            .count();
+    };
+    const auto cold = pass();
+    std::int64_t warm = 0;
+    constexpr int kWarmPasses = 10;
+    for (int i = 0; i < kWarmPasses; ++i) {
+        warm += pass();
+    }
+    const auto stats = adapter->canonicalizeStats();
+    std::cout << mix.size() << " numbers: first pass " << cold << " us, memoised pass "
+              << warm / kWarmPasses << " us (hits " << stats.hits << ", misses " << stats.misses
+              << ")\n";
+}
+
 // ─── lookup() pipeline ─────────────────────────────────────────────────
 
 TEST_F(DaviCalAdapterTest, LookupExactMatchReturnsPersonAndDoesNotHitCompaniesBook) {
@@ -520,6 +592,224 @@ TEST_F(DaviCalAdapterTest, LookupExactStepRejectsSuperstringAndFallsThroughToCom
     EXPECT_EQ(srv.requestCount(), 2) << "exact step must not short-circuit on a superstring hit";
 }
 
+// concurrentLookups sends both REPORTs up front; the person hit still wins
+// over a company that matches too, and a person miss falls to the company.
+TEST_F(DaviCalAdapterTest, ConcurrentLookupsQueryBothBooksAndPreferThePerson) {
+    PathRouterServer srv({
+        {"addresses", canonicalMultistatus("Alice", "ExampleGmbH", "+491701234567", "42")},
+        {"companies", canonicalMultistatus("Example Co.", "ExampleGmbH", "+491701234", "99")},
+    });
+    auto cfg = configForWithBookPaths();
+    cfg.concurrentLookups = true;
+    auto adapter = makeAdapter(srv.port(), cfg);
+    const auto lookup = [&](std::string number) {
+        return runResult<std::optional<aid::Contact>>(
+            [&] { return adapter->lookup(aid::PhoneNumber{number}); });
+    };
+
+    auto person = lookup("+491701234567");
+    ASSERT_TRUE(person.has_value()) << person.error().message;
+    ASSERT_TRUE(person->has_value());
+    EXPECT_EQ((*person)->name, "Alice");
+    EXPECT_EQ((*person)->kind, aid::AddressKind::Person);
+    EXPECT_EQ(srv.requestCount(), 2) << "both books are asked at once";
+
+    auto company = lookup("+491701234999");
+    ASSERT_TRUE(company.has_value()) << company.error().message;
+    ASSERT_TRUE(company->has_value());
+    EXPECT_EQ((*company)->name, "Example Co.");
+    EXPECT_EQ((*company)->kind, aid::AddressKind::Company);
+    EXPECT_EQ(srv.requestCount(), 4);
+}
+
+// A repeat lookup is served from the ContactCache, misses included, until
+// flushContactCache() drops it.
+TEST_F(DaviCalAdapterTest, LookupIsCachedUntilFlushed) {
+    PathRouterServer srv({
+        {"addresses", canonicalMultistatus("Alice", "ExampleGmbH", "+491701234567", "42")},
+        {"companies", emptyMultistatus()},
+    });
+    auto cfg = configForWithBookPaths();
+    auto adapter = makeAdapter(srv.port(), cfg);
+    const auto lookup = [&](std::string number) {
+        return runResult<std::optional<aid::Contact>>(
+            [&] { return adapter->lookup(aid::PhoneNumber{number}); });
+    };
+
+    ASSERT_TRUE(lookup("+491701234567").has_value());
+    auto again = lookup("+491701234567");
+    ASSERT_TRUE(again.has_value()) << again.error().message;
+    ASSERT_TRUE(again->has_value());
+    EXPECT_EQ((*again)->name, "Alice");
+    EXPECT_EQ(srv.requestCount(), 1) << "the repeat must not reach the address book";
+
+    ASSERT_TRUE(lookup("+493012345678").has_value()); // unknown: both books
+    ASSERT_TRUE(lookup("+493012345678").has_value());
+    EXPECT_EQ(srv.requestCount(), 3) << "a miss is cached too";
+
+    adapter->flushContactCache();
+    ASSERT_TRUE(lookup("+491701234567").has_value());
+    EXPECT_EQ(srv.requestCount(), 4);
+}
+
+// Lookups of one number that overlap share a single pass over the books.
+TEST_F(DaviCalAdapterTest, ConcurrentLookupsOfOneNumberShareTheRequests) {
+    PathRouterServer srv({
+        {"addresses", canonicalMultistatus("Alice", "ExampleGmbH", "+491701234567", "42")},
+        {"companies", emptyMultistatus()},
+    });
+    auto cfg = configForWithBookPaths();
+    auto adapter = makeAdapter(srv.port(), cfg);
+
+    auto r = runResult<std::optional<aid::Contact>>(
+        [&]() -> aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Contact>>> {
+            // Both start before either is awaited: the second joins the first.
+            auto first = adapter->lookup(aid::PhoneNumber{"+491701234567"});
+            auto second = adapter->lookup(aid::PhoneNumber{"+491701234567"});
+            auto a = co_await first;
+            auto b = co_await second;
+            if (!a || !b || !a->has_value() || !b->has_value() || (*a)->name != (*b)->name) {
+                co_return aid::plumbing::unexpected{aid::plumbing::Error{
+                    aid::plumbing::ErrorCode::InvalidInput, "lookups disagree", std::nullopt}};
+            }
+            co_return a;
+        });
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    EXPECT_EQ((*r)->name, "Alice");
+    EXPECT_EQ(srv.requestCount(), 1);
+}
+
+// A lookup that joins one in flight is resumed under its own event's deadline,
+// not the leader's.
+TEST_F(DaviCalAdapterTest, JoinedLookupResumesUnderItsOwnDeadline) {
+    using LookupTask = aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Contact>>>;
+    PathRouterServer srv({
+        {"addresses", canonicalMultistatus("Alice", "ExampleGmbH", "+491701234567", "42")},
+        {"companies", emptyMultistatus()},
+    });
+    auto cfg = configForWithBookPaths();
+    auto adapter = makeAdapter(srv.port(), cfg);
+    const auto leaderBudget = aid::plumbing::DeadlineClock::now() + std::chrono::seconds{60};
+    const auto joinerBudget = aid::plumbing::DeadlineClock::now() + std::chrono::seconds{120};
+
+    std::optional<aid::plumbing::Deadline> seen;
+    auto r = runResult<std::optional<aid::Contact>>([&]() -> LookupTask {
+        auto observe = [](LookupTask joined,
+                          std::optional<aid::plumbing::Deadline>& out) -> LookupTask {
+            auto res = co_await joined;
+            out = aid::plumbing::currentDeadline();
+            co_return res;
+        };
+        auto first = [&] {
+            const aid::plumbing::DeadlineScope scope{leaderBudget};
+            return adapter->lookup(aid::PhoneNumber{"+491701234567"});
+        }();
+        auto second = [&] {
+            const aid::plumbing::DeadlineScope scope{joinerBudget};
+            return observe(adapter->lookup(aid::PhoneNumber{"+491701234567"}), seen);
+        }();
+        auto a = co_await first;
+        (void)co_await second;
+        co_return a;
+    });
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    EXPECT_EQ(seen, joinerBudget);
+}
+
+// Once refreshContacts() has mirrored both books, lookups make no requests;
+// a refresh under an unchanged CTag is one PROPFIND per book, and a flush
+// sends lookups back to DaviCal until the next refresh.
+TEST_F(DaviCalAdapterTest, RefreshedMirrorServesLookupsWithoutRequests) {
+    PathRouterServer srv({
+        {"addresses",
+         withCtag(canonicalMultistatus("Alice", "ExampleGmbH", "+491701234567", "42"), "a1")},
+        {"companies", withCtag(canonicalMultistatus("Acme", "Acme", "+49304321", "7"), "c1")},
+    });
+    auto cfg = configForWithBookPaths();
+    auto adapter = makeAdapter(srv.port(), cfg);
+    const auto lookup = [&](std::string number) {
+        return runResult<std::optional<aid::Contact>>(
+            [&] { return adapter->lookup(aid::PhoneNumber{number}); });
+    };
+
+    auto refreshed = runResult<void>([&] { return adapter->refreshContacts(); });
+    ASSERT_TRUE(refreshed.has_value()) << refreshed.error().message;
+    EXPECT_EQ(srv.requestCount(), 4) << "a CTag PROPFIND and a download per book";
+    EXPECT_NE(srv.lastBodyFor("companies").find("<C:filter/>"), std::string::npos)
+        << "the download is an unfiltered addressbook-query";
+
+    auto person = lookup("+491701234567");
+    ASSERT_TRUE(person.has_value() && person->has_value());
+    EXPECT_EQ((*person)->name, "Alice");
+    EXPECT_EQ((*person)->kind, aid::AddressKind::Person);
+    auto company = lookup("+4930432112345");
+    ASSERT_TRUE(company.has_value() && company->has_value());
+    EXPECT_EQ((*company)->name, "Acme");
+    EXPECT_EQ((*company)->kind, aid::AddressKind::Company);
+    auto unknown = lookup("+493012345678");
+    ASSERT_TRUE(unknown.has_value());
+    EXPECT_FALSE(unknown->has_value());
+    EXPECT_EQ(srv.requestCount(), 4) << "the mirror answers without a REPORT";
+
+    ASSERT_TRUE(runResult<void>([&] { return adapter->refreshContacts(); }).has_value());
+    EXPECT_EQ(srv.requestCount(), 6) << "unchanged CTags skip the downloads";
+
+    adapter->flushContactCache();
+    ASSERT_TRUE(lookup("+491701234567").has_value());
+    EXPECT_EQ(srv.requestCount(), 7) << "a flushed mirror is cold";
+    ASSERT_TRUE(runResult<void>([&] { return adapter->refreshContacts(); }).has_value());
+    EXPECT_EQ(srv.requestCount(), 11) << "and is downloaded in full again";
+}
+
+namespace {
+
+// A DaviCalAdapterTest with a scratch directory for the contact snapshot,
+// removed in TearDown so a failed ASSERT does not leak it.
+class DaviCalAdapterSnapshotTest : public DaviCalAdapterTest {
+protected:
+    void SetUp() override {
+        dir_ = std::filesystem::temp_directory_path() /
+               ("aid_davical_snapshot_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(dir_);
+    }
+    void TearDown() override {
+        DaviCalAdapterTest::TearDown();
+        std::error_code ec;
+        std::filesystem::remove_all(dir_, ec);
+    }
+
+    std::filesystem::path dir_;
+};
+
+} // namespace
+
+// With a snapshotPath, a restarted adapter answers from the mirror its
+// predecessor saved, and its first refresh downloads nothing.
+TEST_F(DaviCalAdapterSnapshotTest, SnapshotWarmsTheMirrorAcrossARestart) {
+    PathRouterServer srv({
+        {"addresses",
+         withCtag(canonicalMultistatus("Alice", "ExampleGmbH", "+491701234567", "42"), "a1")},
+        {"companies", withCtag(canonicalMultistatus("Acme", "Acme", "+49304321", "7"), "c1")},
+    });
+    auto cfg = configForWithBookPaths();
+    cfg.snapshotPath = (dir_ / "contacts.snapshot").string();
+
+    {
+        auto first = makeAdapter(srv.port(), cfg);
+        ASSERT_TRUE(runResult<void>([&] { return first->refreshContacts(); }).has_value());
+    } // destruction flushes the pending snapshot write
+    ASSERT_EQ(srv.requestCount(), 4);
+
+    auto second = makeAdapter(srv.port(), cfg);
+    auto company = runResult<std::optional<aid::Contact>>(
+        [&] { return second->lookup(aid::PhoneNumber{"+4930432112345"}); });
+    ASSERT_TRUE(company.has_value() && company->has_value());
+    EXPECT_EQ((*company)->name, "Acme");
+    EXPECT_EQ(srv.requestCount(), 4) << "served from the snapshot before any refresh";
+    ASSERT_TRUE(runResult<void>([&] { return second->refreshContacts(); }).has_value());
+    EXPECT_EQ(srv.requestCount(), 6) << "the saved CTags are current: PROPFINDs only";
+}
+
 TEST_F(DaviCalAdapterTest, LookupTransportErrorPropagates) {
     // No server bound: HttpClient → NetworkFailure → UpstreamUnavailable.
     auto cfg = configForWithBookPaths();
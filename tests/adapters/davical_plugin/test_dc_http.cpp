@@ -422,4 +422,37 @@ TEST_F(DcHttpTest, Probe405MarksUnreachable) {
     EXPECT_EQ(r.error().code, aid::plumbing::ErrorCode::UpstreamUnavailable);
 }
 
+// --- propfind(): the address-book mirror's CTag read -------------------------
+
+TEST_F(DcHttpTest, PropfindSendsDepth0BodyAndReturnsMultistatus) {
+    FakeReportServer srv{FakeReportServer::with(207, "Multi-Status", "<d:multistatus/>")};
+    aid::infrastructure::HttpClient cli{baseUrl(srv.port()), aid::infrastructure::UpstreamConfig{},
+                                        lt_.loop()};
+    DcHttp dc{cli, "aid", "1234"};
+    const std::string xml = "<?xml version=\"1.0\"?><D:propfind/>";
+    auto r = runResult<std::string>([&] { return dc.propfind("/davical/aid/addresses/", xml); });
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    EXPECT_EQ(*r, "<d:multistatus/>");
+
+    const auto seen = srv.lastRequest();
+    const auto lower = toLower(seen);
+    EXPECT_NE(seen.find("PROPFIND /davical/aid/addresses/"), std::string::npos)
+        << "PROPFIND method-line missing in: [" << seen << "]";
+    EXPECT_NE(lower.find("depth: 0"), std::string::npos)
+        << "Depth: 0 header missing in: [" << seen << "]";
+    EXPECT_NE(lower.find("authorization: basic ywlkojeymzq="), std::string::npos)
+        << "Basic auth missing or wrong in: [" << seen << "]";
+    EXPECT_NE(seen.find(xml), std::string::npos) << "body missing in: [" << seen << "]";
+}
+
+TEST_F(DcHttpTest, Propfind401MapsToUnauthenticated) {
+    FakeReportServer srv{FakeReportServer::with(401, "Unauthorized", "auth failed")};
+    aid::infrastructure::HttpClient cli{baseUrl(srv.port()), aid::infrastructure::UpstreamConfig{},
+                                        lt_.loop()};
+    DcHttp dc{cli, "aid", "wrong"};
+    auto r = runResult<std::string>([&] { return dc.propfind("/davical/aid/", "<x/>"); });
+    ASSERT_FALSE(r.has_value());
+    EXPECT_EQ(r.error().code, aid::plumbing::ErrorCode::Unauthenticated);
+}
+
 } // namespace aid::adapters::davical::internal::test
@@ -19,12 +19,23 @@
 //     FN/ORG/TEL and before the X-CUSTOM1 split, incl. the verbatim
 //     live DaviCal record (`X-CUSTOM1;VALUE=TEXT:7\, 8`) whose escaped
 //     comma used to yield the unusable project id `7\`.
+//   - parseCtag: the PROPFIND getctag value, trimmed; nullopt when the
+//     server reports none.
+//   - parse() (streaming) against parseDom() on every fixture above plus
+//     large generated multistatus bodies: identical contacts, in order.
+//     DISABLED_ParseLargeMultistatusBenchmark times both; run it with
+//     --gtest_also_run_disabled_tests.
 
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "aid/adapters/davical/internal/DcVCardParser.h"
 #include "aid/value-types/Contact.h"
@@ -52,6 +63,64 @@ namespace {
 </d:multistatus>)";
 }
 
+// A companies-book-sized multistatus: `count` responses cycling through a
+// plain card, a folded card with escapes and an entity, a CDATA card, a card
+// without FN (skipped) and an empty address-data.
+[[nodiscard]] std::string largeMultistatus(std::size_t count) {
+    std::string out = R"(<?xml version="1.0" encoding="utf-8"?>
+<d:multistatus xmlns:d="DAV:" xmlns:card="urn:ietf:params:xml:ns:carddav">
+)";
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto n = std::to_string(i);
+        std::string card;
+        switch (i % 5) {
+        case 0:
+            card = "BEGIN:VCARD\r\nFN:Company " + n + "\r\nORG:Org " + n + "\r\nTEL:+4930" + n +
+                   "\r\nX-CUSTOM1:" + n + "\r\nEND:VCARD\r\n";
+            break;
+        case 1:
+            card = "BEGIN:VCARD\r\nFN:Folded\r\n  " + n + " Smith &amp; Sons\r\nORG:A\\, B\r\n" +
+                   "TEL;TYPE=work: +4940" + n + " \r\nTEL:+4941" + n +
+                   "\r\nX-CUSTOM1;VALUE=TEXT:7\\, " + n + "\r\nEND:VCARD\r\n";
+            break;
+        case 2:
+            card = "<![CDATA[BEGIN:VCARD\nFN:Cdata <" + n + ">\nTEL:+4989" + n + "\nEND:VCARD]]>";
+            break;
+        case 3:
+            card = "BEGIN:VCARD\r\nORG:NoName " + n + "\r\nTEL:+4969" + n + "\r\nEND:VCARD\r\n";
+            break;
+        default:
+            break;
+        }
+        out += "  <d:response>\n    <d:href>/aid/companies/" + n +
+               ".vcf</d:href>\n    <d:propstat>\n      <d:prop>\n        <card:address-data>" +
+               card +
+               "</card:address-data>\n      </d:prop>\n      <d:status>HTTP/1.1 200 "
+               "OK</d:status>\n    </d:propstat>\n  </d:response>\n";
+    }
+    out += "</d:multistatus>";
+    return out;
+}
+
+// parse() and parseDom() agree field by field, contact by contact.
+void expectSameAsDom(std::string_view xml) {
+    const auto streamed = DcVCardParser::parse(xml);
+    const auto dom = DcVCardParser::parseDom(xml);
+    ASSERT_EQ(streamed.size(), dom.size());
+    for (std::size_t i = 0; i < dom.size(); ++i) {
+        EXPECT_EQ(streamed[i].name, dom[i].name) << "contact " << i;
+        EXPECT_EQ(streamed[i].companyName, dom[i].companyName) << "contact " << i;
+        ASSERT_EQ(streamed[i].phoneNumbers.size(), dom[i].phoneNumbers.size()) << "contact " << i;
+        for (std::size_t t = 0; t < dom[i].phoneNumbers.size(); ++t) {
+            EXPECT_EQ(streamed[i].phoneNumbers[t].v, dom[i].phoneNumbers[t].v);
+        }
+        ASSERT_EQ(streamed[i].projectIds.size(), dom[i].projectIds.size()) << "contact " << i;
+        for (std::size_t p = 0; p < dom[i].projectIds.size(); ++p) {
+            EXPECT_EQ(streamed[i].projectIds[p].v, dom[i].projectIds[p].v);
+        }
+    }
+}
+
 } // namespace
 
 // ─── DcVCardParser::parse ──────────────────────────────────────────────
@@ -382,4 +451,97 @@ TEST(DcVCardParser, ParseLiveDaviCalCompanyEntryWithTwoProjectIds) {
     EXPECT_EQ(contacts[0].projectIds[1].v, "8");
 }
 
+// ─── parse() vs parseDom() ─────────────────────────────────────────────
+
+TEST(DcVCardParser, StreamingParseMatchesDomOnLargeMultistatus) {
+    const auto xml = largeMultistatus(1000);
+    const auto contacts = DcVCardParser::parse(xml);
+    ASSERT_EQ(contacts.size(), 600U) << "FN-less and empty cards are skipped";
+    EXPECT_EQ(contacts[1].name, "Folded 1 Smith & Sons");
+    EXPECT_EQ(contacts[1].companyName, "A, B");
+    EXPECT_EQ(contacts[2].name, "Cdata <2>");
+    expectSameAsDom(xml);
+}
+
+TEST(DcVCardParser, StreamingParseMatchesDomOnEdgeCases) {
+    expectSameAsDom("");
+    expectSameAsDom("<d:multistatus><d:response>");
+    expectSameAsDom(wrap("BEGIN:VCARD\r\nFN:Alice\r\nTEL:+491701234567\r\nEND:VCARD\r\n"));
+    expectSameAsDom(wrap("BEGIN:VCARD\r\nFN:Undeclared &bogus;\r\nEND:VCARD\r\n"));
+    expectSameAsDom(R"(<d:multistatus xmlns:d="DAV:"><d:address-data>BEGIN:VCARD
+FN:Outer<d:address-data>
+FN:Inner</d:address-data>
+END:VCARD</d:address-data></d:multistatus>)");
+    expectSameAsDom(R"(<?xml version="1.0"?>
+<!DOCTYPE x [<!ENTITY xxe SYSTEM "file:///etc/passwd">]>
+<d:multistatus xmlns:d="DAV:"><d:address-data>FN:&xxe;</d:address-data></d:multistatus>)");
+
+    // Well-formed up to a late error: all or nothing, like the DOM.
+    auto truncated = largeMultistatus(200);
+    truncated.resize(truncated.size() - 40);
+    EXPECT_TRUE(DcVCardParser::parse(truncated).empty());
+    expectSameAsDom(truncated);
+}
+
+// Not a pass/fail test: prints parse() and parseDom() timings on bodies the
+// size of a companies prefix query up to a full-book download.
+TEST(DcVCardParser, DISABLED_ParseLargeMultistatusBenchmark) {
+    for (const std::size_t cards : {100U, 1000U, 10000U}) {
+        const auto xml = largeMultistatus(cards);
+        const auto time = [&](auto&& parse) {
+            constexpr int kRounds = 20;
+            const auto start = std::chrono::steady_clock::now();
+            std::size_t found = 0;
+            for (int r = 0; r < kRounds; ++r) {
+                found += parse(xml).size();
+            }
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            EXPECT_GT(found, 0U);
+            return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() / kRounds;
+        };
+        const auto streamed = time([](std::string_view x) { return DcVCardParser::parse(x); });
+        const auto dom = time([](std::string_view x) { return DcVCardParser::parseDom(x); });
+        std::cout << cards << " cards (" << xml.size() / 1024 << " KiB): parse " << streamed
+                  << " us, parseDom " << dom << " us\n";
+    }
+}
+
+// ─── DcVCardParser::parseCtag ──────────────────────────────────────────
+
+TEST(DcVCardParser, ParseCtagReturnsTrimmedValue) {
+    const auto doc = std::string{R"(<?xml version="1.0" encoding="utf-8"?>
+<d:multistatus xmlns:d="DAV:" xmlns:cs="http://calendarserver.org/ns/">
+  <d:response>
+    <d:href>/aid/addresses/</d:href>
+    <d:propstat>
+      <d:prop>
+        <cs:getctag>
+          "a1b2c3"
+        </cs:getctag>
+      </d:prop>
+      <d:status>HTTP/1.1 200 OK</d:status>
+    </d:propstat>
+  </d:response>
+</d:multistatus>)"};
+    EXPECT_EQ(DcVCardParser::parseCtag(doc), std::optional<std::string>{R"("a1b2c3")"});
+}
+
+TEST(DcVCardParser, ParseCtagMissingOrEmptyIsNullopt) {
+    EXPECT_EQ(DcVCardParser::parseCtag(""), std::nullopt);
+    EXPECT_EQ(DcVCardParser::parseCtag("<not-xml"), std::nullopt);
+    EXPECT_EQ(DcVCardParser::parseCtag(wrap("BEGIN:VCARD\r\nFN:x\r\nEND:VCARD\r\n")),
+              std::nullopt);
+    const auto unsupported = std::string{R"(<?xml version="1.0" encoding="utf-8"?>
+<d:multistatus xmlns:d="DAV:" xmlns:cs="http://calendarserver.org/ns/">
+  <d:response>
+    <d:href>/aid/addresses/</d:href>
+    <d:propstat>
+      <d:prop><cs:getctag/></d:prop>
+      <d:status>HTTP/1.1 404 Not Found</d:status>
+    </d:propstat>
+  </d:response>
+</d:multistatus>)"};
+    EXPECT_EQ(DcVCardParser::parseCtag(unsupported), std::nullopt);
+}
+
 } // namespace aid::adapters::davical::internal::test
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <coroutine>
 #include <deque>
 #include <string>
 #include <string_view>
@@ -9,6 +10,7 @@
 
 #include "aid/adapters/openproject/internal/HttpDispatcher.h"
 #include "aid/infrastructure/HttpClient.h"
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Error.h"
 #include "aid/plumbing/Result.h"
 #include "aid/plumbing/Task.h"
@@ -18,7 +20,10 @@
 // FakeHttpDispatcher: records every send() call and replies with the
 // next scripted HttpResponse / Error. Tests treat the resulting Task<>
 // as synchronous because the fake's send() never co_awaits anything —
-// it just runs straight to co_return (initial_suspend=suspend_never).
+// it just runs straight to co_return (initial_suspend=suspend_never) —
+// unless a test has armed holdNext(), which parks one request until
+// releaseHeld(). Like HttpClient, it answers DeadlineExceeded without
+// recording the call when the event deadline in scope has already passed.
 //
 // FakeSleeper: returns an instantly-ready Task<void> while recording
 // the requested duration, so OpHttp::retryOn409's 50/100/200/400/800 ms
@@ -41,6 +46,12 @@ public:
     [[nodiscard]] aid::plumbing::Task<SendResult>
     send(std::string_view method, std::string_view path, std::string_view body,
          const aid::infrastructure::Headers& hdrs) override {
+        if (const auto d = aid::plumbing::currentDeadline();
+            d && *d <= aid::plumbing::DeadlineClock::now()) {
+            co_return aid::plumbing::unexpected{aid::plumbing::Error{
+                aid::plumbing::ErrorCode::DeadlineExceeded,
+                "FakeHttpDispatcher: event deadline exceeded", std::nullopt}};
+        }
         RecordedCall rec;
         rec.method.assign(method);
         rec.path.assign(path);
@@ -49,6 +60,10 @@ public:
             rec.headers.emplace_back(kv.first, kv.second);
         calls_.push_back(std::move(rec));
 
+        if (!holdMethod_.empty() && method == holdMethod_) {
+            holdMethod_.clear();
+            co_await Hold{held_};
+        }
         if (scripted_.empty()) {
             co_return aid::plumbing::unexpected{aid::plumbing::Error{
                 aid::plumbing::ErrorCode::Unknown,
@@ -74,9 +89,27 @@ public:
 
     [[nodiscard]] const std::vector<RecordedCall>& calls() const noexcept { return calls_; }
 
+    // Park the next `method` request (recorded, not yet answered) until
+    // releaseHeld(), so a test can start more work while it is in flight.
+    void holdNext(std::string method) { holdMethod_ = std::move(method); }
+    void releaseHeld() {
+        if (auto h = std::exchange(held_, {}))
+            h.resume();
+    }
+    [[nodiscard]] bool holding() const noexcept { return static_cast<bool>(held_); }
+
 private:
+    struct Hold {
+        std::coroutine_handle<>& slot;
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> h) noexcept { slot = h; }
+        void await_resume() const noexcept {}
+    };
+
     std::deque<SendResult> scripted_;
     std::vector<RecordedCall> calls_;
+    std::string holdMethod_;
+    std::coroutine_handle<> held_;
 };
 
 class FakeSleeper {
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <unistd.h>
+
+#include "aid/adapters/openproject/internal/CallidIndex.h"
+#include "aid/value-types/Ids.h"
+#include "aid/value-types/Ticket.h"
+
+using aid::CallId;
+using aid::TicketId;
+using aid::adapters::openproject::CallidIndex;
+
+namespace {
+
+class CallidIndexFile : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto pid = static_cast<std::uint64_t>(::getpid());
+        static std::atomic<std::uint64_t> counter{0};
+        const auto n = counter.fetch_add(1, std::memory_order_relaxed);
+        dir_ = std::filesystem::temp_directory_path() /
+               ("aid_callid_index_test_" + std::to_string(pid) + "_" + std::to_string(n));
+        std::filesystem::create_directories(dir_);
+        path_ = dir_ / "callid-index";
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(dir_, ec);
+    }
+
+    std::filesystem::path dir_;
+    std::filesystem::path path_;
+};
+
+} // namespace
+
+TEST(CallidIndex, RecordThenLookup) {
+    CallidIndex idx;
+    idx.record(CallId{"c-1"}, TicketId{"42"});
+    auto hit = idx.lookup(CallId{"c-1"});
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_EQ(hit->v, "42");
+    EXPECT_FALSE(idx.lookup(CallId{"c-2"}).has_value());
+}
+
+// recordTicket maps every callid a rolled-up ticket carries.
+TEST(CallidIndex, RecordTicketMapsEveryCallid) {
+    CallidIndex idx;
+    aid::Ticket t;
+    t.id = TicketId{"7"};
+    t.callIds = {CallId{"a"}, CallId{"b"}};
+    idx.recordTicket(t);
+    EXPECT_EQ(idx.size(), 2U);
+    EXPECT_EQ(idx.lookup(CallId{"b"})->v, "7");
+}
+
+// forget() only drops a mapping that still points at the id it verified, so a
+// fresher record() that raced the verifying GET survives.
+TEST(CallidIndex, ForgetIgnoresAFresherMapping) {
+    CallidIndex idx;
+    idx.record(CallId{"c-1"}, TicketId{"42"});
+    idx.record(CallId{"c-1"}, TicketId{"43"});
+    idx.forget(CallId{"c-1"}, TicketId{"42"});
+    ASSERT_TRUE(idx.lookup(CallId{"c-1"}).has_value());
+    EXPECT_EQ(idx.lookup(CallId{"c-1"})->v, "43");
+
+    idx.forget(CallId{"c-1"}, TicketId{"43"});
+    EXPECT_FALSE(idx.lookup(CallId{"c-1"}).has_value());
+}
+
+TEST_F(CallidIndexFile, SurvivesARestartIncludingTombstones) {
+    {
+        CallidIndex idx{path_};
+        idx.record(CallId{"keep"}, TicketId{"1"});
+        idx.record(CallId{"gone"}, TicketId{"2"});
+        idx.record(CallId{"moved"}, TicketId{"3"});
+        idx.record(CallId{"moved"}, TicketId{"4"});
+        idx.forget(CallId{"gone"}, TicketId{"2"});
+    }
+    CallidIndex reloaded{path_};
+    EXPECT_EQ(reloaded.size(), 2U);
+    EXPECT_EQ(reloaded.lookup(CallId{"keep"})->v, "1");
+    EXPECT_EQ(reloaded.lookup(CallId{"moved"})->v, "4");
+    EXPECT_FALSE(reloaded.lookup(CallId{"gone"}).has_value());
+}
+
+// A torn final line (crash mid-append) is skipped, not fatal.
+TEST_F(CallidIndexFile, TornTailIsSkipped) {
+    {
+        std::ofstream out(path_);
+        out << "c-1\t42\n" << "c-2";
+    }
+    CallidIndex idx{path_};
+    EXPECT_EQ(idx.size(), 1U);
+    EXPECT_EQ(idx.lookup(CallId{"c-1"})->v, "42");
+}
+
+// An unwritable location degrades to in-memory operation.
+TEST(CallidIndex, UnwritablePathStillServesFromMemory) {
+    CallidIndex idx{std::filesystem::path{"/nonexistent-dir/for/aid/callid-index"}};
+    idx.record(CallId{"c-1"}, TicketId{"42"});
+    EXPECT_EQ(idx.lookup(CallId{"c-1"})->v, "42");
+}
@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "aid/adapters/openproject/internal/CustomFieldMap.h"
+#include "aid/adapters/openproject/internal/OpStatusMap.h"
+#include "aid/adapters/openproject/internal/halstream.h"
+#include "aid/adapters/openproject/internal/payload.h"
+#include "aid/crosscutting/Config.h"
+#include "aid/plumbing/Error.h"
+#include "aid/plumbing/Result.h"
+#include "aid/value-types/Ticket.h"
+
+using aid::adapters::openproject::CustomFieldMap;
+using aid::adapters::openproject::HalElementFields;
+using aid::adapters::openproject::OpStatusMap;
+using aid::adapters::openproject::parseFromHal;
+using aid::adapters::openproject::streamHalCollection;
+using aid::adapters::openproject::workPackageFields;
+using aid::plumbing::Error;
+using aid::plumbing::ErrorCode;
+using aid::plumbing::Result;
+using json = nlohmann::json;
+
+namespace {
+
+CustomFieldMap sampleFields() {
+    return CustomFieldMap{aid::CustomFieldId{"1"}, aid::CustomFieldId{"2"}, aid::CustomFieldId{"3"},
+                          aid::CustomFieldId{"4"}, aid::CustomFieldId{"5"}, aid::CustomFieldId{"6"},
+                          aid::CustomFieldId{"7"}};
+}
+
+OpStatusMap sampleStatusMap() {
+    aid::crosscutting::TicketSystemConfig cfg;
+    cfg.statusNew = aid::StatusId{"1"};
+    cfg.statusInProgress = aid::StatusId{"2"};
+    cfg.statusClosed = aid::StatusId{"3"};
+    return OpStatusMap::fromConfig(cfg);
+}
+
+// A work package as OpenProject sends it in a full (unprojected) collection:
+// the keys parseFromHal reads plus the bulk it does not.
+json workPackage(int id) {
+    json j;
+    j["_type"] = "WorkPackage";
+    j["id"] = id;
+    j["subject"] = "Call " + std::to_string(id);
+    j["description"] = {{"format", "markdown"}, {"raw", "Body"}, {"html", "<p>Body</p>"}};
+    j["lockVersion"] = 2;
+    j["updatedAt"] = "2024-01-15T10:30:00Z";
+    j["customField1"] = "call-" + std::to_string(id);
+    j["customField2"] = "+491234";
+    j["customField6"] = {{"format", "markdown"}, {"raw", "alice: Call start"}};
+    j["customField7"] = {{"format", "markdown"}, {"raw", "alice, bob"}};
+    j["customField99"] = "unrelated";
+    j["_links"]["self"]["href"] = "/api/v3/work_packages/" + std::to_string(id);
+    j["_links"]["project"] = {{"href", "/api/v3/projects/11"}, {"title", "Acme"}};
+    j["_links"]["status"] = {{"href", "/api/v3/statuses/2"}, {"title", "In Progress"}};
+    j["_links"]["assignee"] = {{"href", "/api/v3/users/9"}, {"title", "Alice"}};
+    j["_links"]["author"]["href"] = "/api/v3/users/1";
+    j["_links"]["activities"]["href"] = "/api/v3/work_packages/1/activities";
+    j["_embedded"]["assignee"] = {{"id", 9}, {"login", "alice"}};
+    j["_embedded"]["type"] = {{"id", 7}, {"name", "Call"}, {"color", "#fff"}};
+    j["_embedded"]["schema"]["_links"]["self"]["href"] = "/api/v3/work_packages/schemas/1-7";
+    for (int f = 0; f < 20; ++f)
+        j["_embedded"]["schema"]["field" + std::to_string(f)] = {{"type", "String"},
+                                                                  {"writable", true}};
+    return j;
+}
+
+json page(int firstId, int n, long long total) {
+    json env;
+    env["_type"] = "Collection";
+    env["total"] = total;
+    env["count"] = n;
+    env["pageSize"] = 1000;
+    env["_links"]["self"]["href"] = "/api/v3/work_packages?offset=1";
+    env["_embedded"]["elements"] = json::array();
+    for (int i = 0; i < n; ++i)
+        env["_embedded"]["elements"].push_back(workPackage(firstId + i));
+    return env;
+}
+
+} // namespace
+
+// Only the listed attributes / relations survive; the envelope's total is read.
+TEST(HalStream, KeepsOnlyListedFieldsAndReadsTotal) {
+    const std::string body = page(1, 2, 7).dump();
+    std::vector<json> seen;
+    const HalElementFields fields{{"id", "_links", "_embedded"}, {"project", "assignee"}};
+    auto r = streamHalCollection(body, fields, [&seen](json&& el) -> Result<void> {
+        seen.push_back(std::move(el));
+        return Result<void>{};
+    });
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    EXPECT_EQ(r->total, 7);
+    EXPECT_EQ(r->elements, 2U);
+    ASSERT_EQ(seen.size(), 2U);
+    EXPECT_EQ(seen[1]["id"], 2);
+    EXPECT_FALSE(seen[0].contains("subject"));
+    EXPECT_FALSE(seen[0].contains("customField99"));
+    EXPECT_EQ(seen[0]["_links"]["project"]["href"], "/api/v3/projects/11");
+    EXPECT_FALSE(seen[0]["_links"].contains("self"));
+    EXPECT_FALSE(seen[0]["_links"].contains("author"));
+    EXPECT_EQ(seen[0]["_embedded"]["assignee"]["login"], "alice");
+    EXPECT_FALSE(seen[0]["_embedded"].contains("schema"));
+}
+
+// Streaming with workPackageFields yields the same Tickets as parsing the DOM.
+TEST(HalStream, WorkPackageFieldsParseLikeTheDom) {
+    const json full = page(1, 3, 3);
+    const auto m = sampleStatusMap();
+    std::vector<aid::Ticket> streamed;
+    auto r = streamHalCollection(full.dump(), workPackageFields(sampleFields()),
+                                 [&](json&& el) -> Result<void> {
+                                     auto t = parseFromHal(el, sampleFields(), m);
+                                     if (!t)
+                                         return aid::plumbing::unexpected(t.error());
+                                     streamed.push_back(std::move(*t));
+                                     return Result<void>{};
+                                 });
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    ASSERT_EQ(streamed.size(), 3U);
+    for (std::size_t i = 0; i < streamed.size(); ++i) {
+        auto dom = parseFromHal(full["_embedded"]["elements"][i], sampleFields(), m);
+        ASSERT_TRUE(dom.has_value()) << dom.error().message;
+        EXPECT_EQ(streamed[i].id.v, dom->id.v);
+        EXPECT_EQ(streamed[i].subject, dom->subject);
+        EXPECT_EQ(streamed[i].status, dom->status);
+        ASSERT_TRUE(streamed[i].assignee.has_value());
+        EXPECT_EQ(streamed[i].assignee->v, "alice");
+        EXPECT_EQ(streamed[i].callIds.size(), dom->callIds.size());
+        EXPECT_EQ(streamed[i].description, dom->description);
+        EXPECT_EQ(streamed[i].callLength, dom->callLength);
+        EXPECT_EQ(streamed[i].callHandlers.size(), 2U);
+        EXPECT_EQ(streamed[i].lockVersion, dom->lockVersion);
+        EXPECT_EQ(streamed[i].updatedAt, dom->updatedAt);
+    }
+}
+
+// A sink error stops the parse at that element and is returned verbatim.
+TEST(HalStream, SinkErrorAbortsTheParse) {
+    const std::string body = page(1, 5, 5).dump();
+    int calls = 0;
+    auto r = streamHalCollection(body, HalElementFields{{"id"}, {}},
+                                 [&calls](json&&) -> Result<void> {
+                                     if (++calls == 2)
+                                         return aid::plumbing::unexpected(Error{
+                                             ErrorCode::InvalidInput, "bad element", std::nullopt});
+                                     return Result<void>{};
+                                 });
+    ASSERT_FALSE(r.has_value());
+    EXPECT_EQ(r.error().code, ErrorCode::InvalidInput);
+    EXPECT_EQ(r.error().message, "bad element");
+    EXPECT_EQ(calls, 2);
+}
+
+TEST(HalStream, MalformedBodyIsAnError) {
+    auto r = streamHalCollection(R"({"total": 3, "_embedded": {"elements": [{"id": 1},)",
+                                 HalElementFields{{"id"}, {}},
+                                 [](json&&) -> Result<void> { return Result<void>{}; });
+    ASSERT_FALSE(r.has_value());
+    EXPECT_EQ(r.error().code, ErrorCode::Unknown);
+}
+
+// No body, or a body without `_embedded.elements`, is an empty collection.
+TEST(HalStream, EmptyBodyAndMissingElementsAreEmpty) {
+    int calls = 0;
+    const auto sink = [&calls](json&&) -> Result<void> {
+        ++calls;
+        return Result<void>{};
+    };
+    auto empty = streamHalCollection("", HalElementFields{{"id"}, {}}, sink);
+    ASSERT_TRUE(empty.has_value());
+    EXPECT_EQ(empty->total, -1);
+    auto bare = streamHalCollection(R"({"total":0,"_embedded":{"schemas":[1,2]}})",
+                                    HalElementFields{{"id"}, {}}, sink);
+    ASSERT_TRUE(bare.has_value());
+    EXPECT_EQ(bare->total, 0);
+    EXPECT_EQ(bare->elements, 0U);
+    EXPECT_EQ(calls, 0);
+}
+
+// A full server page (1000 elements, each carrying an embedded schema) streams
+// through element by element.
+TEST(HalStream, FullPageStreamsEveryElementInOrder) {
+    const std::string body = page(1, 1000, 1234).dump();
+    int expected = 1;
+    bool inOrder = true;
+    auto r = streamHalCollection(body, workPackageFields(sampleFields()),
+                                 [&](json&& el) -> Result<void> {
+                                     inOrder = inOrder && el["id"] == expected++;
+                                     return Result<void>{};
+                                 });
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    EXPECT_EQ(r->total, 1234);
+    EXPECT_EQ(r->elements, 1000U);
+    EXPECT_TRUE(inOrder);
+}
@@ -12,6 +12,7 @@
 #include "aid/adapters/openproject/internal/OpStatusMap.h"
 #include "aid/adapters/openproject/internal/OpTicketRepo.h"
 #include "aid/adapters/openproject/internal/OpUserRepo.h"
+#include "aid/adapters/openproject/internal/OpenCallView.h"
 #include "aid/crosscutting/Config.h"
 #include "aid/value-types/Ids.h"
 #include "aid/value-types/Ticket.h"
@@ -23,6 +24,7 @@ using aid::adapters::openproject::OpHttp;
 using aid::adapters::openproject::OpStatusMap;
 using aid::adapters::openproject::OpTicketRepo;
 using aid::adapters::openproject::OpUserRepo;
+using aid::adapters::openproject::OpenCallView;
 using aid::crosscutting::TicketSystemConfig;
 using aid::test_support::FakeHttpDispatcher;
 using aid::test_support::FakeSleeper;
@@ -210,6 +212,28 @@ struct DashHarness {
     }
 };
 
+// DashHarness as the plugin wires it: repo and builder share an OpenCallView.
+struct ViewHarness {
+    FakeHttpDispatcher dispatcher;
+    FakeSleeper sleeper;
+    TicketSystemConfig cfg = dashCfg();
+    aid::crosscutting::UiConfig ui;
+    CustomFieldMap fields = dashFields();
+    OpStatusMap statusMap = OpStatusMap::fromConfig(cfg);
+    OpenCallView view;
+    OpHttp http;
+    OpUserRepo users;
+    OpTicketRepo tickets;
+    OpDashboardBuilder builder;
+
+    ViewHarness()
+        : http(dispatcher, "http://op.example.com", "t", sleeper.sleeper()), users(http),
+          tickets(http, users, statusMap, cfg, fields, nullptr, nullptr, nullptr, &view),
+          builder(users, tickets, cfg, ui, &view) {
+        ui.projectWebBaseUrl = "http://op.example.com/projects";
+    }
+};
+
 } // namespace
 
 // alice is a member of project 11 (arm A) and a recorded handler on a ticket in
@@ -217,11 +241,12 @@ struct DashHarness {
 // call ticket AND the cross-project handler ticket.
 TEST(OpDashboardBuilder, BuildShowsBothMemberProjectAndCrossProjectHandlerTickets) {
     DashHarness h;
+    // Arm B is launched first, so it takes the first scripted response.
+    h.dispatcher.enqueueResponse(
+        200, collectionOf({halCallTicket("2", "99", "alice")})); // arm B (handler)
     h.dispatcher.enqueueResponse(200, usersOne("alice", 9)); // hrefFor(alice)
     h.dispatcher.enqueueResponse(200, projectsOne("11"));    // projectsForUser → [11]
     h.dispatcher.enqueueResponse(200, collectionOf({halCallTicket("1", "11")})); // arm A
-    h.dispatcher.enqueueResponse(
-        200, collectionOf({halCallTicket("2", "99", "alice")})); // arm B (handler)
 
     auto r = drainSync(h.builder.build(aid::UserHandle{"alice"}));
     ASSERT_TRUE(r.has_value()) << r.error().message;
@@ -238,13 +263,121 @@ TEST(OpDashboardBuilder, BuildShowsBothMemberProjectAndCrossProjectHandlerTicket
 // in their member projects (arm A alone).
 TEST(OpDashboardBuilder, BuildMemberButNotHandlerStillSeesProjectCallTickets) {
     DashHarness h;
+    h.dispatcher.enqueueResponse(200, R"({"_embedded":{"elements":[]}})");       // arm B empty
     h.dispatcher.enqueueResponse(200, usersOne("alice", 9)); // hrefFor(alice)
     h.dispatcher.enqueueResponse(200, projectsOne("11"));    // projectsForUser → [11]
     h.dispatcher.enqueueResponse(200, collectionOf({halCallTicket("1", "11")})); // arm A
-    h.dispatcher.enqueueResponse(200, R"({"_embedded":{"elements":[]}})");       // arm B empty
 
     auto r = drainSync(h.builder.build(aid::UserHandle{"alice"}));
     ASSERT_TRUE(r.has_value()) << r.error().message;
     ASSERT_EQ(r->size(), 1U);
     EXPECT_EQ((*r)[0].id.v, "1");
 }
+
+// The handler arm does not wait for the projects → member-arm chain: while it is
+// still in flight, the other three requests have already gone out.
+TEST(OpDashboardBuilder, BuildOverlapsTheHandlerArmWithTheProjectChain) {
+    DashHarness h;
+    h.dispatcher.enqueueResponse(200, usersOne("alice", 9)); // hrefFor(alice)
+    h.dispatcher.enqueueResponse(200, projectsOne("11"));    // projectsForUser → [11]
+    h.dispatcher.enqueueResponse(200, collectionOf({halCallTicket("1", "11")})); // arm A
+    h.dispatcher.enqueueResponse(
+        200, collectionOf({halCallTicket("2", "99", "alice")})); // arm B, once released
+    h.dispatcher.holdNext("GET");
+
+    auto task = h.builder.build(aid::UserHandle{"alice"});
+    ASSERT_TRUE(h.dispatcher.holding()) << "arm B must be the request launched first";
+    EXPECT_EQ(h.dispatcher.calls().size(), 4U) << "steps 1–2 must not wait for arm B";
+    EXPECT_FALSE(task.done());
+
+    h.dispatcher.releaseHeld();
+    auto r = drainSync(std::move(task));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    ASSERT_EQ(r->size(), 2U);
+}
+
+// With the view, the first load seeds it (same queries as before) and the next
+// one is answered from memory: no OpenProject request at all.
+TEST(OpDashboardBuilder, BuildFromViewServesTheSecondLoadLocally) {
+    ViewHarness h;
+    // Arm B is launched first, so it takes the first scripted response.
+    h.dispatcher.enqueueResponse(
+        200, collectionOf({halCallTicket("2", "99", "alice")})); // arm B (handler)
+    h.dispatcher.enqueueResponse(200, usersOne("alice", 9)); // hrefFor(alice)
+    h.dispatcher.enqueueResponse(200, projectsOne("11"));    // projectsForUser → [11]
+    h.dispatcher.enqueueResponse(200, collectionOf({halCallTicket("1", "11")})); // arm A
+
+    auto first = drainSync(h.builder.buildListing(aid::UserHandle{"alice"}));
+    ASSERT_TRUE(first.has_value()) << first.error().message;
+    ASSERT_EQ(first->entries.size(), 2U);
+    ASSERT_TRUE(first->stamp.has_value());
+    const auto callsAfterSeed = h.dispatcher.calls().size();
+
+    auto second = drainSync(h.builder.buildListing(aid::UserHandle{"alice"}));
+    ASSERT_TRUE(second.has_value()) << second.error().message;
+    EXPECT_EQ(h.dispatcher.calls().size(), callsAfterSeed) << "a warm load must not query upstream";
+    ASSERT_EQ(second->entries.size(), 2U);
+    EXPECT_EQ(second->entries[0].href, first->entries[0].href);
+    ASSERT_TRUE(second->stamp.has_value());
+    EXPECT_EQ(second->stamp->version, first->stamp->version);
+}
+
+// A ticket the repo reads back after a write (the one TicketDeltaEmitter
+// pushes) lands in the view, so the next load shows it without a rescan.
+TEST(OpDashboardBuilder, BuildFromViewShowsTicketsTheRepoWroteSinceTheSeed) {
+    ViewHarness h;
+    h.dispatcher.enqueueResponse(200, R"({"_embedded":{"elements":[]}})");
+    h.dispatcher.enqueueResponse(200, usersOne("alice", 9));
+    h.dispatcher.enqueueResponse(200, projectsOne("11"));
+    h.dispatcher.enqueueResponse(200, collectionOf({halCallTicket("1", "11")}));
+    auto seeded = drainSync(h.builder.buildListing(aid::UserHandle{"alice"}));
+    ASSERT_TRUE(seeded.has_value()) << seeded.error().message;
+    ASSERT_EQ(seeded->entries.size(), 1U);
+
+    h.dispatcher.enqueueResponse(200, halCallTicket("5", "11"));
+    auto fetched = drainSync(h.tickets.fetchById(aid::TicketId{"5"}));
+    ASSERT_TRUE(fetched.has_value()) << fetched.error().message;
+    const auto callsAfterFetch = h.dispatcher.calls().size();
+
+    auto r = drainSync(h.builder.buildListing(aid::UserHandle{"alice"}));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    EXPECT_EQ(h.dispatcher.calls().size(), callsAfterFetch);
+    ASSERT_EQ(r->entries.size(), 2U);
+    EXPECT_GT(r->stamp->version, seeded->stamp->version);
+}
+
+// The live-delta fan-out's shared build must hand every viewer exactly the
+// entry the single-viewer projection (and so the dashboard list) gives them.
+TEST(OpDashboardBuilder, BuildEntriesMatchesBuildEntryForEveryViewer) {
+    DashHarness h;
+    h.cfg.projectNames.emplace(aid::ProjectId{"11"}, "support");
+    aid::Ticket t;
+    t.id = aid::TicketId{"4242"};
+    t.projectId = aid::ProjectId{"11"};
+    t.subject = "Acme GmbH";
+    t.description = "a comment";
+    t.callLength = "alice: Call start: 2026-05-20 14:00:00 Call End: 2026-05-20 14:10:00\n"
+                   "bob: Call start: 2026-05-20 14:12:00 (X.2)\n"
+                   "carol: Call start: 2026-05-20 14:13:00 (X.3)";
+    const std::vector<aid::UserHandle> viewers{aid::UserHandle{"alice"}, aid::UserHandle{"bob"},
+                                               aid::UserHandle{"carol"}, aid::UserHandle{"dave"}};
+
+    const auto shared = h.builder.buildEntries(t, viewers);
+
+    ASSERT_EQ(shared.viewers.size(), viewers.size());
+    for (std::size_t i = 0; i < viewers.size(); ++i) {
+        const auto expected = h.builder.buildEntry(t, viewers[i]);
+        const auto got = aid::entryFor(shared, shared.viewers[i]);
+        EXPECT_EQ(shared.viewers[i].viewer, viewers[i]);
+        EXPECT_EQ(got.href, expected.href);
+        EXPECT_EQ(got.projectName, expected.projectName);
+        EXPECT_EQ(got.description, expected.description);
+        EXPECT_EQ(got.activeCallForViewer, expected.activeCallForViewer) << viewers[i].v;
+        EXPECT_EQ(got.otherActiveUsers, expected.otherActiveUsers) << viewers[i].v;
+    }
+    const auto bob = aid::entryFor(shared, shared.viewers[1]);
+    ASSERT_TRUE(bob.activeCallForViewer.has_value());
+    EXPECT_EQ(bob.activeCallForViewer->v, "X.2");
+    EXPECT_EQ(bob.otherActiveUsers, std::vector<aid::UserHandle>{aid::UserHandle{"carol"}});
+    EXPECT_EQ(shared.viewers[3].otherActiveUsers.size(), 2U) << "dave sees both live calls";
+}
@@ -74,6 +74,23 @@ TEST(OpHttp, NonJsonBodyOn200IsAnError) {
     ASSERT_FALSE(result.has_value());
 }
 
+// getBody hands back the 2xx body unparsed and maps statuses like get().
+TEST(OpHttp, GetBodyReturnsRawBodyAndMapsStatus) {
+    FakeHttpDispatcher d;
+    FakeSleeper s;
+    d.enqueueResponse(200, "not json");
+    d.enqueueResponse(404, "{}");
+    OpHttp http(d, "http://op.example.com", "t", s.sleeper());
+
+    auto ok = drainSync(http.getBody("/x"));
+    ASSERT_TRUE(ok.has_value()) << ok.error().message;
+    EXPECT_EQ(*ok, "not json");
+
+    auto missing = drainSync(http.getBody("/y"));
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error().code, ErrorCode::NotFound);
+}
+
 TEST(OpHttp, FourOhFourMapsToNotFound) {
     FakeHttpDispatcher d;
     FakeSleeper s;
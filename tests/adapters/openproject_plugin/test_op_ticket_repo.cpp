@@ -1,17 +1,29 @@
 #include <gtest/gtest.h>
+#include <trantor/net/EventLoop.h>
 
+#include <chrono>
+#include <future>
 #include <nlohmann/json.hpp>
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#include "aid/adapters/openproject/internal/CallidIndex.h"
 #include "aid/adapters/openproject/internal/CustomFieldMap.h"
 #include "aid/adapters/openproject/internal/HandlerLedger.h"
+#include "aid/adapters/openproject/internal/HttpDispatcher.h"
 #include "aid/adapters/openproject/internal/OpHttp.h"
 #include "aid/adapters/openproject/internal/OpStatusMap.h"
 #include "aid/adapters/openproject/internal/OpTicketRepo.h"
 #include "aid/adapters/openproject/internal/OpUserRepo.h"
 #include "aid/adapters/openproject/internal/ProducedLedger.h"
+#include "aid/adapters/openproject/internal/RecipientCache.h"
+#include "aid/adapters/openproject/internal/TicketCache.h"
 #include "aid/crosscutting/Config.h"
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Error.h"
 #include "tests/adapters/openproject_plugin/fake_http_dispatcher.h"
 
@@ -88,11 +100,49 @@ struct Harness {
     OpUserRepo users;
     aid::adapters::openproject::ProducedLedger ledger;
     aid::adapters::openproject::HandlerLedger handlerLedger;
+    aid::adapters::openproject::CallidIndex callidIndex;
     OpTicketRepo tickets;
 
     Harness()
         : http(dispatcher, "http://op.example.com", "t", sleeper.sleeper()), users(http),
-          tickets(http, users, statusMap, cfg, fields, &ledger, &handlerLedger) {}
+          tickets(http, users, statusMap, cfg, fields, &ledger, &handlerLedger, &callidIndex) {}
+    // With a production Sleeper in place of the recording one.
+    explicit Harness(aid::adapters::openproject::Sleeper s)
+        : http(dispatcher, "http://op.example.com", "t", std::move(s)), users(http),
+          tickets(http, users, statusMap, cfg, fields, &ledger, &handlerLedger, &callidIndex) {}
+};
+
+// Own EventLoop on a dedicated thread, for the tests that need the real
+// loop sleeper (mirrors HttpClientTest's LoopThread).
+class LoopThread {
+public:
+    LoopThread() {
+        std::promise<trantor::EventLoop*> ready;
+        auto future = ready.get_future();
+        thread_ = std::thread([&ready] {
+            trantor::EventLoop loop;
+            ready.set_value(&loop);
+            loop.loop();
+        });
+        loop_ = future.get();
+    }
+    LoopThread(const LoopThread&) = delete;
+    LoopThread& operator=(const LoopThread&) = delete;
+    LoopThread(LoopThread&&) = delete;
+    LoopThread& operator=(LoopThread&&) = delete;
+    ~LoopThread() {
+        if (loop_ != nullptr) {
+            loop_->queueInLoop([loop = loop_] { loop->quit(); });
+        }
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+    [[nodiscard]] trantor::EventLoop& loop() const noexcept { return *loop_; }
+
+private:
+    std::thread thread_;
+    trantor::EventLoop* loop_{nullptr};
 };
 
 } // namespace
@@ -158,6 +208,65 @@ TEST(OpTicketRepo, FindByCallidEscapesQuotesAndBackslashes) {
     EXPECT_NE(path.find("%5D"), std::string::npos);
 }
 
+// ─── callid index (findByCallidContains served locally) ──────────────────
+
+// The callid a ticket was created for resolves through the index: one by-id
+// GET, no "~" filter query.
+TEST(OpTicketRepo, FindByCallidContainsServedFromIndexAfterCreate) {
+    Harness h;
+    json created;
+    created["id"] = 42;
+    h.dispatcher.enqueueResponse(201, created.dump());
+    // halTicket carries customField1 (callId) = "c-1".
+    h.dispatcher.enqueueResponse(200, halTicket("42", 1, "/api/v3/statuses/1"));
+
+    aid::NewTicket nt;
+    nt.projectId = aid::ProjectId{"11"};
+    nt.subject = "Call";
+    nt.callId = aid::CallId{"c-1"};
+    nt.callerNumber = aid::PhoneNumber{"+491234"};
+    ASSERT_TRUE(drainSync(h.tickets.create(nt)).has_value());
+
+    auto r = drainSync(h.tickets.findByCallidContains(aid::CallId{"c-1"}));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    ASSERT_TRUE(r->has_value());
+    EXPECT_EQ((*r)->id.v, "42");
+    ASSERT_EQ(h.dispatcher.calls().size(), 2U);
+    EXPECT_EQ(h.dispatcher.calls()[1].path, "/api/v3/work_packages/42");
+}
+
+// A hinted ticket that no longer carries the callid (hangup removed it) is not
+// returned: the entry is dropped and the filter query decides.
+TEST(OpTicketRepo, StaleIndexEntryFallsBackToFilterQuery) {
+    Harness h;
+    h.callidIndex.record(aid::CallId{"c-9"}, aid::TicketId{"42"});
+    h.dispatcher.enqueueResponse(200, halTicket("42", 1, "/api/v3/statuses/1"));
+    h.dispatcher.enqueueResponse(200, emptyCollection());
+
+    auto r = drainSync(h.tickets.findByCallidContains(aid::CallId{"c-9"}));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    EXPECT_FALSE(r->has_value());
+    ASSERT_EQ(h.dispatcher.calls().size(), 2U);
+    EXPECT_NE(h.dispatcher.calls()[1].path.find("~"), std::string::npos);
+    EXPECT_FALSE(h.callidIndex.lookup(aid::CallId{"c-9"}).has_value());
+}
+
+// A hinted ticket that was deleted (404) falls back too, and the filter hit
+// re-seeds the index with the right ticket.
+TEST(OpTicketRepo, DeletedIndexedTicketFallsBackAndReindexes) {
+    Harness h;
+    h.callidIndex.record(aid::CallId{"c-1"}, aid::TicketId{"41"});
+    h.dispatcher.enqueueResponse(404, R"({"message":"not found"})");
+    h.dispatcher.enqueueResponse(200, halCollectionOf(halTicket("42", 1, "/api/v3/statuses/1")));
+
+    auto r = drainSync(h.tickets.findByCallidContains(aid::CallId{"c-1"}));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    ASSERT_TRUE(r->has_value());
+    EXPECT_EQ((*r)->id.v, "42");
+    ASSERT_TRUE(h.callidIndex.lookup(aid::CallId{"c-1"}).has_value());
+    EXPECT_EQ(h.callidIndex.lookup(aid::CallId{"c-1"})->v, "42");
+}
+
 TEST(OpTicketRepo, FindLatestOpenCallInProjectExcludesClosed) {
     Harness h;
     h.dispatcher.enqueueResponse(200, emptyCollection());
@@ -171,6 +280,10 @@ TEST(OpTicketRepo, FindLatestOpenCallInProjectExcludesClosed) {
     EXPECT_NE(path.find("%21"), std::string::npos);
     // Sort clause must be present in the URL.
     EXPECT_NE(path.find("sortBy="), std::string::npos);
+    // Routing lookups ask for the routing sparse fieldset only (no
+    // description / callLength bodies).
+    EXPECT_NE(path.find("select=total%2Ccount%2Celements%2Fid"), std::string::npos) << path;
+    EXPECT_EQ(path.find("elements%2Fdescription"), std::string::npos);
 }
 
 TEST(OpTicketRepo, FindOpenInProjectBySubjectUsesContainsAndNotClosed) {
@@ -189,6 +302,46 @@ TEST(OpTicketRepo, FindOpenInProjectBySubjectUsesContainsAndNotClosed) {
     EXPECT_EQ(path.find("%3C%3E"), std::string::npos);
 }
 
+// Known-contact routing over several projects is ONE query; the rows (newest
+// first) come back aligned to the requested project order, nullopt where the
+// caller has nothing open.
+TEST(OpTicketRepo, FindOpenByCallerNumberInProjectsIsOneSortedQuery) {
+    Harness h;
+    json newer = json::parse(halTicket("52", 1, "/api/v3/statuses/1"));
+    newer["_links"]["project"]["href"] = "/api/v3/projects/12";
+    json older = json::parse(halTicket("51", 1, "/api/v3/statuses/1"));
+    older["_links"]["project"]["href"] = "/api/v3/projects/12";
+    json envelope;
+    envelope["total"] = 2;
+    envelope["_embedded"]["elements"] = json::array({newer, older});
+    h.dispatcher.enqueueResponse(200, envelope.dump());
+
+    const std::vector<aid::ProjectId> projects{aid::ProjectId{"11"}, aid::ProjectId{"12"}};
+    auto r = drainSync(
+        h.tickets.findOpenByCallerNumberInProjects(projects, aid::PhoneNumber{"+491234"}));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    ASSERT_EQ(r->size(), 2U);
+    EXPECT_FALSE((*r)[0].has_value());
+    ASSERT_TRUE((*r)[1].has_value());
+    EXPECT_EQ((*r)[1]->id.v, "52");
+
+    ASSERT_EQ(h.dispatcher.calls().size(), 1U);
+    const auto& path = h.dispatcher.calls()[0].path;
+    // Both project ids travel in the one filter; status!=Closed ("!", %21);
+    // newest update first.
+    EXPECT_NE(path.find("%2211%22%2C%2212%22"), std::string::npos) << path;
+    EXPECT_NE(path.find("%21"), std::string::npos);
+    EXPECT_NE(path.find("sortBy="), std::string::npos);
+}
+
+TEST(OpTicketRepo, FindOpenByCallerNumberInNoProjectsIssuesNoRequest) {
+    Harness h;
+    auto r = drainSync(h.tickets.findOpenByCallerNumberInProjects({}, aid::PhoneNumber{"+4912"}));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    EXPECT_TRUE(r->empty());
+    EXPECT_TRUE(h.dispatcher.calls().empty());
+}
+
 // ─── create ──────────────────────────────────────────────────────────────
 
 TEST(OpTicketRepo, CreatePostsToProjectEndpointAndReturnsId) {
@@ -212,6 +365,51 @@ TEST(OpTicketRepo, CreatePostsToProjectEndpointAndReturnsId) {
     EXPECT_EQ(h.dispatcher.calls()[0].path, "/api/v3/projects/11/work_packages");
 }
 
+// The POST response is the full HAL work package, so createAndGet parses it
+// instead of GETting the ticket back.
+TEST(OpTicketRepo, CreateAndGetParsesPostResponseWithoutFollowUpGet) {
+    Harness h;
+    h.dispatcher.enqueueResponse(201, halTicket("100", 1, "/api/v3/statuses/1"));
+
+    aid::NewTicket nt;
+    nt.projectId = aid::ProjectId{"11"};
+    nt.subject = "Call";
+    nt.callId = aid::CallId{"c-1"};
+    nt.callerNumber = aid::PhoneNumber{"+491234"};
+
+    auto r = drainSync(h.tickets.createAndGet(nt));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    ASSERT_TRUE(r->has_value());
+    EXPECT_EQ((*r)->id.v, "100");
+    EXPECT_EQ((*r)->lockVersion, 1);
+    ASSERT_EQ(h.dispatcher.calls().size(), 1U);
+    EXPECT_EQ(h.dispatcher.calls()[0].method, "POST");
+    EXPECT_TRUE(h.ledger.contains(aid::TicketId{"100"}, 1));
+}
+
+// A POST body that carries the id but does not parse as a work package still
+// created the ticket: fall back to one GET.
+TEST(OpTicketRepo, CreateAndGetFallsBackToFetchWhenPostBodyDoesNotParse) {
+    Harness h;
+    json resp;
+    resp["id"] = 100;
+    h.dispatcher.enqueueResponse(201, resp.dump());
+    h.dispatcher.enqueueResponse(200, halTicket("100", 1, "/api/v3/statuses/1"));
+
+    aid::NewTicket nt;
+    nt.projectId = aid::ProjectId{"11"};
+    nt.subject = "Call";
+    nt.callId = aid::CallId{"c-1"};
+    nt.callerNumber = aid::PhoneNumber{"+491234"};
+
+    auto r = drainSync(h.tickets.createAndGet(nt));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    ASSERT_TRUE(r->has_value());
+    EXPECT_EQ((*r)->id.v, "100");
+    ASSERT_EQ(h.dispatcher.calls().size(), 2U);
+    EXPECT_EQ(h.dispatcher.calls()[1].path, "/api/v3/work_packages/100");
+}
+
 // ─── save + retryOn409 wiring ────────────────────────────────────────────
 //
 // save(id, reduce) fetches the ticket's fresh server state, applies the pure
@@ -308,6 +506,219 @@ TEST(OpTicketRepo, SaveReDerivesDeltaAgainstFreshStateOn409) {
         << "sibling's description edit survives the retry";
 }
 
+// The 409 backoff sleeps on the loop, and the sleeper puts the event's
+// deadline back when it wakes: a budget spent during the backoff stops the
+// save at the lockVersion refresh instead of retrying without one.
+TEST(OpTicketRepo, BudgetedSaveStopsAtItsDeadlineAfterA409) {
+    LoopThread lt;
+    Harness h{aid::adapters::openproject::makeLoopSleeper(lt.loop())};
+    h.dispatcher.enqueueResponse(200, halTicket("42", 3, "/api/v3/statuses/2"));  // seed fetch
+    h.dispatcher.enqueueResponse(409, "{}");                                      // 1st PATCH
+    h.dispatcher.enqueueResponse(200, halTicket("42", 10, "/api/v3/statuses/2")); // refresh
+    h.dispatcher.enqueueResponse(200, halTicket("42", 11, "/api/v3/statuses/2")); // 2nd PATCH
+
+    std::promise<aid::plumbing::Result<aid::Ticket>> done;
+    auto run = [&done](OpTicketRepo& tickets) -> aid::plumbing::Task<void> {
+        auto save = tickets.save(aid::TicketId{"42"}, identity);
+        done.set_value(co_await save);
+    };
+    std::optional<aid::plumbing::Task<void>> task;
+    lt.loop().queueInLoop([&] {
+        // Shorter than the 50 ms backoff the 409 costs.
+        const aid::plumbing::DeadlineScope scope{aid::plumbing::DeadlineClock::now() +
+                                                 std::chrono::milliseconds{20}};
+        task.emplace(run(h.tickets));
+    });
+    auto fut = done.get_future();
+    ASSERT_EQ(fut.wait_for(std::chrono::seconds{5}), std::future_status::ready);
+    const auto r = fut.get();
+
+    ASSERT_FALSE(r.has_value());
+    EXPECT_EQ(r.error().code, ErrorCode::DeadlineExceeded);
+    EXPECT_EQ(h.dispatcher.calls().size(), 2U) << "no refresh GET or PATCH past the budget";
+
+    std::promise<void> reaped;
+    lt.loop().queueInLoop([&] {
+        task.reset();
+        reaped.set_value();
+    });
+    reaped.get_future().wait();
+}
+
+// ─── save seeded from the TicketCache ─────────────────────────────────────
+
+namespace {
+
+// A Harness whose repo is also wired to a TicketCache.
+struct CachedHarness : Harness {
+    aid::adapters::openproject::TicketCache cache;
+    OpTicketRepo cached{http, users, statusMap, cfg, fields, &ledger, &handlerLedger,
+                        &callidIndex, nullptr, &cache};
+};
+
+} // namespace
+
+// A ticket the repo has just read is saved with the PATCH alone.
+TEST(OpTicketRepo, SaveAfterFetchPatchesWithoutASeedFetch) {
+    CachedHarness h;
+    h.dispatcher.enqueueResponse(200, halTicket("42", 3, "/api/v3/statuses/2")); // fetchById
+    h.dispatcher.enqueueResponse(200, halTicket("42", 4, "/api/v3/statuses/2")); // PATCH
+    ASSERT_TRUE(drainSync(h.cached.fetchById(aid::TicketId{"42"})).has_value());
+
+    auto r = drainSync(h.cached.save(aid::TicketId{"42"}, identity));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    EXPECT_EQ(r->lockVersion, 4);
+    ASSERT_EQ(h.dispatcher.calls().size(), 2U);
+    EXPECT_EQ(h.dispatcher.calls()[1].method, "PATCH");
+    EXPECT_EQ(json::parse(h.dispatcher.calls()[1].body)["lockVersion"], 3);
+    // The PATCH response seeds the next save in turn.
+    EXPECT_EQ(h.cache.lookup(aid::TicketId{"42"})->lockVersion, 4);
+}
+
+// A cached copy someone else has since overwritten costs one rejected PATCH:
+// the 409 re-fetches and re-applies the reducer against the fresh state.
+TEST(OpTicketRepo, SaveFromStaleCacheFallsBackToFetchOn409) {
+    CachedHarness h;
+    h.dispatcher.enqueueResponse(200, halTicket("42", 3, "/api/v3/statuses/2")); // fetchById
+    ASSERT_TRUE(drainSync(h.cached.fetchById(aid::TicketId{"42"})).has_value());
+    h.dispatcher.enqueueResponse(409, "{}");                                      // cached PATCH
+    h.dispatcher.enqueueResponse(200, halTicket("42", 8, "/api/v3/statuses/2")); // refresh
+    h.dispatcher.enqueueResponse(200, halTicket("42", 9, "/api/v3/statuses/2")); // PATCH
+
+    auto r = drainSync(h.cached.save(aid::TicketId{"42"}, identity));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    EXPECT_EQ(r->lockVersion, 9);
+    ASSERT_EQ(h.dispatcher.calls().size(), 4U);
+    EXPECT_EQ(h.dispatcher.calls()[1].method, "PATCH");
+    EXPECT_EQ(h.dispatcher.calls()[2].method, "GET");
+    EXPECT_EQ(json::parse(h.dispatcher.calls()[3].body)["lockVersion"], 8);
+}
+
+// The close walk reads the ticket once; each step then seeds from the previous
+// write.
+TEST(OpTicketRepo, CloseTwoStepWithCacheFetchesOnce) {
+    CachedHarness h;
+    h.dispatcher.enqueueResponse(200, halTicket("42", 5, "/api/v3/statuses/1")); // path GET: New
+    h.dispatcher.enqueueResponse(200,
+                                 halTicket("42", 6, "/api/v3/statuses/2")); // PATCH → InProgress
+    h.dispatcher.enqueueResponse(200, halTicket("42", 7, "/api/v3/statuses/3")); // PATCH → Closed
+
+    auto r = drainSync(h.cached.closeTwoStep(aid::TicketId{"42"}));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    ASSERT_EQ(h.dispatcher.calls().size(), 3U);
+    EXPECT_EQ(h.dispatcher.calls()[0].method, "GET");
+    EXPECT_EQ(h.dispatcher.calls()[1].method, "PATCH");
+    EXPECT_EQ(h.dispatcher.calls()[2].method, "PATCH");
+    EXPECT_EQ(json::parse(h.dispatcher.calls()[2].body)["lockVersion"], 6);
+}
+
+// Saves that arrive while a PATCH for the same ticket is in flight queue
+// without any HTTP, then go out together as one fetch + PATCH applying their
+// reducers in arrival order; each queued caller gets that PATCH's ticket.
+TEST(OpTicketRepo, ConcurrentSavesOnOneTicketAreCombinedIntoOnePatch) {
+    Harness h;
+    h.dispatcher.enqueueResponse(200, halTicket("42", 1, "/api/v3/statuses/2")); // GET
+    h.dispatcher.enqueueResponse(200, halTicket("42", 2, "/api/v3/statuses/2")); // PATCH (held)
+    h.dispatcher.enqueueResponse(200, halTicket("42", 2, "/api/v3/statuses/2")); // batch GET
+    h.dispatcher.enqueueResponse(200, halTicket("42", 3, "/api/v3/statuses/2")); // batch PATCH
+    const auto append = [](std::string line) -> aid::ports::TicketReducer {
+        return [line](aid::Ticket t) {
+            t.description += line;
+            return t;
+        };
+    };
+
+    h.dispatcher.holdNext("PATCH");
+    auto first = h.tickets.save(aid::TicketId{"42"}, append("A"));
+    ASSERT_TRUE(h.dispatcher.holding());
+    auto second = h.tickets.save(aid::TicketId{"42"}, append("B"));
+    auto third = h.tickets.save(aid::TicketId{"42"}, append("C"));
+    EXPECT_EQ(h.dispatcher.calls().size(), 2U) << "queued saves must not reach OpenProject";
+    EXPECT_FALSE(second.done());
+    EXPECT_FALSE(third.done());
+
+    h.dispatcher.releaseHeld();
+    auto r1 = drainSync(std::move(first));
+    auto r2 = drainSync(std::move(second));
+    auto r3 = drainSync(std::move(third));
+    ASSERT_TRUE(r1.has_value()) << r1.error().message;
+    ASSERT_TRUE(r2.has_value()) << r2.error().message;
+    ASSERT_TRUE(r3.has_value()) << r3.error().message;
+    EXPECT_EQ(r1->lockVersion, 2);
+    EXPECT_EQ(r2->lockVersion, 3);
+    EXPECT_EQ(r3->lockVersion, 3);
+
+    ASSERT_EQ(h.dispatcher.calls().size(), 4U);
+    EXPECT_EQ(h.dispatcher.calls()[2].method, "GET");
+    EXPECT_EQ(h.dispatcher.calls()[3].method, "PATCH");
+    const auto body = json::parse(h.dispatcher.calls()[3].body);
+    EXPECT_EQ(body["lockVersion"], 2);
+    EXPECT_EQ(body["description"]["raw"], "BC");
+}
+
+// A queued save is resumed under its own event's deadline, not the one the
+// leader's PATCH completion runs under.
+TEST(OpTicketRepo, QueuedSaveResumesUnderItsOwnDeadline) {
+    Harness h;
+    h.dispatcher.enqueueResponse(200, halTicket("42", 1, "/api/v3/statuses/2")); // GET
+    h.dispatcher.enqueueResponse(200, halTicket("42", 2, "/api/v3/statuses/2")); // PATCH (held)
+    h.dispatcher.enqueueResponse(200, halTicket("42", 2, "/api/v3/statuses/2")); // batch GET
+    h.dispatcher.enqueueResponse(200, halTicket("42", 3, "/api/v3/statuses/2")); // batch PATCH
+    const auto leaderBudget = aid::plumbing::DeadlineClock::now() + std::chrono::seconds{1};
+    const auto queuedBudget = aid::plumbing::DeadlineClock::now() + std::chrono::seconds{5};
+    auto observe = [](aid::plumbing::Task<aid::plumbing::Result<aid::Ticket>> save,
+                      std::optional<aid::plumbing::Deadline>& seen) -> aid::plumbing::Task<void> {
+        (void)co_await save;
+        seen = aid::plumbing::currentDeadline();
+    };
+
+    h.dispatcher.holdNext("PATCH");
+    auto first = h.tickets.save(aid::TicketId{"42"}, identity);
+    std::optional<aid::plumbing::Deadline> seen;
+    auto second = [&] {
+        const aid::plumbing::DeadlineScope scope{queuedBudget};
+        return observe(h.tickets.save(aid::TicketId{"42"}, identity), seen);
+    }();
+    ASSERT_FALSE(second.done());
+
+    {
+        const aid::plumbing::DeadlineScope scope{leaderBudget};
+        h.dispatcher.releaseHeld();
+    }
+    ASSERT_TRUE(second.done());
+    ASSERT_TRUE(drainSync(std::move(first)).has_value());
+    EXPECT_EQ(seen, queuedBudget);
+}
+
+// A leader whose reducer throws still fails its own save and promotes the
+// save queued behind it, which then goes out on its own.
+TEST(OpTicketRepo, ThrowingReducerStillHandsOffToTheQueuedSave) {
+    Harness h;
+    h.dispatcher.enqueueResponse(200, halTicket("42", 1, "/api/v3/statuses/2")); // GET (held)
+    h.dispatcher.enqueueResponse(200, halTicket("42", 1, "/api/v3/statuses/2")); // queued GET
+    h.dispatcher.enqueueResponse(200, halTicket("42", 2, "/api/v3/statuses/2")); // queued PATCH
+    const aid::ports::TicketReducer boom = [](aid::Ticket) -> aid::Ticket {
+        throw std::runtime_error{"reducer failed"};
+    };
+
+    h.dispatcher.holdNext("GET");
+    auto first = h.tickets.save(aid::TicketId{"42"}, boom);
+    ASSERT_TRUE(h.dispatcher.holding());
+    auto second = h.tickets.save(aid::TicketId{"42"}, identity);
+    ASSERT_FALSE(second.done());
+
+    h.dispatcher.releaseHeld();
+    auto r1 = drainSync(std::move(first));
+    ASSERT_FALSE(r1.has_value());
+    EXPECT_EQ(r1.error().code, aid::plumbing::ErrorCode::Unknown);
+    ASSERT_TRUE(second.done()) << "the queued save must not wait behind a dead leader";
+    auto r2 = drainSync(std::move(second));
+    ASSERT_TRUE(r2.has_value()) << r2.error().message;
+    EXPECT_EQ(r2->lockVersion, 2);
+    ASSERT_EQ(h.dispatcher.calls().size(), 3U);
+    EXPECT_EQ(h.dispatcher.calls()[2].method, "PATCH");
+}
+
 // ─── save assignee resolution (numeric/href/display-name round-trip) ──────
 
 // A ticket fetched WITHOUT ?include=assignee carries a display-name title (or
@@ -471,6 +882,103 @@ TEST(OpTicketRepo, AddCallHandlerAppendsLoginViaMinimalPatch) {
     EXPECT_FALSE(body.contains("subject"));
 }
 
+// While a save's PATCH is out the ledger reports the ticket in flight, and by
+// the time it no longer does, the produced version is recorded — the order
+// decodeWebhook's echo wait relies on.
+TEST(OpTicketRepo, SaveHoldsTheTicketInFlightUntilItsVersionIsRecorded) {
+    Harness h;
+    h.dispatcher.enqueueResponse(200, halTicket("42", 3, "/api/v3/statuses/2")); // seed fetch
+    h.dispatcher.enqueueResponse(200, halTicket("42", 4, "/api/v3/statuses/2")); // PATCH
+    h.dispatcher.holdNext("PATCH");
+
+    auto saving = h.tickets.save(aid::TicketId{"42"}, identity);
+    ASSERT_TRUE(h.dispatcher.holding());
+    EXPECT_TRUE(h.ledger.writeInFlight(aid::TicketId{"42"}));
+    EXPECT_FALSE(h.ledger.contains(aid::TicketId{"42"}, 4));
+
+    h.dispatcher.releaseHeld();
+    ASSERT_TRUE(drainSync(std::move(saving)).has_value());
+    EXPECT_FALSE(h.ledger.writeInFlight(aid::TicketId{"42"}));
+    EXPECT_TRUE(h.ledger.contains(aid::TicketId{"42"}, 4));
+}
+
+// decodeWebhook's echo check, racing the PATCH it echoes: the webhook for v4
+// lands while the save's PATCH is still in flight. The check waits, the PATCH
+// response records v4, and the webhook is recognised as our own.
+TEST(OpTicketRepo, EchoRacingAnInFlightPatchIsSuppressed) {
+    Harness h;
+    h.dispatcher.enqueueResponse(200, halTicket("42", 3, "/api/v3/statuses/2")); // seed fetch
+    h.dispatcher.enqueueResponse(200, halTicket("42", 4, "/api/v3/statuses/2")); // PATCH
+    h.dispatcher.holdNext("PATCH");
+    auto saving = h.tickets.save(aid::TicketId{"42"}, identity);
+    ASSERT_TRUE(h.dispatcher.holding());
+
+    // The PATCH response arrives during the first poll interval.
+    std::vector<std::chrono::milliseconds> slept;
+    auto sleeper = [&h, &slept](std::chrono::milliseconds d) -> aid::plumbing::Task<void> {
+        slept.push_back(d);
+        if (h.dispatcher.holding())
+            h.dispatcher.releaseHeld();
+        co_return;
+    };
+    auto echo = h.ledger.isEcho(aid::TicketId{"42"}, 4, sleeper);
+    ASSERT_TRUE(echo.done());
+    EXPECT_TRUE(echo.await_resume());
+    ASSERT_EQ(slept.size(), 1U);
+    EXPECT_EQ(slept[0], aid::adapters::openproject::ProducedLedger::kEchoPollInterval);
+    ASSERT_TRUE(drainSync(std::move(saving)).has_value());
+
+    // A human edit after it (v5) is not ours, and with nothing in flight any
+    // more it is not delayed either.
+    slept.clear();
+    auto external = h.ledger.isEcho(aid::TicketId{"42"}, 5, sleeper);
+    ASSERT_TRUE(external.done());
+    EXPECT_FALSE(external.await_resume());
+    EXPECT_TRUE(slept.empty());
+}
+
+// addCallHandlerAndGet returns the PATCH response — the post-merge ticket at
+// its new lockVersion — so the caller's delta needs no re-fetch.
+TEST(OpTicketRepo, AddCallHandlerAndGetReturnsPostMergeTicket) {
+    Harness h;
+    h.dispatcher.enqueueResponse(200, halTicket("42", 5, "/api/v3/statuses/2")); // refetch
+    json patched = json::parse(halTicket("42", 6, "/api/v3/statuses/2"));
+    patched["customField7"]["raw"] = "bob";
+    h.dispatcher.enqueueResponse(200, patched.dump()); // PATCH ok
+
+    auto r = drainSync(
+        h.tickets.addCallHandlerAndGet(aid::TicketId{"42"}, aid::UserHandle{"bob"}));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    ASSERT_TRUE(r->has_value());
+    EXPECT_EQ((*r)->lockVersion, 6);
+    ASSERT_EQ((*r)->callHandlers.size(), 1U);
+    EXPECT_EQ((*r)->callHandlers[0].v, "bob");
+    EXPECT_EQ(h.dispatcher.calls().size(), 2U);
+}
+
+// A PATCH body that does not parse still merged the handler: read the ticket
+// back, as createAndGet does, so the accepted call still gets its delta.
+TEST(OpTicketRepo, AddCallHandlerAndGetFallsBackToFetchWhenPatchBodyDoesNotParse) {
+    Harness h;
+    h.dispatcher.enqueueResponse(200, halTicket("42", 5, "/api/v3/statuses/2")); // refetch
+    json trimmed;
+    trimmed["lockVersion"] = 6;
+    h.dispatcher.enqueueResponse(200, trimmed.dump()); // PATCH ok, body unparseable
+    json reread = json::parse(halTicket("42", 6, "/api/v3/statuses/2"));
+    reread["customField7"]["raw"] = "bob";
+    h.dispatcher.enqueueResponse(200, reread.dump());
+
+    auto r = drainSync(
+        h.tickets.addCallHandlerAndGet(aid::TicketId{"42"}, aid::UserHandle{"bob"}));
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    ASSERT_TRUE(r->has_value());
+    EXPECT_EQ((*r)->lockVersion, 6);
+    ASSERT_EQ((*r)->callHandlers.size(), 1U);
+    EXPECT_EQ((*r)->callHandlers[0].v, "bob");
+    ASSERT_EQ(h.dispatcher.calls().size(), 3U);
+    EXPECT_EQ(h.dispatcher.calls()[2].method, "GET");
+}
+
 TEST(OpTicketRepo, AddCallHandlerNoOpWhenAlreadyPresent) {
     Harness h;
     json wp = json::parse(halTicket("42", 5, "/api/v3/statuses/2"));
@@ -769,6 +1277,8 @@ TEST(OpTicketRepo, FindCallTicketsInProjectsOpenPagesUntilExhausted) {
     EXPECT_NE(h.dispatcher.calls()[0].path.find("offset=1"), std::string::npos);
     EXPECT_NE(h.dispatcher.calls()[0].path.find("pageSize=1000"), std::string::npos);
     EXPECT_NE(h.dispatcher.calls()[1].path.find("offset=2"), std::string::npos);
+    // Dashboard listings carry the listing sparse fieldset on every page.
+    EXPECT_NE(h.dispatcher.calls()[1].path.find("elements%2Fdescription"), std::string::npos);
 }
 
 TEST(OpTicketRepo, GetAllPagedHonoursTotalEvenWhenServerClampsPageSize) {
@@ -800,6 +1310,22 @@ TEST(OpTicketRepo, GetAllPagedHonoursTotalEvenWhenServerClampsPageSize) {
     EXPECT_NE(h.dispatcher.calls()[2].path.find("offset=3"), std::string::npos);
 }
 
+// Once page 1 fixes the page count, the remaining pages are requested as a
+// batch; one failing page fails the whole scan (never a silently short list),
+// and every page already requested is still awaited.
+TEST(OpTicketRepo, GetAllPagedFailsWholeScanWhenALaterPageFails) {
+    Harness h;
+    h.dispatcher.enqueueResponse(200, halCollectionN(1, 100, 350));
+    h.dispatcher.enqueueResponse(200, halCollectionN(101, 100, 350));
+    h.dispatcher.enqueueResponse(500, R"({"message":"boom"})");
+    h.dispatcher.enqueueResponse(200, halCollectionN(301, 50, 350));
+
+    auto r = drainSync(h.tickets.findCallTicketsInProjectsOpen({aid::ProjectId{"11"}}));
+    ASSERT_FALSE(r.has_value());
+    ASSERT_EQ(h.dispatcher.calls().size(), 4U);
+    EXPECT_NE(h.dispatcher.calls()[3].path.find("offset=4"), std::string::npos);
+}
+
 TEST(OpTicketRepo, FindCallTicketsInProjectsOpenSinglePageIssuesOneGet) {
     Harness h;
     // A result set smaller than one page must cost exactly ONE GET — the live-
@@ -899,7 +1425,7 @@ TEST(OpTicketRepo, OpenCallsInProjectFiltersToProjectTypeAndOpenStatusesOnly) {
 TEST(OpTicketRepo, RecipientsForUnionsProjectMembersAndCallHandlers) {
     Harness h;
     // projectMembers(11): the memberships collection names two user principals
-    // by href; each is resolved to its login in a follow-up GET.
+    // by href; both are resolved to their logins in one bulk users GET.
     json memberships;
     memberships["_embedded"]["elements"] = json::array();
     for (const char* href : {"/api/v3/users/1", "/api/v3/users/2"}) {
@@ -913,10 +1439,11 @@ TEST(OpTicketRepo, RecipientsForUnionsProjectMembersAndCallHandlers) {
         u["login"] = login;
         u["id"] = id;
         u["_links"]["self"]["href"] = "/api/v3/users/" + std::to_string(id);
-        return u.dump();
+        return u;
     };
-    h.dispatcher.enqueueResponse(200, userJson("alice", 1));
-    h.dispatcher.enqueueResponse(200, userJson("bob", 2));
+    json users;
+    users["_embedded"]["elements"] = json::array({userJson("alice", 1), userJson("bob", 2)});
+    h.dispatcher.enqueueResponse(200, users.dump());
 
     aid::Ticket t;
     t.id = aid::TicketId{"42"};
@@ -931,11 +1458,38 @@ TEST(OpTicketRepo, RecipientsForUnionsProjectMembersAndCallHandlers) {
     EXPECT_EQ((*r)[1].v, "bob");
     EXPECT_EQ((*r)[2].v, "carol");
 
-    ASSERT_EQ(h.dispatcher.calls().size(), 3U);
+    ASSERT_EQ(h.dispatcher.calls().size(), 2U);
     EXPECT_NE(h.dispatcher.calls()[0].path.find("/api/v3/memberships?filters="), std::string::npos);
     EXPECT_EQ(h.dispatcher.calls()[0].path.find("/projects/"), std::string::npos);
 }
 
+// With a RecipientCache, deltas for the project are served from one built
+// set. The very first call finds the membership not cached yet and so has no
+// version to stamp its set with; the second builds the cached one.
+TEST(OpTicketRepo, RecipientsForReusesTheSetOnceMembershipIsCached) {
+    Harness h;
+    aid::adapters::openproject::RecipientCache cache;
+    OpTicketRepo tickets(h.http, h.users, h.statusMap, h.cfg, h.fields, nullptr, nullptr, nullptr,
+                         nullptr, nullptr, &cache);
+    h.dispatcher.enqueueResponse(200, emptyCollection());
+
+    aid::Ticket t;
+    t.id = aid::TicketId{"42"};
+    t.projectId = aid::ProjectId{"99"};
+    t.callHandlers = {aid::UserHandle{"carol"}};
+
+    auto first = drainSync(tickets.recipientsFor(t));
+    ASSERT_TRUE(first.has_value()) << first.error().message;
+    auto second = drainSync(tickets.recipientsFor(t));
+    auto third = drainSync(tickets.recipientsFor(t));
+    ASSERT_TRUE(second.has_value() && third.has_value());
+    EXPECT_EQ(*second, *first);
+    EXPECT_EQ(*third, *first);
+    EXPECT_EQ(cache.stats().rebuilds, 2U);
+    EXPECT_EQ(cache.stats().hits, 1U);
+    EXPECT_EQ(h.dispatcher.calls().size(), 1U) << "one memberships GET, then cache";
+}
+
 TEST(OpTicketRepo, RecipientsForWithNoMembersReturnsJustHandlers) {
     Harness h;
     h.dispatcher.enqueueResponse(200, emptyCollection());
@@ -956,7 +1510,7 @@ TEST(OpTicketRepo, RecipientsForWithNoMembersReturnsJustHandlers) {
 namespace {
 
 // A memberships collection naming the given user-principal hrefs (the shape
-// projectMembers GETs first); each principal is then resolved to its login.
+// projectMembers GETs first); the principals are then resolved to their logins.
 std::string membershipsOf(const std::vector<std::string>& principalHrefs) {
     json j;
     j["_embedded"]["elements"] = json::array();
@@ -968,12 +1522,19 @@ std::string membershipsOf(const std::vector<std::string>& principalHrefs) {
     return j.dump();
 }
 
-std::string userResourceJson(const std::string& login, int id) {
-    json u;
-    u["login"] = login;
-    u["id"] = id;
-    u["_links"]["self"]["href"] = "/api/v3/users/" + std::to_string(id);
-    return u.dump();
+// The bulk users collection (GET /api/v3/users?filters=[{"id":…}]) that
+// resolves those principals: one element per (login, id).
+std::string usersOf(const std::vector<std::pair<std::string, int>>& logins) {
+    json j;
+    j["_embedded"]["elements"] = json::array();
+    for (const auto& [login, id] : logins) {
+        json u;
+        u["login"] = login;
+        u["id"] = id;
+        u["_links"]["self"]["href"] = "/api/v3/users/" + std::to_string(id);
+        j["_embedded"]["elements"].push_back(std::move(u));
+    }
+    return j.dump();
 }
 
 aid::Ticket ticketWithHandlers(const std::vector<std::string>& logins) {
@@ -995,7 +1556,7 @@ TEST(OpTicketRepo, DroppedHandlerNonMemberIsSurfaced) {
     h.handlerLedger.record(aid::TicketId{"42"}, {aid::UserHandle{"alice"}, aid::UserHandle{"bob"}});
     // Project 11 has only alice as a member — bob is handler-only.
     h.dispatcher.enqueueResponse(200, membershipsOf({"/api/v3/users/1"}));
-    h.dispatcher.enqueueResponse(200, userResourceJson("alice", 1));
+    h.dispatcher.enqueueResponse(200, usersOf({{"alice", 1}}));
 
     // Webhook ticket now carries only alice — bob was dropped from customField7.
     auto r = drainSync(h.tickets.droppedRecipientsOnWebhook(ticketWithHandlers({"alice"})));
@@ -1011,8 +1572,7 @@ TEST(OpTicketRepo, DroppedHandlerStillMemberIsNotSurfaced) {
     h.handlerLedger.record(aid::TicketId{"42"}, {aid::UserHandle{"alice"}, aid::UserHandle{"bob"}});
     // Project 11 has both alice and bob as members.
     h.dispatcher.enqueueResponse(200, membershipsOf({"/api/v3/users/1", "/api/v3/users/2"}));
-    h.dispatcher.enqueueResponse(200, userResourceJson("alice", 1));
-    h.dispatcher.enqueueResponse(200, userResourceJson("bob", 2));
+    h.dispatcher.enqueueResponse(200, usersOf({{"alice", 1}, {"bob", 2}}));
 
     auto r = drainSync(h.tickets.droppedRecipientsOnWebhook(ticketWithHandlers({"alice"})));
     ASSERT_TRUE(r.has_value()) << r.error().message;
@@ -1049,7 +1609,7 @@ TEST(OpTicketRepo, FindArmWarmsHandlerBaselineSoLaterDropIsSurfaced) {
     // Now the admin drops bob from customField7. Project 11 has only alice as a
     // member, so the webhook must surface bob (handler-only, now removed).
     h.dispatcher.enqueueResponse(200, membershipsOf({"/api/v3/users/1"}));
-    h.dispatcher.enqueueResponse(200, userResourceJson("alice", 1));
+    h.dispatcher.enqueueResponse(200, usersOf({{"alice", 1}}));
 
     auto r = drainSync(h.tickets.droppedRecipientsOnWebhook(ticketWithHandlers({"alice"})));
     ASSERT_TRUE(r.has_value()) << r.error().message;
@@ -1078,7 +1638,7 @@ TEST(OpTicketRepo, MembershipFetchFailureRestoresBaselineForRetry) {
     // Because the prior baseline {alice, bob} was restored on the error path, this
     // re-diffs to {bob} and surfaces him — proving the drop was not lost.
     h.dispatcher.enqueueResponse(200, membershipsOf({"/api/v3/users/1"}));
-    h.dispatcher.enqueueResponse(200, userResourceJson("alice", 1));
+    h.dispatcher.enqueueResponse(200, usersOf({{"alice", 1}}));
     auto second = drainSync(h.tickets.droppedRecipientsOnWebhook(ticketWithHandlers({"alice"})));
     ASSERT_TRUE(second.has_value()) << second.error().message;
     ASSERT_EQ(second->size(), 1U) << "restored baseline ⇒ the drop retries and surfaces bob";
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <nlohmann/json.hpp>
 #include <string>
 #include <utility>
@@ -191,16 +192,25 @@ std::string userResource(const std::string& login, int id) {
     return u.dump();
 }
 
+// The bulk answer to GET /api/v3/users?filters=[{"id":…}]: one element per
+// (login, id).
+std::string usersById(const std::vector<std::pair<std::string, int>>& logins) {
+    json j;
+    j["_embedded"]["elements"] = json::array();
+    for (const auto& lg : logins)
+        j["_embedded"]["elements"].push_back(json::parse(userResource(lg.first, lg.second)));
+    return j.dump();
+}
+
 } // namespace
 
 TEST(OpUserRepo, ProjectMembersQueriesMembershipsAndResolvesLogins) {
     FakeHttpDispatcher d;
     FakeSleeper s;
-    // 1) the memberships collection (two user principals), then 2) one GET per
-    // principal href to resolve its login. Scripted responses are served FIFO.
+    // 1) the memberships collection (two user principals), then 2) ONE bulk
+    // users GET resolving both logins. Scripted responses are served FIFO.
     d.enqueueResponse(200, membershipsCollectionWith({"/api/v3/users/9", "/api/v3/users/5"}));
-    d.enqueueResponse(200, userResource("alice", 9));
-    d.enqueueResponse(200, userResource("bob", 5));
+    d.enqueueResponse(200, usersById({{"alice", 9}, {"bob", 5}}));
     OpHttp http(d, "http://op.example.com", "t", s.sleeper());
     OpUserRepo users(http);
 
@@ -210,7 +220,7 @@ TEST(OpUserRepo, ProjectMembersQueriesMembershipsAndResolvesLogins) {
     EXPECT_EQ((*members)[0].v, "alice");
     EXPECT_EQ((*members)[1].v, "bob");
 
-    ASSERT_EQ(d.calls().size(), 3U);
+    ASSERT_EQ(d.calls().size(), 2U);
     // The collection query must hit the memberships endpoint with an encoded
     // project filter — NOT the non-existent /projects/{id}/members route.
     EXPECT_EQ(d.calls()[0].method, "GET");
@@ -218,16 +228,18 @@ TEST(OpUserRepo, ProjectMembersQueriesMembershipsAndResolvesLogins) {
     EXPECT_EQ(d.calls()[0].path.find("/projects/"), std::string::npos)
         << "must not use the non-existent /api/v3/projects/<id>/members route";
     EXPECT_NE(d.calls()[0].path.find("%22"), std::string::npos); // filter JSON is encoded
-    // Then each principal href is fetched verbatim to read its login.
-    EXPECT_EQ(d.calls()[1].path, "/api/v3/users/9");
-    EXPECT_EQ(d.calls()[2].path, "/api/v3/users/5");
+    // Then both principals are resolved by one id-filtered users query.
+    EXPECT_NE(d.calls()[1].path.find("/api/v3/users?filters="), std::string::npos);
+    EXPECT_NE(d.calls()[1].path.find("%22id%22"), std::string::npos);
+    EXPECT_NE(d.calls()[1].path.find("%229%22"), std::string::npos);
+    EXPECT_NE(d.calls()[1].path.find("%225%22"), std::string::npos);
 }
 
 TEST(OpUserRepo, ProjectMembersCachesPerProject) {
     FakeHttpDispatcher d;
     FakeSleeper s;
     d.enqueueResponse(200, membershipsCollectionWith({"/api/v3/users/9"}));
-    d.enqueueResponse(200, userResource("alice", 9));
+    d.enqueueResponse(200, usersById({{"alice", 9}}));
     OpHttp http(d, "http://op.example.com", "t", s.sleeper());
     OpUserRepo users(http);
 
@@ -246,10 +258,10 @@ TEST(OpUserRepo, ProjectMembersCachesPerProject) {
 TEST(OpUserRepo, ProjectMembersSkipsNonUserPrincipals) {
     FakeHttpDispatcher d;
     FakeSleeper s;
-    // A group principal has no login to notify and must NOT trigger a resolve
-    // GET; only the user principal is fetched and returned.
+    // A group principal has no login to notify and must NOT be resolved; only
+    // the user principal is looked up and returned.
     d.enqueueResponse(200, membershipsCollectionWith({"/api/v3/groups/3", "/api/v3/users/9"}));
-    d.enqueueResponse(200, userResource("alice", 9));
+    d.enqueueResponse(200, usersById({{"alice", 9}}));
     OpHttp http(d, "http://op.example.com", "t", s.sleeper());
     OpUserRepo users(http);
 
@@ -257,7 +269,9 @@ TEST(OpUserRepo, ProjectMembersSkipsNonUserPrincipals) {
     ASSERT_TRUE(members.has_value()) << members.error().message;
     ASSERT_EQ(members->size(), 1U);
     EXPECT_EQ((*members)[0].v, "alice");
-    EXPECT_EQ(d.calls().size(), 2U) << "group principal must not be resolved";
+    ASSERT_EQ(d.calls().size(), 2U);
+    EXPECT_EQ(d.calls()[1].path.find("%223%22"), std::string::npos)
+        << "group principal must not be resolved";
 }
 
 TEST(OpUserRepo, ProjectMembersSkipsUserPrincipalWithoutLogin) {
@@ -267,7 +281,8 @@ TEST(OpUserRepo, ProjectMembersSkipsUserPrincipalWithoutLogin) {
     // skipped rather than turned into a numeric-id handle (which would never
     // match the session login the WS hub keys on).
     d.enqueueResponse(200, membershipsCollectionWith({"/api/v3/users/9"}));
-    d.enqueueResponse(200, R"({"id":9,"_type":"User"})"); // no login field
+    d.enqueueResponse(200, emptyCollection()); // bulk query: user not returned
+    d.enqueueResponse(200, R"({"id":9,"_type":"User"})"); // by href: no login field
     OpHttp http(d, "http://op.example.com", "t", s.sleeper());
     OpUserRepo users(http);
 
@@ -276,6 +291,58 @@ TEST(OpUserRepo, ProjectMembersSkipsUserPrincipalWithoutLogin) {
     EXPECT_TRUE(members->empty());
 }
 
+// 150 cold principals cost two chunked users GETs (100 + 50 ids), not 150.
+TEST(OpUserRepo, ProjectMembersResolvesPrincipalsInChunks) {
+    FakeHttpDispatcher d;
+    FakeSleeper s;
+    std::vector<std::string> hrefs;
+    std::vector<std::pair<std::string, int>> first;
+    std::vector<std::pair<std::string, int>> second;
+    for (int id = 1; id <= 150; ++id) {
+        hrefs.push_back("/api/v3/users/" + std::to_string(id));
+        (id <= 100 ? first : second).emplace_back("user" + std::to_string(id), id);
+    }
+    d.enqueueResponse(200, membershipsCollectionWith(hrefs));
+    d.enqueueResponse(200, usersById(first));
+    d.enqueueResponse(200, usersById(second));
+    OpHttp http(d, "http://op.example.com", "t", s.sleeper());
+    OpUserRepo users(http);
+
+    auto members = drainSync(users.projectMembers(aid::ProjectId{"11"}));
+    ASSERT_TRUE(members.has_value()) << members.error().message;
+    ASSERT_EQ(members->size(), 150U);
+    EXPECT_EQ((*members)[0].v, "user1");
+    EXPECT_EQ((*members)[149].v, "user150");
+
+    ASSERT_EQ(d.calls().size(), 3U) << "one memberships GET + two bulk users GETs";
+    EXPECT_NE(d.calls()[1].path.find("pageSize=100"), std::string::npos);
+    EXPECT_NE(d.calls()[2].path.find("pageSize=50"), std::string::npos);
+
+    // Reverse-warmed: hrefFor on a resolved member is now a cache hit.
+    auto href = drainSync(users.hrefFor(aid::UserHandle{"user42"}));
+    ASSERT_TRUE(href.has_value());
+    EXPECT_EQ(*href, "/api/v3/users/42");
+    EXPECT_EQ(d.calls().size(), 3U);
+}
+
+// A failed bulk query is not fatal: its principals fall back to one GET each.
+TEST(OpUserRepo, ProjectMembersFallsBackPerPrincipalWhenBulkFails) {
+    FakeHttpDispatcher d;
+    FakeSleeper s;
+    d.enqueueResponse(200, membershipsCollectionWith({"/api/v3/users/9"}));
+    d.enqueueError(aid::plumbing::ErrorCode::UpstreamUnavailable, "bulk 503");
+    d.enqueueResponse(200, userResource("alice", 9));
+    OpHttp http(d, "http://op.example.com", "t", s.sleeper());
+    OpUserRepo users(http);
+
+    auto members = drainSync(users.projectMembers(aid::ProjectId{"11"}));
+    ASSERT_TRUE(members.has_value()) << members.error().message;
+    ASSERT_EQ(members->size(), 1U);
+    EXPECT_EQ((*members)[0].v, "alice");
+    ASSERT_EQ(d.calls().size(), 3U);
+    EXPECT_EQ(d.calls()[2].path, "/api/v3/users/9");
+}
+
 TEST(OpUserRepo, ProjectMembersEmptyCollectionReturnsEmptyVector) {
     FakeHttpDispatcher d;
     FakeSleeper s;
@@ -295,16 +362,19 @@ namespace {
 // A batched memberships collection (GET /api/v3/memberships?filters=[project in
 // (…)]) where each element names BOTH its project and its principal by href —
 // refreshMembership reads the project href to bucket each principal. `total` is
-// the authoritative HAL match count the pagination loop stops on.
+// the authoritative HAL match count the pagination loop stops on. A non-empty
+// `updatedAt` is stamped on every element.
 std::string
 membershipsBatch(const std::vector<std::pair<std::string, std::string>>& projectAndPrincipalHrefs,
-                 long long total) {
+                 long long total, const std::string& updatedAt = {}) {
     json j;
     j["_embedded"]["elements"] = json::array();
     for (const auto& pr : projectAndPrincipalHrefs) {
         json one;
         one["_links"]["project"]["href"] = pr.first;
         one["_links"]["principal"]["href"] = pr.second;
+        if (!updatedAt.empty())
+            one["updatedAt"] = updatedAt;
         j["_embedded"]["elements"].push_back(std::move(one));
     }
     j["total"] = total;
@@ -312,16 +382,15 @@ membershipsBatch(const std::vector<std::pair<std::string, std::string>>& project
 }
 
 // Prime membersCache_ for project 11 with the given user logins (one membership
-// element + one resolve GET per login), so a subsequent refreshMembership has a
-// cached baseline to diff against. Returns after the cache is warm.
+// element per login + one bulk resolve GET), so a subsequent refreshMembership
+// has a cached baseline to diff against. Returns after the cache is warm.
 void primeProject11(FakeHttpDispatcher& d, OpUserRepo& users,
                     const std::vector<std::pair<std::string, int>>& logins) {
     std::vector<std::string> hrefs;
     for (const auto& lg : logins)
         hrefs.push_back("/api/v3/users/" + std::to_string(lg.second));
     d.enqueueResponse(200, membershipsCollectionWith(hrefs));
-    for (const auto& lg : logins)
-        d.enqueueResponse(200, userResource(lg.first, lg.second));
+    d.enqueueResponse(200, usersById(logins));
     auto primed = drainSync(users.projectMembers(aid::ProjectId{"11"}));
     ASSERT_TRUE(primed.has_value()) << primed.error().message;
 }
@@ -353,7 +422,7 @@ TEST(OpUserRepo, RefreshMembershipDetectsAddedMember) {
     d.enqueueResponse(200, membershipsBatch({{"/api/v3/projects/11", "/api/v3/users/9"},
                                              {"/api/v3/projects/11", "/api/v3/users/5"}},
                                             2));
-    d.enqueueResponse(200, userResource("bob", 5)); // bob is new → one resolve GET
+    d.enqueueResponse(200, usersById({{"bob", 5}})); // bob is new → one bulk resolve GET
 
     auto deltas = drainSync(users.refreshMembership());
     ASSERT_TRUE(deltas.has_value()) << deltas.error().message;
@@ -384,6 +453,33 @@ TEST(OpUserRepo, RefreshMembershipDetectsRemovedMember) {
     EXPECT_EQ((*deltas)[0].removed[0].v, "bob");
 }
 
+TEST(OpUserRepo, MembershipVersionMovesOnlyWithTheMemberSet) {
+    FakeHttpDispatcher d;
+    FakeSleeper s;
+    OpHttp http(d, "http://op.example.com", "t", s.sleeper());
+    OpUserRepo users(http);
+
+    EXPECT_FALSE(users.membershipVersion(aid::ProjectId{"11"}).has_value());
+    primeProject11(d, users, {{"alice", 9}});
+    const auto primed = users.membershipVersion(aid::ProjectId{"11"});
+    ASSERT_TRUE(primed.has_value());
+
+    // Unchanged set: same version.
+    d.enqueueResponse(200, membershipsBatch({{"/api/v3/projects/11", "/api/v3/users/9"}}, 1));
+    ASSERT_TRUE(drainSync(users.refreshMembership()).has_value());
+    EXPECT_EQ(users.membershipVersion(aid::ProjectId{"11"}), primed);
+
+    // bob joins: bumped.
+    d.enqueueResponse(200, membershipsBatch({{"/api/v3/projects/11", "/api/v3/users/9"},
+                                             {"/api/v3/projects/11", "/api/v3/users/5"}},
+                                            2));
+    d.enqueueResponse(200, usersById({{"bob", 5}}));
+    ASSERT_TRUE(drainSync(users.refreshMembership()).has_value());
+    const auto joined = users.membershipVersion(aid::ProjectId{"11"});
+    ASSERT_TRUE(joined.has_value());
+    EXPECT_GT(*joined, *primed);
+}
+
 TEST(OpUserRepo, RefreshMembershipUnchangedProducesNoDelta) {
     FakeHttpDispatcher d;
     FakeSleeper s;
@@ -415,7 +511,7 @@ TEST(OpUserRepo, RefreshMembershipPaginatesAcrossPages) {
     // a new member carol — so the page-2 contents must be folded into the diff.
     d.enqueueResponse(200, membershipsBatch({{"/api/v3/projects/11", "/api/v3/users/9"}}, 2));
     d.enqueueResponse(200, membershipsBatch({{"/api/v3/projects/11", "/api/v3/users/7"}}, 2));
-    d.enqueueResponse(200, userResource("carol", 7)); // carol is new → resolve GET
+    d.enqueueResponse(200, usersById({{"carol", 7}})); // carol is new → bulk resolve GET
 
     const std::size_t before = d.calls().size();
     auto deltas = drainSync(users.refreshMembership());
@@ -477,3 +573,116 @@ TEST(OpUserRepo, RefreshMembershipFetchErrorIsTreatedAsNoChange) {
     EXPECT_EQ((*members)[0].v, "alice");
     EXPECT_EQ(d.calls().size(), after) << "cache must survive a failed refresh";
 }
+
+// After a full sweep has stamped a watermark, the next poll asks only for the
+// memberships changed since it: a member it returns is added, and one it does
+// not return is NOT read as removed.
+TEST(OpUserRepo, RefreshMembershipReadsForwardFromTheWatermark) {
+    FakeHttpDispatcher d;
+    FakeSleeper s;
+    OpHttp http(d, "http://op.example.com", "t", s.sleeper());
+    aid::Timestamp now{std::chrono::seconds{1700000000}};
+    OpUserRepo users(http, [&now] { return now; });
+
+    primeProject11(d, users, {{"alice", 9}});
+
+    // First refresh: a full sweep, no updatedAt filter.
+    d.enqueueResponse(200, membershipsBatch({{"/api/v3/projects/11", "/api/v3/users/9"}}, 1,
+                                            "2024-01-15T10:00:00Z"));
+    auto full = drainSync(users.refreshMembership());
+    ASSERT_TRUE(full.has_value()) << full.error().message;
+    EXPECT_TRUE(full->empty());
+    EXPECT_EQ(d.calls().back().path.find("updatedAt"), std::string::npos);
+
+    // Second refresh: incremental. Only bob's new membership comes back.
+    now += std::chrono::seconds{30};
+    d.enqueueResponse(200, membershipsBatch({{"/api/v3/projects/11", "/api/v3/users/5"}}, 1,
+                                            "2024-01-15T10:05:00Z"));
+    d.enqueueResponse(200, usersById({{"bob", 5}}));
+    const std::size_t before = d.calls().size();
+    auto deltas = drainSync(users.refreshMembership());
+    ASSERT_TRUE(deltas.has_value()) << deltas.error().message;
+    ASSERT_EQ(deltas->size(), 1U);
+    ASSERT_EQ((*deltas)[0].added.size(), 1U);
+    EXPECT_EQ((*deltas)[0].added[0].v, "bob");
+    EXPECT_TRUE((*deltas)[0].removed.empty()) << "alice is merely unchanged";
+    EXPECT_NE(d.calls()[before].path.find("updatedAt"), std::string::npos);
+
+    // A quiet incremental poll is an empty page and no delta.
+    d.enqueueResponse(200, membershipsBatch({}, 0));
+    auto quiet = drainSync(users.refreshMembership());
+    ASSERT_TRUE(quiet.has_value());
+    EXPECT_TRUE(quiet->empty());
+
+    // The cache holds both.
+    auto members = drainSync(users.projectMembers(aid::ProjectId{"11"}));
+    ASSERT_TRUE(members.has_value());
+    EXPECT_EQ(members->size(), 2U);
+}
+
+// A tracked project with no memberships returns no rows to take a watermark
+// from; it must not hold every later poll to a full sweep. The sweep's own
+// server-side updatedAt stands in for it, never the local clock, and a
+// project first fetched empty outside a sweep waits for the next full one.
+TEST(OpUserRepo, RefreshMembershipEmptyProjectPollsFromTheServersClock) {
+    FakeHttpDispatcher d;
+    FakeSleeper s;
+    OpHttp http(d, "http://op.example.com", "t", s.sleeper());
+    aid::Timestamp now{std::chrono::seconds{1700000000}};
+    OpUserRepo users(http, [&now] { return now; });
+
+    primeProject11(d, users, {{"alice", 9}});
+    d.enqueueResponse(200, emptyCollection());
+    ASSERT_TRUE(drainSync(users.projectMembers(aid::ProjectId{"12"})).has_value());
+
+    d.enqueueResponse(200, membershipsBatch({{"/api/v3/projects/11", "/api/v3/users/9"}}, 1,
+                                            "2024-01-15T10:00:00Z"));
+    auto full = drainSync(users.refreshMembership());
+    ASSERT_TRUE(full.has_value()) << full.error().message;
+    EXPECT_EQ(d.calls().back().path.find("updatedAt"), std::string::npos);
+
+    now += std::chrono::seconds{30};
+    d.enqueueResponse(200, membershipsBatch({}, 0));
+    auto quiet = drainSync(users.refreshMembership());
+    ASSERT_TRUE(quiet.has_value()) << quiet.error().message;
+    EXPECT_TRUE(quiet->empty());
+    EXPECT_NE(d.calls().back().path.find("updatedAt"), std::string::npos);
+    EXPECT_NE(d.calls().back().path.find("2024-01-15T10"), std::string::npos)
+        << "the window must start at a server timestamp, not the local clock";
+
+    d.enqueueResponse(200, emptyCollection());
+    ASSERT_TRUE(drainSync(users.projectMembers(aid::ProjectId{"13"})).has_value());
+    now += std::chrono::seconds{30};
+    d.enqueueResponse(200, membershipsBatch({}, 0));
+    auto unbounded = drainSync(users.refreshMembership());
+    ASSERT_TRUE(unbounded.has_value()) << unbounded.error().message;
+    EXPECT_EQ(d.calls().back().path.find("updatedAt"), std::string::npos);
+}
+
+// Once kFullSweepInterval has passed the poll is a full sweep again, and a
+// deleted membership is seen as a removal.
+TEST(OpUserRepo, RefreshMembershipFullSweepAfterIntervalSeesRemovals) {
+    FakeHttpDispatcher d;
+    FakeSleeper s;
+    OpHttp http(d, "http://op.example.com", "t", s.sleeper());
+    aid::Timestamp now{std::chrono::seconds{1700000000}};
+    OpUserRepo users(http, [&now] { return now; });
+
+    primeProject11(d, users, {{"alice", 9}, {"bob", 5}});
+    d.enqueueResponse(200, membershipsBatch({{"/api/v3/projects/11", "/api/v3/users/9"},
+                                             {"/api/v3/projects/11", "/api/v3/users/5"}},
+                                            2, "2024-01-15T10:00:00Z"));
+    auto first = drainSync(users.refreshMembership());
+    ASSERT_TRUE(first.has_value()) << first.error().message;
+
+    now += OpUserRepo::kFullSweepInterval;
+    d.enqueueResponse(200, membershipsBatch({{"/api/v3/projects/11", "/api/v3/users/9"}}, 1,
+                                            "2024-01-15T10:00:00Z"));
+    const std::size_t before = d.calls().size();
+    auto deltas = drainSync(users.refreshMembership());
+    ASSERT_TRUE(deltas.has_value()) << deltas.error().message;
+    EXPECT_EQ(d.calls()[before].path.find("updatedAt"), std::string::npos);
+    ASSERT_EQ(deltas->size(), 1U);
+    ASSERT_EQ((*deltas)[0].removed.size(), 1U);
+    EXPECT_EQ((*deltas)[0].removed[0].v, "bob");
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "aid/adapters/openproject/internal/OpenCallView.h"
+#include "aid/value-types/Ids.h"
+#include "aid/value-types/Ticket.h"
+
+using aid::ProjectId;
+using aid::TicketId;
+using aid::TicketStatus;
+using aid::UserHandle;
+using aid::adapters::openproject::OpenCallView;
+
+namespace {
+
+aid::Ticket ticket(const std::string& id, const std::string& project, int lockVersion,
+                   TicketStatus status = TicketStatus::New,
+                   std::vector<UserHandle> handlers = {}) {
+    aid::Ticket t;
+    t.id = TicketId{id};
+    t.projectId = ProjectId{project};
+    t.lockVersion = lockVersion;
+    t.status = status;
+    t.callHandlers = std::move(handlers);
+    return t;
+}
+
+std::vector<std::string> idsOf(const OpenCallView::Selection& s) {
+    std::vector<std::string> ids;
+    for (const auto& t : s.tickets)
+        ids.push_back(t.id.v);
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+// A clock the test moves by hand.
+struct FakeClock {
+    aid::Timestamp now{std::chrono::seconds{1700000000}};
+    OpenCallView::Clock clock() {
+        return [this] { return now; };
+    }
+};
+
+const std::vector<ProjectId> kP11{ProjectId{"11"}};
+
+} // namespace
+
+// A viewer sees the rows of their member projects plus the rows naming them as
+// a call handler, and nothing else.
+TEST(OpenCallView, SelectIsMemberProjectsPlusHandledTickets) {
+    OpenCallView view;
+    view.apply(ticket("1", "11", 1));
+    view.apply(ticket("2", "99", 1, TicketStatus::InProgress, {UserHandle{"alice"}}));
+    view.apply(ticket("3", "99", 1, TicketStatus::New, {UserHandle{"malice"}}));
+
+    const auto sel = view.select(UserHandle{"alice"}, kP11);
+    EXPECT_EQ(idsOf(sel), (std::vector<std::string>{"1", "2"}));
+}
+
+// Live deltas: a newer lockVersion replaces the row, an older one is ignored,
+// and a Closed ticket leaves the view.
+TEST(OpenCallView, ApplyKeepsTheNewestVersionAndDropsClosed) {
+    OpenCallView view;
+    auto v3 = ticket("1", "11", 3);
+    v3.subject = "v3";
+    view.apply(v3);
+    auto v2 = ticket("1", "11", 2);
+    v2.subject = "v2";
+    view.apply(v2);
+    auto sel = view.select(UserHandle{"alice"}, kP11);
+    ASSERT_EQ(sel.tickets.size(), 1U);
+    EXPECT_EQ(sel.tickets[0].subject, "v3");
+
+    view.apply(ticket("1", "11", 4, TicketStatus::Closed));
+    EXPECT_EQ(view.size(), 0U);
+}
+
+// A seed replaces its projects' rows: a row it no longer lists goes, unless it
+// was written after the scan started.
+TEST(OpenCallView, SeedDropsMissingRowsButNotLaterWrites) {
+    OpenCallView view;
+    view.apply(ticket("1", "11", 1)); // closed upstream without us seeing it
+    const auto since = view.version();
+    view.apply(ticket("2", "11", 1)); // created while the scan was in flight
+    view.seedProjects(kP11, {ticket("3", "11", 1)}, since);
+
+    EXPECT_EQ(idsOf(view.select(UserHandle{"alice"}, kP11)),
+              (std::vector<std::string>{"2", "3"}));
+}
+
+// A ticket closed while a scan was in flight is not brought back by it.
+TEST(OpenCallView, TombstoneStopsAnInFlightScanResurrectingAClosedTicket) {
+    OpenCallView view;
+    view.apply(ticket("1", "11", 1));
+    const auto since = view.version();
+    view.apply(ticket("1", "11", 2, TicketStatus::Closed));
+    view.seedProjects(kP11, {ticket("1", "11", 1)}, since);
+    EXPECT_EQ(view.size(), 0U);
+
+    // ...but a genuine reopen (a newer version) is admitted.
+    view.apply(ticket("1", "11", 3, TicketStatus::InProgress));
+    EXPECT_EQ(view.size(), 1U);
+}
+
+// The handler scan prunes only the cross-project rows; a row of a project with
+// a current seed of its own is that seed's to drop.
+TEST(OpenCallView, HandlerSeedLeavesSeededProjectsAlone) {
+    OpenCallView view;
+    const UserHandle alice{"alice"};
+    view.seedProjects(kP11, {ticket("1", "11", 1, TicketStatus::New, {alice})}, view.version());
+    view.apply(ticket("2", "99", 1, TicketStatus::New, {alice}));
+    view.seedHandler(alice, {}, view.version());
+
+    EXPECT_EQ(idsOf(view.select(alice, {})), (std::vector<std::string>{"1"}));
+}
+
+// Seeds, the cached project list and the stamp all run on the reconcile clock.
+TEST(OpenCallView, SeedsGoStaleAfterTheReconcileInterval) {
+    FakeClock clock;
+    OpenCallView view{clock.clock()};
+    const UserHandle alice{"alice"};
+    EXPECT_EQ(view.staleProjects(kP11).size(), 1U);
+    EXPECT_TRUE(view.handlerStale(alice));
+    EXPECT_FALSE(view.projectsFor(alice).has_value());
+
+    const auto seededAt = clock.now;
+    view.rememberProjects(alice, kP11);
+    view.seedProjects(kP11, {ticket("1", "11", 1)}, view.version());
+    view.seedHandler(alice, {}, view.version());
+    EXPECT_TRUE(view.staleProjects(kP11).empty());
+    EXPECT_FALSE(view.handlerStale(alice));
+    ASSERT_TRUE(view.projectsFor(alice).has_value());
+
+    const auto sel = view.select(alice, kP11);
+    EXPECT_EQ(sel.stamp.reconciledAt, seededAt);
+    EXPECT_EQ(sel.stamp.version, view.version());
+
+    clock.now += OpenCallView::kReconcileInterval;
+    EXPECT_EQ(view.staleProjects(kP11).size(), 1U);
+    EXPECT_TRUE(view.handlerStale(alice));
+    EXPECT_FALSE(view.projectsFor(alice).has_value());
+}
+
+// A membership change invalidates every cached project list at once.
+TEST(OpenCallView, ForgetProjectsDropsEveryCachedList) {
+    OpenCallView view;
+    view.rememberProjects(UserHandle{"alice"}, kP11);
+    view.rememberProjects(UserHandle{"bob"}, kP11);
+    view.forgetProjects();
+    EXPECT_FALSE(view.projectsFor(UserHandle{"alice"}).has_value());
+    EXPECT_FALSE(view.projectsFor(UserHandle{"bob"}).has_value());
+}
+
+// The version only grows, and moves on every change a viewer could see.
+TEST(OpenCallView, VersionAdvancesOnEveryChange) {
+    OpenCallView view;
+    const auto v0 = view.version();
+    view.apply(ticket("1", "11", 1));
+    const auto v1 = view.version();
+    EXPECT_GT(v1, v0);
+    view.apply(ticket("1", "11", 1)); // same version again: no change
+    EXPECT_EQ(view.version(), v1);
+    view.forget(TicketId{"1"});
+    EXPECT_GT(view.version(), v1);
+}
@@ -15,10 +15,12 @@
 #include "aid/value-types/Ticket.h"
 
 using aid::adapters::openproject::CustomFieldMap;
+using aid::adapters::openproject::HalProjection;
 using aid::adapters::openproject::OpStatusMap;
 using aid::adapters::openproject::parseFromHal;
 using aid::adapters::openproject::toCreatePayload;
 using aid::adapters::openproject::toPatchPayload;
+using aid::adapters::openproject::workPackageSelect;
 using aid::crosscutting::TicketSystemConfig;
 using aid::plumbing::ErrorCode;
 using json = nlohmann::json;
@@ -75,6 +77,30 @@ json halBody() {
 })json");
 }
 
+// What OpenProject returns for one collection element under `select`: the
+// selected attributes / custom fields, the selected relations as _links, and
+// the self link. Everything else (other links, _embedded) is dropped.
+json projectElement(const json& hal, const std::string& select) {
+    json out;
+    out["_links"]["self"] = hal["_links"]["self"];
+    std::size_t pos = 0;
+    while (pos <= select.size()) {
+        std::size_t comma = select.find(',', pos);
+        if (comma == std::string::npos)
+            comma = select.size();
+        const std::string entry = select.substr(pos, comma - pos);
+        pos = comma + 1;
+        if (entry.rfind("elements/", 0) != 0)
+            continue;
+        const std::string key = entry.substr(9);
+        if (hal.contains(key))
+            out[key] = hal[key];
+        if (hal["_links"].contains(key))
+            out["_links"][key] = hal["_links"][key];
+    }
+    return out;
+}
+
 } // namespace
 
 // ─── parseFromHal ────────────────────────────────────────────────────────
@@ -521,3 +547,64 @@ TEST(PayloadRoundTrip, CallHandlersSurviveParseThenCallHandlerPatch) {
     const auto body = toCallHandlerPatch(parsed->lockVersion, parsed->callHandlers, sampleFields());
     EXPECT_EQ(body["customField7"]["raw"], "alice, bob, carol");
 }
+
+// ─── workPackageSelect ────────────────────────────────────────────────────
+
+// The listing projection keeps every key parseFromHal reads: a collection
+// element cut down to it parses to the same Ticket as the full element. (No
+// _embedded on either side — collection queries never ?include=assignee.)
+TEST(WorkPackageSelect, ListingProjectionParsesLikeTheFullBody) {
+    const auto m = OpStatusMap::fromConfig(sampleCfg());
+    auto full = halBody();
+    full.erase("_embedded");
+    const auto select = workPackageSelect(sampleFields(), HalProjection::Listing);
+    const auto projected = projectElement(full, select);
+    EXPECT_FALSE(projected["_links"].contains("type"));
+
+    auto a = parseFromHal(full, sampleFields(), m);
+    auto b = parseFromHal(projected, sampleFields(), m);
+    ASSERT_TRUE(a.has_value()) << a.error().message;
+    ASSERT_TRUE(b.has_value()) << b.error().message;
+    EXPECT_EQ(b->id.v, a->id.v);
+    EXPECT_EQ(b->projectId.v, a->projectId.v);
+    EXPECT_EQ(b->subject, a->subject);
+    EXPECT_EQ(b->status, a->status);
+    EXPECT_EQ(b->statusId.v, a->statusId.v);
+    ASSERT_TRUE(b->assignee.has_value());
+    EXPECT_EQ(b->assignee->v, a->assignee->v);
+    EXPECT_EQ(b->callIds.size(), a->callIds.size());
+    EXPECT_EQ(b->callerNumber.v, a->callerNumber.v);
+    ASSERT_TRUE(b->calledNumber.has_value());
+    EXPECT_EQ(b->calledNumber->v, a->calledNumber->v);
+    EXPECT_EQ(b->callStart.has_value(), a->callStart.has_value());
+    EXPECT_EQ(b->callEnd.has_value(), a->callEnd.has_value());
+    EXPECT_EQ(b->description, a->description);
+    EXPECT_EQ(b->callLength, a->callLength);
+    EXPECT_EQ(b->callHandlers.size(), a->callHandlers.size());
+    EXPECT_EQ(b->updatedAt, a->updatedAt);
+    EXPECT_EQ(b->lockVersion, a->lockVersion);
+    EXPECT_LT(projected.dump().size(), full.dump().size());
+}
+
+// The routing projection drops only the long-text bodies.
+TEST(WorkPackageSelect, RoutingProjectionOmitsOnlyLongTextBodies) {
+    const auto m = OpStatusMap::fromConfig(sampleCfg());
+    auto full = halBody();
+    full.erase("_embedded");
+    const auto select = workPackageSelect(sampleFields(), HalProjection::Routing);
+    EXPECT_EQ(select.rfind("total,count,", 0), 0U) << select;
+    EXPECT_EQ(select.find("elements/description"), std::string::npos);
+    EXPECT_EQ(select.find("elements/customField6"), std::string::npos);
+
+    auto r = parseFromHal(projectElement(full, select), sampleFields(), m);
+    ASSERT_TRUE(r.has_value()) << r.error().message;
+    EXPECT_EQ(r->id.v, "42");
+    EXPECT_EQ(r->projectId.v, "11");
+    EXPECT_EQ(r->status, aid::TicketStatus::InProgress);
+    EXPECT_EQ(r->callerNumber.v, "+491234");
+    EXPECT_EQ(r->callIds.size(), 2U);
+    EXPECT_EQ(r->callHandlers.size(), 2U);
+    EXPECT_EQ(r->lockVersion, 3);
+    EXPECT_TRUE(r->description.empty());
+    EXPECT_TRUE(r->callLength.empty());
+}
@@ -1,12 +1,16 @@
 #include <gtest/gtest.h>
 
+#include <optional>
+
 #include "aid/adapters/openproject/internal/ProducedLedger.h"
 #include "aid/value-types/Ids.h"
+#include "tests/adapters/openproject_plugin/fake_http_dispatcher.h"
 
 namespace {
 
 using aid::TicketId;
 using aid::adapters::openproject::ProducedLedger;
+using aid::test_support::FakeSleeper;
 
 // The core Phase-6 echo-suppression predicate: a produced (id, version) pair is
 // recognised, and ONLY that exact pair — never a neighbouring version, which is
@@ -59,4 +63,69 @@ TEST(ProducedLedger, ContainsIsRepeatableNotConsumed) {
     EXPECT_TRUE(ledger.contains(TicketId{"9"}, 2));
 }
 
+// A write is in flight for exactly the lifetime of its PendingWrite, and only
+// for its own ticket.
+TEST(ProducedLedger, PendingWriteMarksItsTicketInFlight) {
+    ProducedLedger ledger;
+    EXPECT_FALSE(ledger.writeInFlight(TicketId{"42"}));
+    {
+        const ProducedLedger::PendingWrite pending{&ledger, TicketId{"42"}};
+        EXPECT_TRUE(ledger.writeInFlight(TicketId{"42"}));
+        EXPECT_FALSE(ledger.writeInFlight(TicketId{"43"}));
+    }
+    EXPECT_FALSE(ledger.writeInFlight(TicketId{"42"}));
+}
+
+// A create does not know its id yet, so it holds every ticket in flight.
+TEST(ProducedLedger, PendingCreateMarksEveryTicketInFlight) {
+    ProducedLedger ledger;
+    {
+        const ProducedLedger::PendingWrite pending{&ledger, std::nullopt};
+        EXPECT_TRUE(ledger.writeInFlight(TicketId{"1"}));
+        EXPECT_TRUE(ledger.writeInFlight(TicketId{"2"}));
+    }
+    EXPECT_FALSE(ledger.writeInFlight(TicketId{"1"}));
+}
+
+// The webhook echo check: an external edit, with no write of ours pending,
+// is answered at once — no grace sleep.
+TEST(ProducedLedger, ExternalEditWithNoPendingWriteDoesNotSleep) {
+    ProducedLedger ledger;
+    ledger.record(TicketId{"42"}, 5);
+    FakeSleeper sleeper;
+
+    auto echo = ledger.isEcho(TicketId{"42"}, 6, sleeper.sleeper());
+    ASSERT_TRUE(echo.done());
+    EXPECT_FALSE(echo.await_resume());
+    EXPECT_TRUE(sleeper.durations.empty());
+}
+
+// While a write to another ticket is pending, this one's edit still passes
+// straight through.
+TEST(ProducedLedger, OtherTicketsPendingWriteDoesNotDelayAnEdit) {
+    ProducedLedger ledger;
+    const ProducedLedger::PendingWrite pending{&ledger, TicketId{"43"}};
+    FakeSleeper sleeper;
+
+    auto echo = ledger.isEcho(TicketId{"42"}, 6, sleeper.sleeper());
+    ASSERT_TRUE(echo.done());
+    EXPECT_FALSE(echo.await_resume());
+    EXPECT_TRUE(sleeper.durations.empty());
+}
+
+// A write that never records the webhook's version is waited out for the
+// grace delay, then the edit passes.
+TEST(ProducedLedger, PendingWriteIsWaitedOutForAtMostTheGraceDelay) {
+    ProducedLedger ledger;
+    const ProducedLedger::PendingWrite pending{&ledger, TicketId{"42"}};
+    FakeSleeper sleeper;
+
+    auto echo = ledger.isEcho(TicketId{"42"}, 6, sleeper.sleeper());
+    ASSERT_TRUE(echo.done());
+    EXPECT_FALSE(echo.await_resume());
+    EXPECT_EQ(sleeper.durations.size(),
+              static_cast<std::size_t>(ProducedLedger::kEchoGraceDelay /
+                                       ProducedLedger::kEchoPollInterval));
+}
+
 } // namespace
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "aid/adapters/openproject/internal/RecipientCache.h"
+#include "aid/value-types/Ids.h"
+
+using aid::adapters::openproject::RecipientCache;
+
+namespace {
+
+std::vector<aid::UserHandle> logins(std::initializer_list<const char*> vs) {
+    std::vector<aid::UserHandle> out;
+    for (const char* v : vs)
+        out.push_back(aid::UserHandle{v});
+    return out;
+}
+
+const aid::ProjectId kProject{"11"};
+
+} // namespace
+
+TEST(RecipientCache, UniteListsMembersFirstAndDedups) {
+    const auto out = RecipientCache::unite(logins({"alice", "bob", "alice"}), logins({"bob", "carol"}));
+    EXPECT_EQ(out, logins({"alice", "bob", "carol"}));
+}
+
+TEST(RecipientCache, LookupMissesUntilRebuilt) {
+    RecipientCache cache;
+    EXPECT_EQ(cache.lookup(kProject, 1, {}), nullptr);
+
+    const auto built = cache.rebuild(kProject, 1, logins({"alice", "bob"}), {});
+    ASSERT_NE(built, nullptr);
+    const auto hit = cache.lookup(kProject, 1, {});
+    EXPECT_EQ(hit, built) << "the same immutable set, not a copy";
+    EXPECT_EQ(cache.stats().hits, 1U);
+    EXPECT_EQ(cache.stats().rebuilds, 1U);
+}
+
+// Handlers who are already members add nothing, so those tickets share the
+// members-only set; a non-member handler needs its own.
+TEST(RecipientCache, OnlyNonMemberHandlersSplitTheSet) {
+    RecipientCache cache;
+    (void)cache.rebuild(kProject, 1, logins({"alice", "bob"}), logins({"bob"}));
+
+    const auto shared = cache.lookup(kProject, 1, logins({"alice"}));
+    ASSERT_NE(shared, nullptr);
+    EXPECT_EQ(*shared, logins({"alice", "bob"}));
+    EXPECT_EQ(cache.lookup(kProject, 1, logins({"carol"})), nullptr);
+
+    (void)cache.rebuild(kProject, 1, logins({"alice", "bob"}), logins({"carol", "alice"}));
+    const auto withCarol = cache.lookup(kProject, 1, logins({"alice", "carol"}));
+    ASSERT_NE(withCarol, nullptr);
+    EXPECT_EQ(*withCarol, logins({"alice", "bob", "carol"}));
+}
+
+TEST(RecipientCache, AnotherMembershipVersionMisses) {
+    RecipientCache cache;
+    (void)cache.rebuild(kProject, 1, logins({"alice"}), {});
+    EXPECT_EQ(cache.lookup(kProject, 2, {}), nullptr);
+
+    // The newer version replaces the entry...
+    (void)cache.rebuild(kProject, 2, logins({"alice", "bob"}), {});
+    ASSERT_NE(cache.lookup(kProject, 2, {}), nullptr);
+    EXPECT_EQ(*cache.lookup(kProject, 2, {}), logins({"alice", "bob"}));
+    // ...and a late rebuild under the old one does not take it back.
+    (void)cache.rebuild(kProject, 1, logins({"alice"}), {});
+    EXPECT_EQ(cache.lookup(kProject, 1, {}), nullptr);
+    EXPECT_NE(cache.lookup(kProject, 2, {}), nullptr);
+}
+
+TEST(RecipientCache, RebuildWithoutAVersionIsNotKept) {
+    RecipientCache cache;
+    const auto built = cache.rebuild(kProject, std::nullopt, logins({"alice"}), logins({"carol"}));
+    ASSERT_NE(built, nullptr);
+    EXPECT_EQ(*built, logins({"alice", "carol"}));
+    EXPECT_EQ(cache.lookup(kProject, 0, logins({"carol"})), nullptr);
+    EXPECT_EQ(cache.stats().rebuilds, 1U);
+}
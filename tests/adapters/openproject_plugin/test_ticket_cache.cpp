@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "aid/adapters/openproject/internal/TicketCache.h"
+#include "aid/value-types/Ids.h"
+#include "aid/value-types/Ticket.h"
+
+using aid::adapters::openproject::TicketCache;
+
+namespace {
+
+aid::Ticket ticket(const std::string& id, int lockVersion, const std::string& subject = {}) {
+    aid::Ticket t;
+    t.id = aid::TicketId{id};
+    t.lockVersion = lockVersion;
+    t.subject = subject;
+    return t;
+}
+
+} // namespace
+
+TEST(TicketCache, LookupUnknownReturnsNullopt) {
+    TicketCache cache;
+    EXPECT_FALSE(cache.lookup(aid::TicketId{"1"}).has_value());
+}
+
+// A newer version replaces the entry; an older one arriving late does not.
+TEST(TicketCache, RecordKeepsTheNewestVersion) {
+    TicketCache cache;
+    cache.record(ticket("1", 3, "v3"));
+    cache.record(ticket("1", 2, "v2"));
+    auto hit = cache.lookup(aid::TicketId{"1"});
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_EQ(hit->subject, "v3");
+
+    cache.record(ticket("1", 4, "v4"));
+    EXPECT_EQ(cache.lookup(aid::TicketId{"1"})->subject, "v4");
+}
+
+// A webhook at the cached version (our own echo) keeps the entry; a newer one
+// (someone else's edit) drops it.
+TEST(TicketCache, InvalidateBelowDropsOnlyOutdatedEntries) {
+    TicketCache cache;
+    cache.record(ticket("1", 3));
+    cache.invalidateBelow(aid::TicketId{"1"}, 3);
+    EXPECT_TRUE(cache.lookup(aid::TicketId{"1"}).has_value());
+
+    cache.invalidateBelow(aid::TicketId{"1"}, 4);
+    EXPECT_FALSE(cache.lookup(aid::TicketId{"1"}).has_value());
+}
+
+TEST(TicketCache, ForgetDropsTheEntry) {
+    TicketCache cache;
+    cache.record(ticket("1", 3));
+    cache.forget(aid::TicketId{"1"});
+    EXPECT_FALSE(cache.lookup(aid::TicketId{"1"}).has_value());
+}
+
+// The cap holds: recording more tickets than kMaxTickets never grows the map
+// past it, and the newest entry survives.
+TEST(TicketCache, CapacityIsBounded) {
+    TicketCache cache;
+    for (std::size_t i = 0; i < TicketCache::kMaxTickets + 10; ++i) {
+        cache.record(ticket(std::to_string(i), 1));
+        ASSERT_LE(cache.size(), TicketCache::kMaxTickets) << "after record #" << i;
+    }
+    EXPECT_EQ(cache.size(), TicketCache::kMaxTickets);
+    EXPECT_TRUE(cache.lookup(aid::TicketId{std::to_string(TicketCache::kMaxTickets + 9)})
+                    .has_value());
+}
@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "FakeWebSocketConnection.h"
 #include "aid/adapters/ws/WsHubAdapter.h"
@@ -252,6 +255,41 @@ TEST_F(WsHubAdapterTest, PushTicketUpsertTargetsOneUserAndCarriesEntryPlusVersio
     EXPECT_TRUE(entry.at("updatedAt").is_string());
 }
 
+TEST_F(WsHubAdapterTest, PushTicketUpsertsSendsEachViewerItsOwnEntryFrame) {
+    auto a1 = makeConn();
+    auto b1 = makeConn();
+    auto c1 = makeConn();
+    ASSERT_TRUE(hub.onConnect(uh("alice"), a1));
+    ASSERT_TRUE(hub.onConnect(uh("bob"), b1));
+    ASSERT_TRUE(hub.onConnect(uh("carol"), c1));
+
+    aid::SharedDashboardEntry shared;
+    shared.entry.id = TicketId{"4242"};
+    shared.entry.subject = "Acme GmbH";
+    shared.entry.description = "a comment";
+    shared.entry.lockVersion = 5;
+    // alice is on a call; bob and carol share the bystander overlay.
+    shared.viewers.push_back({uh("alice"), aid::CallId{"X.1"}, {}});
+    shared.viewers.push_back({uh("bob"), std::nullopt, {uh("alice")}});
+    shared.viewers.push_back({uh("carol"), std::nullopt, {uh("alice")}});
+    hub.pushTicketUpserts(shared);
+
+    // Byte-identical to pushing each viewer's assembled entry on its own.
+    WsHubAdapter single{Logger::instance()};
+    const std::vector<std::shared_ptr<FakeWebSocketConnection>> conns{a1, b1, c1};
+    for (std::size_t i = 0; i < shared.viewers.size(); ++i) {
+        auto ref = makeConn();
+        ASSERT_TRUE(single.onConnect(shared.viewers[i].viewer, ref));
+        single.pushTicketUpsert(shared.viewers[i].viewer,
+                                aid::entryFor(shared, shared.viewers[i]));
+        ASSERT_EQ(conns[i]->sentCount(), 1u);
+        EXPECT_EQ(conns[i]->sent().at(0), ref->sent().at(0)) << shared.viewers[i].viewer.v;
+    }
+    const auto j = nlohmann::json::parse(a1->sent().at(0));
+    EXPECT_EQ(j.at("entry").at("activeCallForViewer"), "X.1");
+    EXPECT_EQ(j.at("lockVersion"), 5);
+}
+
 TEST_F(WsHubAdapterTest, PushTicketRemoveTargetsOneUserWithIdAndVersion) {
     auto a1 = makeConn();
     auto b1 = makeConn();
@@ -0,0 +1,71 @@
+#include <drogon/HttpRequest.h>
+#include <drogon/HttpResponse.h>
+#include <drogon/HttpTypes.h>
+#include <gtest/gtest.h>
+#include <trantor/net/InetAddress.h>
+
+#include <filesystem>
+#include <mutex>
+
+#include "../fakes/FakeAddressBook.h"
+#include "aid/controllers/AdminController.h"
+#include "aid/crosscutting/Logger.h"
+
+namespace {
+
+using aid::controllers::AdminController;
+using aid::crosscutting::Logger;
+using aid::fakes::FakeAddressBook;
+
+struct LoggerOnce {
+    LoggerOnce() {
+        static std::once_flag flag;
+        std::call_once(flag, [] {
+            const auto tmp = std::filesystem::temp_directory_path();
+            Logger::initialize(aid::crosscutting::LogLevel::ERROR,
+                               (tmp / "aid_admin_ctrl_test_backend.log").string(),
+                               (tmp / "aid_admin_ctrl_test_frontend.log").string());
+        });
+    }
+};
+
+class AdminControllerTest : public ::testing::Test {
+protected:
+    LoggerOnce loggerInit_{};
+    FakeAddressBook ab_{};
+    AdminController ctrl_{ab_, Logger::instance()};
+};
+
+TEST_F(AdminControllerTest, ContactsFlushFromLoopbackFlushesAndReturns204) {
+    drogon::HttpResponsePtr resp;
+    ctrl_.postContactsFlush(trantor::InetAddress{"127.0.0.1", 40000},
+                            [&](const drogon::HttpResponsePtr& r) { resp = r; });
+    ASSERT_NE(resp, nullptr);
+    EXPECT_EQ(resp->statusCode(), drogon::k204NoContent);
+    EXPECT_EQ(ab_.flush_calls, 1);
+}
+
+TEST_F(AdminControllerTest, ContactsFlushFromTheLanIsForbidden) {
+    drogon::HttpResponsePtr resp;
+    ctrl_.postContactsFlush(trantor::InetAddress{"192.168.1.20", 40000},
+                            [&](const drogon::HttpResponsePtr& r) { resp = r; });
+    ASSERT_NE(resp, nullptr);
+    EXPECT_EQ(resp->statusCode(), drogon::k403Forbidden);
+    EXPECT_EQ(ab_.flush_calls, 0) << "a rejected caller must not reach the plugin";
+}
+
+// The request overload reads the peer off the request: one with no loopback
+// peer is refused the same way.
+TEST_F(AdminControllerTest, ContactsFlushRequestWithoutLoopbackPeerIsForbidden) {
+    auto req = drogon::HttpRequest::newHttpRequest();
+    req->setMethod(drogon::Post);
+    req->setPath("/admin/contacts/flush");
+
+    drogon::HttpResponsePtr resp;
+    ctrl_.postContactsFlush(req, [&](const drogon::HttpResponsePtr& r) { resp = r; });
+    ASSERT_NE(resp, nullptr);
+    EXPECT_EQ(resp->statusCode(), drogon::k403Forbidden);
+    EXPECT_EQ(ab_.flush_calls, 0);
+}
+
+} // namespace
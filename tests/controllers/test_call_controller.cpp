@@ -18,6 +18,7 @@
 #include <thread>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "aid/controllers/CallController.h"
 #include "aid/crosscutting/Clock.h"
@@ -343,4 +344,38 @@ TEST_F(CallControllerTest, WalSyncFailure_ReturnsFiveHundred_NoEnqueue) {
     EXPECT_EQ(mb.liveCount(), 0U);
 }
 
+// The prefetch hook sees each event once it is in the WAL, before the 202.
+TEST_F(CallControllerTest, PrefetchHook_SeesTheLoggedEvent) {
+    makeMailbox();
+    std::vector<CallEvent> seen;
+    CallController c{*wal_, *mb_, Logger::instance(), cid_,
+                     [&seen](const CallEvent& ev) { seen.push_back(ev); }};
+
+    auto req = makeRequest(R"({"event":"Hangup","remote":"+491701","callid":"pf"})");
+    EXPECT_EQ(invoke(c, req), drogon::k202Accepted);
+
+    ASSERT_EQ(seen.size(), 1U);
+    ASSERT_TRUE(std::holds_alternative<HangupCall>(seen[0]));
+    EXPECT_EQ(std::get<HangupCall>(seen[0]).callid.v, "pf");
+}
+
+// Nothing is prefetched for a body that never made it into the WAL.
+TEST_F(CallControllerTest, PrefetchHook_NotCalledOnDecodeOrWalFailure) {
+    int calls = 0;
+    auto hook = [&calls](const CallEvent&) { ++calls; };
+
+    makeMailbox();
+    CallController bad{*wal_, *mb_, Logger::instance(), cid_, hook};
+    EXPECT_EQ(invoke(bad, makeRequest("not json at all")), drogon::k400BadRequest);
+
+    FaultySyncWal faultyWal{walPath_, clock_};
+    Mailbox mb{loopThread_.loop(), faultyWal, Logger::instance(), noopHandlers(), nullptr};
+    CallController faulty{faultyWal, mb, Logger::instance(), cid_, hook};
+    auto req = makeRequest(
+        R"({"event":"Incoming Call","remote":"+491701","callid":"pf-fail","dialed":"+4930"})");
+    EXPECT_EQ(invoke(faulty, req), drogon::k500InternalServerError);
+
+    EXPECT_EQ(calls, 0);
+}
+
 } // namespace
@@ -233,6 +233,34 @@ TEST_F(UiControllerTest, Dashboard_AddressInfoNull_WhenActiveCallHasNoMatch) {
     EXPECT_TRUE(body["addressCallInformation"].is_null());
 }
 
+TEST_F(UiControllerTest, Dashboard_SerializesStamp_WhenStoreStampsTheListing) {
+    ts_.nextListDashboard.push_back(std::vector<DashboardEntry>{
+        mkEntry("T1", "https://op.example/projects/support/work_packages/1")});
+    ts_.dashboardStamp =
+        aid::DashboardStamp{17, aid::Timestamp{std::chrono::seconds{1700000000}}};
+
+    auto resp = invokeDashboard(makeReq(drogon::Get, "", alice()));
+    ASSERT_NE(resp, nullptr);
+    EXPECT_EQ(resp->getStatusCode(), drogon::k200OK);
+
+    const auto body = parseBody(resp);
+    ASSERT_TRUE(body["stamp"].is_object());
+    EXPECT_EQ(body["stamp"]["version"], 17);
+    EXPECT_EQ(body["stamp"]["reconciledAt"], "2023-11-14T22:13:20Z");
+}
+
+TEST_F(UiControllerTest, Dashboard_StampNull_WhenStoreDoesNotStamp) {
+    ts_.nextListDashboard.push_back(std::vector<DashboardEntry>{
+        mkEntry("T1", "https://op.example/projects/support/work_packages/1")});
+
+    auto resp = invokeDashboard(makeReq(drogon::Get, "", alice()));
+    ASSERT_NE(resp, nullptr);
+
+    const auto body = parseBody(resp);
+    ASSERT_TRUE(body.contains("stamp"));
+    EXPECT_TRUE(body["stamp"].is_null());
+}
+
 TEST_F(UiControllerTest, Dashboard_Returns500_WhenViewerAttributeMissing) {
     auto resp = invokeDashboard(makeReq(drogon::Get, "", std::nullopt));
     ASSERT_NE(resp, nullptr);
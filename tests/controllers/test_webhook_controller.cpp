@@ -197,6 +197,22 @@ TEST(WebhookControllerKey, GarbageJsonYieldsNullopt) {
     EXPECT_FALSE(WebhookController::ticketIdOf("").has_value());
 }
 
+// ---- lockVersionOf: supersede peek ----
+
+TEST(WebhookControllerKey, PeeksLockVersionFromEitherShape) {
+    EXPECT_EQ(WebhookController::lockVersionOf(envelope(42, 3)), std::optional<std::int64_t>{3});
+    EXPECT_EQ(WebhookController::lockVersionOf(
+                  R"({"id":7,"_embedded":{"lockVersion":9},"lockVersion":5})"),
+              std::optional<std::int64_t>{5})
+        << "a nested lockVersion is not the work package's";
+}
+
+TEST(WebhookControllerKey, MissingOrNonIntegerLockVersionYieldsNullopt) {
+    EXPECT_FALSE(WebhookController::lockVersionOf(R"({"work_package":{"id":1}})").has_value());
+    EXPECT_FALSE(WebhookController::lockVersionOf(R"({"id":1,"lockVersion":"3"})").has_value());
+    EXPECT_FALSE(WebhookController::lockVersionOf("not json").has_value());
+}
+
 // ---- handlePost: secret gate + WAL + enqueue ----
 
 TEST_F(WebhookControllerTest, HappyPath_ValidSecret_WritesWalReturns202) {
@@ -633,6 +633,77 @@ TEST(Config, MembershipPollIntervalRejectsNonInteger) {
     EXPECT_EQ(secs.error().code, ErrorCode::InvalidInput);
 }
 
+TEST(Config, CallPrefetchIsOffWhenAbsent) {
+    auto cf = makeConfigFile("{}", 0640);
+    auto cfg = Config::load(cf.path.string());
+    ASSERT_TRUE(cfg.has_value());
+
+    auto ms = cfg->callPrefetchMs();
+    ASSERT_TRUE(ms.has_value()) << ms.error().message;
+    EXPECT_EQ(*ms, 0);
+}
+
+TEST(Config, CallPrefetchParsesExplicitValue) {
+    auto cf = makeConfigFile(R"({"callPrefetchMs": 2000})", 0640);
+    auto cfg = Config::load(cf.path.string());
+    ASSERT_TRUE(cfg.has_value());
+
+    auto ms = cfg->callPrefetchMs();
+    ASSERT_TRUE(ms.has_value()) << ms.error().message;
+    EXPECT_EQ(*ms, 2000);
+}
+
+TEST(Config, CallPrefetchRejectsNegativeAndNonInteger) {
+    for (const char* json : {R"({"callPrefetchMs": -1})", R"({"callPrefetchMs": "2000"})"}) {
+        auto cf = makeConfigFile(json, 0640);
+        auto cfg = Config::load(cf.path.string());
+        ASSERT_TRUE(cfg.has_value());
+
+        auto ms = cfg->callPrefetchMs();
+        ASSERT_FALSE(ms.has_value()) << json;
+        EXPECT_EQ(ms.error().code, ErrorCode::InvalidInput);
+        EXPECT_NE(ms.error().message.find("callPrefetchMs"), std::string::npos);
+    }
+}
+
+TEST(Config, EventBudgetsDefaultToUnbudgetedWhenAbsent) {
+    auto cf = makeConfigFile(R"({})", 0640);
+    auto cfg = Config::load(cf.path.string());
+    ASSERT_TRUE(cfg.has_value());
+
+    auto b = cfg->eventBudgets();
+    ASSERT_TRUE(b.has_value()) << b.error().message;
+    EXPECT_EQ(b->incomingMs, 0);
+    EXPECT_EQ(b->hangupMs, 0);
+    EXPECT_EQ(b->webhookMs, 0);
+}
+
+TEST(Config, EventBudgetsParsesPerEventTypeValues) {
+    auto cf = makeConfigFile(
+        R"({"EventBudgets": {"incomingMs": 8000, "acceptedMs": 15000, "webhookMs": 20000}})",
+        0640);
+    auto cfg = Config::load(cf.path.string());
+    ASSERT_TRUE(cfg.has_value());
+
+    auto b = cfg->eventBudgets();
+    ASSERT_TRUE(b.has_value()) << b.error().message;
+    EXPECT_EQ(b->incomingMs, 8000);
+    EXPECT_EQ(b->acceptedMs, 15000);
+    EXPECT_EQ(b->webhookMs, 20000);
+    EXPECT_EQ(b->outgoingMs, 0); // omitted key stays unbudgeted
+}
+
+TEST(Config, EventBudgetsRejectsNegative) {
+    auto cf = makeConfigFile(R"({"EventBudgets": {"hangupMs": -1}})", 0640);
+    auto cfg = Config::load(cf.path.string());
+    ASSERT_TRUE(cfg.has_value());
+
+    auto b = cfg->eventBudgets();
+    ASSERT_FALSE(b.has_value());
+    EXPECT_EQ(b.error().code, ErrorCode::InvalidInput);
+    EXPECT_NE(b.error().message.find("hangupMs"), std::string::npos);
+}
+
 // --- cookieSecure-vs-listener cross-check -------------------------
 
 using aid::crosscutting::isLoopbackInterface;
@@ -283,4 +283,20 @@ TEST(CallLineFormatterFindUsersWithOpenCalls, MalformedStartLineIsSkipped) {
     EXPECT_EQ(users[0], UserHandle{"bob"});
 }
 
+TEST(CallLineFormatterFindOpenLines, KeepsOnlyOpenLinesAsViewsInOrder) {
+    const std::string desc = "alice: Call start: 2026-05-20 14:00:00 Call End: "
+                             "2026-05-20 14:10:00\n"
+                             "a comment\n"
+                             "bob: Call start: 2026-05-20 14:12:00 (X.2)\n"
+                             "ghost: Call start: not-a-timestamp";
+    const auto lines = CallLineFormatter::findOpenLines(desc);
+    ASSERT_EQ(lines.size(), 2U);
+    EXPECT_EQ(lines[0], "bob: Call start: 2026-05-20 14:12:00 (X.2)");
+    EXPECT_EQ(lines[1], "ghost: Call start: not-a-timestamp");
+    // Each open line still answers findOpenLineForUser on its own.
+    const auto open = CallLineFormatter::findOpenLineForUser(lines[0], UserHandle{"bob"});
+    ASSERT_TRUE(open.has_value());
+    EXPECT_EQ(*open, CallId{"X.2"});
+}
+
 } // namespace
@@ -26,12 +26,14 @@ Ticket make_ticket(TicketId id, ProjectId pid) {
 TEST(TicketRouterDecideKnown, FirstProjectHasCandidateReuses) {
     const auto p1 = ProjectId{"P1"};
     const auto p2 = ProjectId{"P2"};
-    const std::array cands{
-        TicketRouter::RoutingCandidate{p1, make_ticket(TicketId{"T1"}, p1)},
-        TicketRouter::RoutingCandidate{p2, std::nullopt},
+    const std::array projects{p1, p2};
+    const std::array latest{
+        std::optional<Ticket>{make_ticket(TicketId{"T1"}, p1)},
+        std::optional<Ticket>{},
     };
 
-    const auto decision = TicketRouter::decideKnown(TicketRouter::KnownInput{std::span{cands}});
+    const auto decision = TicketRouter::decideKnown(
+        TicketRouter::KnownInput{std::span{projects}, std::span{latest}});
 
     ASSERT_TRUE(std::holds_alternative<TicketRouter::ReuseExisting>(decision));
     EXPECT_EQ(std::get<TicketRouter::ReuseExisting>(decision).ticket, TicketId{"T1"});
@@ -40,12 +42,14 @@ TEST(TicketRouterDecideKnown, FirstProjectHasCandidateReuses) {
 TEST(TicketRouterDecideKnown, SecondProjectHasCandidateReusesItNotFallback) {
     const auto p1 = ProjectId{"P1"};
     const auto p2 = ProjectId{"P2"};
-    const std::array cands{
-        TicketRouter::RoutingCandidate{p1, std::nullopt},
-        TicketRouter::RoutingCandidate{p2, make_ticket(TicketId{"T2"}, p2)},
+    const std::array projects{p1, p2};
+    const std::array latest{
+        std::optional<Ticket>{},
+        std::optional<Ticket>{make_ticket(TicketId{"T2"}, p2)},
     };
 
-    const auto decision = TicketRouter::decideKnown(TicketRouter::KnownInput{std::span{cands}});
+    const auto decision = TicketRouter::decideKnown(
+        TicketRouter::KnownInput{std::span{projects}, std::span{latest}});
 
     ASSERT_TRUE(std::holds_alternative<TicketRouter::ReuseExisting>(decision));
     EXPECT_EQ(std::get<TicketRouter::ReuseExisting>(decision).ticket, TicketId{"T2"});
@@ -55,13 +59,15 @@ TEST(TicketRouterDecideKnown, AllEmptyFallsBackToFirstProject) {
     const auto p1 = ProjectId{"P1"};
     const auto p2 = ProjectId{"P2"};
     const auto p3 = ProjectId{"P3"};
-    const std::array cands{
-        TicketRouter::RoutingCandidate{p1, std::nullopt},
-        TicketRouter::RoutingCandidate{p2, std::nullopt},
-        TicketRouter::RoutingCandidate{p3, std::nullopt},
+    const std::array projects{p1, p2, p3};
+    const std::array latest{
+        std::optional<Ticket>{},
+        std::optional<Ticket>{},
+        std::optional<Ticket>{},
     };
 
-    const auto decision = TicketRouter::decideKnown(TicketRouter::KnownInput{std::span{cands}});
+    const auto decision = TicketRouter::decideKnown(
+        TicketRouter::KnownInput{std::span{projects}, std::span{latest}});
 
     ASSERT_TRUE(std::holds_alternative<TicketRouter::CreateInProject>(decision));
     EXPECT_EQ(std::get<TicketRouter::CreateInProject>(decision).project, p1);
@@ -71,13 +77,15 @@ TEST(TicketRouterDecideKnown, ThirdProjectHasCandidateWins) {
     const auto p1 = ProjectId{"P1"};
     const auto p2 = ProjectId{"P2"};
     const auto p3 = ProjectId{"P3"};
-    const std::array cands{
-        TicketRouter::RoutingCandidate{p1, std::nullopt},
-        TicketRouter::RoutingCandidate{p2, std::nullopt},
-        TicketRouter::RoutingCandidate{p3, make_ticket(TicketId{"T3"}, p3)},
+    const std::array projects{p1, p2, p3};
+    const std::array latest{
+        std::optional<Ticket>{},
+        std::optional<Ticket>{},
+        std::optional<Ticket>{make_ticket(TicketId{"T3"}, p3)},
     };
 
-    const auto decision = TicketRouter::decideKnown(TicketRouter::KnownInput{std::span{cands}});
+    const auto decision = TicketRouter::decideKnown(
+        TicketRouter::KnownInput{std::span{projects}, std::span{latest}});
 
     ASSERT_TRUE(std::holds_alternative<TicketRouter::ReuseExisting>(decision));
     EXPECT_EQ(std::get<TicketRouter::ReuseExisting>(decision).ticket, TicketId{"T3"});
@@ -124,11 +132,13 @@ TEST(TicketRouterDecideUnknown, BothAbsentCreatesInFallback) {
 
 TEST(TicketRouterDecideKnown, SingleProjectNoCandidateCreatesThere) {
     const auto p1 = ProjectId{"P1"};
-    const std::array cands{
-        TicketRouter::RoutingCandidate{p1, std::nullopt},
+    const std::array projects{p1};
+    const std::array latest{
+        std::optional<Ticket>{},
     };
 
-    const auto decision = TicketRouter::decideKnown(TicketRouter::KnownInput{std::span{cands}});
+    const auto decision = TicketRouter::decideKnown(
+        TicketRouter::KnownInput{std::span{projects}, std::span{latest}});
 
     ASSERT_TRUE(std::holds_alternative<TicketRouter::CreateInProject>(decision));
     EXPECT_EQ(std::get<TicketRouter::CreateInProject>(decision).project, p1);
@@ -32,6 +32,13 @@ FakeAddressBook::lookup(aid::PhoneNumber number) {
     }
     auto v = std::move(nextLookup.front());
     nextLookup.pop_front();
+    if (const auto left = FakeLatency::budgetLeft(); left && *left < lookupLatency) {
+        co_await FakeLatency::sleep(latency, *left);
+        co_return aid::plumbing::unexpected{
+            aid::plumbing::Error{aid::plumbing::ErrorCode::DeadlineExceeded,
+                                 "FakeAddressBook: event deadline exceeded", std::nullopt}};
+    }
+    co_await FakeLatency::sleep(latency, lookupLatency);
     co_return v;
 }
 
@@ -47,4 +54,22 @@ aid::plumbing::Task<aid::plumbing::Result<void>> FakeAddressBook::ping() {
     co_return v;
 }
 
+aid::plumbing::Task<aid::plumbing::Result<void>> FakeAddressBook::refreshContacts() {
+    ++refresh_calls;
+    if (nextRefresh.empty()) {
+        co_return aid::plumbing::Result<void>{};
+    }
+    auto v = std::move(nextRefresh.front());
+    nextRefresh.pop_front();
+    co_return v;
+}
+
+void FakeAddressBook::flushContactCache() noexcept {
+    ++flush_calls;
+}
+
+void FakeAddressBook::cancelPendingRequests() noexcept {
+    ++cancel_calls;
+}
+
 } // namespace aid::fakes
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <deque>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "FakeLatency.h"
 #include "aid/plumbing/Error.h"
 #include "aid/plumbing/Result.h"
 #include "aid/plumbing/Task.h"
@@ -19,7 +21,11 @@ namespace aid::fakes {
 // noexcept discriminator hinges on) without dragging in libphonenumber.
 // canonicalizeMap maps raw input → output; missing entries return raw
 // unchanged unless defaultEmpty is true (used to exercise the incognito
-// branch). lookup() pops canned responses.
+// branch). lookup() pops canned responses; refreshContacts() pops them too,
+// succeeding once they run out. With `latency` set, lookup() answers
+// `lookupLatency` later in that FakeLatency's virtual time, or
+// DeadlineExceeded once a deadline in scope runs out first
+// (FakeLatency::budgetLeft).
 class FakeAddressBook final : public aid::ports::AddressBook {
 public:
     std::unordered_map<std::string, std::string> canonicalizeMap;
@@ -30,8 +36,15 @@ public:
 
     std::deque<aid::plumbing::Result<std::optional<aid::Contact>>> nextLookup;
     std::deque<aid::plumbing::Result<void>> nextPing;
+    std::deque<aid::plumbing::Result<void>> nextRefresh;
 
     int ping_calls = 0;
+    int refresh_calls = 0;
+    int flush_calls = 0;
+    int cancel_calls = 0;
+
+    FakeLatency* latency = nullptr;
+    std::chrono::milliseconds lookupLatency{0};
 
     [[nodiscard]] aid::PhoneNumber canonicalize(aid::PhoneNumber raw) const noexcept override;
 
@@ -39,6 +52,12 @@ public:
     lookup(aid::PhoneNumber number) override;
 
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<void>> ping() override;
+
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<void>> refreshContacts() override;
+
+    void flushContactCache() noexcept override;
+
+    void cancelPendingRequests() noexcept override;
 };
 
 } // namespace aid::fakes
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <utility>
+
+#include "aid/plumbing/Deadline.h"
+
+namespace aid::fakes {
+
+// Header-only virtual-time scheduler for fakes that should take time. A fake
+// co_awaits sleep(d) and its coroutine parks until run() reaches now() + d.
+// run() resumes parked coroutines in wake-time order (ties in parking order)
+// on the calling thread, so nothing races, and when the last one finishes
+// now() is the length of the longest chain of dependent calls: upstream work
+// a use case overlaps costs the longer branch, work it serialises the sum.
+class FakeLatency {
+public:
+    using Duration = std::chrono::milliseconds;
+
+    struct Sleep {
+        FakeLatency* latency;
+        Duration d;
+
+        [[nodiscard]] bool await_ready() const noexcept {
+            return latency == nullptr || d <= Duration::zero();
+        }
+        void await_suspend(std::coroutine_handle<> h) const {
+            latency->parked_.emplace(latency->now_ + d, h);
+        }
+        void await_resume() const noexcept {}
+    };
+
+    // A null `latency` (the fake's default) never suspends.
+    [[nodiscard]] static Sleep sleep(FakeLatency* latency, Duration d) noexcept {
+        return Sleep{latency, d};
+    }
+
+    // What the event deadline in scope (plumbing/Deadline.h) leaves, or
+    // nullopt when there is none. A fake whose call would take longer answers
+    // DeadlineExceeded after this much instead, as HttpClient clamps an
+    // attempt to the remaining budget.
+    [[nodiscard]] static std::optional<Duration> budgetLeft() noexcept {
+        const auto deadline = aid::plumbing::currentDeadline();
+        if (!deadline) {
+            return std::nullopt;
+        }
+        const auto left = std::chrono::duration_cast<Duration>(
+            *deadline - aid::plumbing::DeadlineClock::now());
+        return left > Duration::zero() ? left : Duration::zero();
+    }
+
+    // Resume parked coroutines until none is left.
+    void run() {
+        while (!parked_.empty()) {
+            auto it = parked_.begin();
+            now_ = it->first;
+            auto h = it->second;
+            parked_.erase(it);
+            h.resume();
+        }
+    }
+
+    [[nodiscard]] Duration now() const noexcept { return now_; }
+    [[nodiscard]] std::size_t parked() const noexcept { return parked_.size(); }
+
+private:
+    Duration now_{0};
+    std::multimap<Duration, std::coroutine_handle<>> parked_;
+};
+
+} // namespace aid::fakes
@@ -23,7 +23,9 @@ aid::plumbing::Result<T> popOrUnstubbed(std::deque<aid::plumbing::Result<T>>& d,
 aid::plumbing::Task<aid::plumbing::Result<aid::Ticket>>
 FakeTicketStore::fetchById(aid::TicketId id) {
     fetchById_args.push_back(id);
-    co_return popOrUnstubbed(nextFetchById, "fetchById");
+    auto v = popOrUnstubbed(nextFetchById, "fetchById");
+    co_await FakeLatency::sleep(latency, callLatency);
+    co_return v;
 }
 
 aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
@@ -35,7 +37,15 @@ FakeTicketStore::findByExactCallid(aid::CallId id) {
 aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
 FakeTicketStore::findByCallidContains(aid::CallId id) {
     findByCallidContains_args.push_back(id);
-    co_return popOrUnstubbed(nextFindByCallidContains, "findByCallidContains");
+    auto v = popOrUnstubbed(nextFindByCallidContains, "findByCallidContains");
+    if (const auto left = FakeLatency::budgetLeft(); left && *left < callLatency) {
+        co_await FakeLatency::sleep(latency, *left);
+        co_return aid::plumbing::unexpected{
+            aid::plumbing::Error{aid::plumbing::ErrorCode::DeadlineExceeded,
+                                 "FakeTicketStore: event deadline exceeded", std::nullopt}};
+    }
+    co_await FakeLatency::sleep(latency, callLatency);
+    co_return v;
 }
 
 aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
@@ -53,8 +63,10 @@ FakeTicketStore::findOpenInProjectBySubject(aid::ProjectId project, std::string_
 aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::Ticket>>>
 FakeTicketStore::findOpenInProjectByCallerNumber(aid::ProjectId project, aid::PhoneNumber caller) {
     findOpenInProjectByCallerNumber_args.emplace_back(std::move(project), std::move(caller));
-    co_return popOrUnstubbed(nextFindOpenInProjectByCallerNumber,
-                             "findOpenInProjectByCallerNumber");
+    auto v =
+        popOrUnstubbed(nextFindOpenInProjectByCallerNumber, "findOpenInProjectByCallerNumber");
+    co_await FakeLatency::sleep(latency, callLatency);
+    co_return v;
 }
 
 aid::plumbing::Task<aid::plumbing::Result<std::optional<aid::UserHandle>>>
@@ -75,6 +87,14 @@ FakeTicketStore::listDashboard(aid::UserHandle viewer) {
     co_return popOrUnstubbed(nextListDashboard, "listDashboard");
 }
 
+aid::plumbing::Task<aid::plumbing::Result<aid::DashboardListing>>
+FakeTicketStore::listDashboardStamped(aid::UserHandle viewer) {
+    auto entries = co_await listDashboard(std::move(viewer));
+    if (!entries)
+        co_return aid::plumbing::unexpected{entries.error()};
+    co_return aid::DashboardListing{std::move(*entries), dashboardStamp};
+}
+
 aid::DashboardEntry FakeTicketStore::buildEntry(const aid::Ticket& ticket, aid::UserHandle viewer) {
     buildEntry_args.emplace_back(ticket, std::move(viewer));
     // Deterministic projection of the fields the delta path cares about, so a
@@ -99,7 +119,9 @@ aid::DashboardEntry FakeTicketStore::buildEntry(const aid::Ticket& ticket, aid::
 aid::plumbing::Task<aid::plumbing::Result<aid::TicketId>>
 FakeTicketStore::create(const aid::NewTicket& ticket) {
     created.push_back(ticket);
-    co_return popOrUnstubbed(nextCreate, "create");
+    auto v = popOrUnstubbed(nextCreate, "create");
+    co_await FakeLatency::sleep(latency, callLatency);
+    co_return v;
 }
 
 aid::plumbing::Task<aid::plumbing::Result<aid::Ticket>>
@@ -109,6 +131,7 @@ FakeTicketStore::save(aid::TicketId id, aid::ports::TicketReducer reduce) {
     // server state (the SEED a test stubs in `nextSave`), and return the result.
     // A stubbed error short-circuits before the reducer runs (e.g. injected 409).
     auto seed = popOrUnstubbed(nextSave, "save");
+    co_await FakeLatency::sleep(latency, callLatency);
     if (!seed) {
         co_return aid::plumbing::unexpected{seed.error()};
     }
@@ -126,7 +149,9 @@ FakeTicketStore::addCallHandler(aid::TicketId id, aid::UserHandle login) {
 aid::plumbing::Task<aid::plumbing::Result<std::vector<aid::UserHandle>>>
 FakeTicketStore::recipientsFor(const aid::Ticket& ticket) {
     recipientsFor_args.push_back(ticket);
-    co_return popOrUnstubbed(nextRecipientsFor, "recipientsFor");
+    auto v = popOrUnstubbed(nextRecipientsFor, "recipientsFor");
+    co_await FakeLatency::sleep(latency, callLatency);
+    co_return v;
 }
 
 aid::plumbing::Task<aid::plumbing::Result<std::vector<aid::Ticket>>>
@@ -157,4 +182,8 @@ aid::plumbing::Task<aid::plumbing::Result<void>> FakeTicketStore::ping() {
     co_return popOrUnstubbed(nextPing, "ping");
 }
 
+void FakeTicketStore::cancelPendingRequests() noexcept {
+    ++cancel_calls;
+}
+
 } // namespace aid::fakes
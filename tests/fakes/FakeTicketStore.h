@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <deque>
 #include <optional>
 #include <string>
@@ -7,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "FakeLatency.h"
 #include "aid/plumbing/Error.h"
 #include "aid/plumbing/Result.h"
 #include "aid/plumbing/Task.h"
@@ -22,6 +24,14 @@ namespace aid::fakes {
 // A test stubs the deque it cares about; unstubbed methods return
 // Error{InvariantViolation,"FakeTicketStore: no canned response for <name>"}
 // so a buggy use case can't silently get default-constructed Tickets.
+//
+// With `latency` set, the calls of the incoming-call path (fetchById,
+// findOpenInProjectByCallerNumber, create, save, recipientsFor) and
+// findByCallidContains each answer `callLatency` later in that FakeLatency's
+// virtual time; the canned response is still taken at call time, so deque
+// order is call order. findByCallidContains, a read the call prefetch starts
+// under an event budget, answers DeadlineExceeded once a deadline in scope
+// runs out first (FakeLatency::budgetLeft).
 class FakeTicketStore final : public aid::ports::TicketStore {
 public:
     std::vector<aid::TicketId> fetchById_args;
@@ -59,6 +69,8 @@ public:
     std::deque<aid::plumbing::Result<std::optional<aid::UserHandle>>> nextResolveUser;
     std::deque<aid::plumbing::Result<std::vector<aid::ProjectId>>> nextListProjectsForUser;
     std::deque<aid::plumbing::Result<std::vector<aid::DashboardEntry>>> nextListDashboard;
+    // Attached by listDashboardStamped to the nextListDashboard rows it serves.
+    std::optional<aid::DashboardStamp> dashboardStamp;
     std::deque<aid::plumbing::Result<aid::TicketId>> nextCreate;
     std::deque<aid::plumbing::Result<aid::Ticket>> nextSave;
     std::deque<aid::plumbing::Result<void>> nextAddCallHandler;
@@ -70,6 +82,10 @@ public:
     std::deque<aid::plumbing::Result<void>> nextPing;
 
     int ping_calls = 0;
+    int cancel_calls = 0;
+
+    FakeLatency* latency = nullptr;
+    std::chrono::milliseconds callLatency{0};
 
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<aid::Ticket>>
     fetchById(aid::TicketId id) override;
@@ -98,6 +114,9 @@ public:
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<std::vector<aid::DashboardEntry>>>
     listDashboard(aid::UserHandle viewer) override;
 
+    [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<aid::DashboardListing>>
+    listDashboardStamped(aid::UserHandle viewer) override;
+
     [[nodiscard]] aid::DashboardEntry buildEntry(const aid::Ticket& ticket,
                                                  aid::UserHandle viewer) override;
 
@@ -125,6 +144,8 @@ public:
     decodeWebhook(std::string payload) override;
 
     [[nodiscard]] aid::plumbing::Task<aid::plumbing::Result<void>> ping() override;
+
+    void cancelPendingRequests() noexcept override;
 };
 
 } // namespace aid::fakes
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <trantor/net/EventLoop.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "FakeAddressBook.h"
+#include "aid/crosscutting/Logger.h"
+#include "aid/infrastructure/AddressBookRefresher.h"
+#include "aid/plumbing/Error.h"
+#include "aid/plumbing/Result.h"
+
+namespace {
+
+using aid::crosscutting::Logger;
+using aid::fakes::FakeAddressBook;
+using aid::infrastructure::AddressBookRefresher;
+using aid::plumbing::Error;
+using aid::plumbing::ErrorCode;
+using aid::plumbing::Result;
+
+// Side-thread EventLoop standing in for the daemon's DomainLoop (same helper
+// as test_membership_reconciler.cpp).
+class LoopThread {
+public:
+    LoopThread() {
+        std::promise<trantor::EventLoop*> ready;
+        auto future = ready.get_future();
+        thread_ = std::thread([&ready] {
+            trantor::EventLoop loop;
+            ready.set_value(&loop);
+            loop.loop();
+        });
+        loop_ = future.get();
+    }
+    LoopThread(const LoopThread&) = delete;
+    LoopThread& operator=(const LoopThread&) = delete;
+    LoopThread(LoopThread&&) = delete;
+    LoopThread& operator=(LoopThread&&) = delete;
+    ~LoopThread() {
+        if (loop_ != nullptr) {
+            loop_->queueInLoop([loop = loop_] { loop->quit(); });
+        }
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+    [[nodiscard]] trantor::EventLoop& loop() const noexcept { return *loop_; }
+
+private:
+    std::thread thread_;
+    trantor::EventLoop* loop_{nullptr};
+};
+
+struct LoggerOnce {
+    LoggerOnce() {
+        static std::once_flag flag;
+        std::call_once(flag, [] {
+            Logger::initialize(aid::crosscutting::LogLevel::ERROR,
+                               "/tmp/aid_address_book_refresher_test_backend.log",
+                               "/tmp/aid_address_book_refresher_test_frontend.log");
+        });
+    }
+};
+
+class AddressBookRefresherTest : public ::testing::Test {
+protected:
+    LoggerOnce loggerOnce_{};
+    LoopThread loop_{};
+    FakeAddressBook ab_{};
+    std::unique_ptr<AddressBookRefresher> refresher_ = std::make_unique<AddressBookRefresher>(
+        loop_.loop(), ab_, Logger::instance(), std::chrono::seconds{3600});
+
+    void TearDown() override {
+        refresher_->stop();
+        refresher_.reset();
+    }
+
+    // The fake never really suspends, so a refresh queued before this no-op
+    // has finished by the time it runs.
+    [[nodiscard]] bool barrier(std::chrono::milliseconds timeout = std::chrono::seconds{2}) {
+        std::atomic<bool> done{false};
+        loop_.loop().queueInLoop([&done] { done.store(true, std::memory_order_release); });
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!done.load(std::memory_order_acquire)) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{2});
+        }
+        return true;
+    }
+};
+
+} // namespace
+
+// start() refreshes once straight away rather than a full interval later.
+TEST_F(AddressBookRefresherTest, StartRefreshesImmediately) {
+    refresher_->start();
+    ASSERT_TRUE(barrier());
+    EXPECT_EQ(ab_.refresh_calls, 1);
+}
+
+// A failed refresh is logged and the next one runs as usual.
+TEST_F(AddressBookRefresherTest, FailedRefreshDoesNotStopTheNext) {
+    ab_.nextRefresh.push_back(
+        Result<void>{aid::plumbing::unexpected(Error{ErrorCode::UpstreamUnavailable, "boom",
+                                                     std::nullopt})});
+    refresher_->kick();
+    ASSERT_TRUE(barrier());
+    refresher_->kick();
+    ASSERT_TRUE(barrier());
+    EXPECT_EQ(ab_.refresh_calls, 2);
+}
+
+TEST_F(AddressBookRefresherTest, KickAfterStopIsInert) {
+    refresher_->stop();
+    refresher_->kick();
+    ASSERT_TRUE(barrier());
+    EXPECT_EQ(ab_.refresh_calls, 0);
+}
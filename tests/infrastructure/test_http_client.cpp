@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "aid/infrastructure/HttpClient.h"
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Error.h"
 #include "aid/plumbing/Result.h"
 #include "aid/plumbing/Task.h"
@@ -473,6 +474,49 @@ TEST_F(HttpClientTest, TimeoutMapsToUpstreamTimeout) {
 }
 #endif
 
+// An event budget in scope clamps the attempt below readTimeout: a hanging
+// upstream resolves at the budget as DeadlineExceeded — not retried, and not
+// after readTimeout × networkRetries.
+TEST_F(HttpClientTest, EventDeadlineClampsAttemptAndMapsToDeadlineExceeded) {
+    FakeServer srv{FakeServer::defaultOk(), FakeServer::Behavior::AcceptThenHangLong};
+    UpstreamConfig cfg;
+    cfg.networkRetries = 3;
+    cfg.readTimeout = std::chrono::seconds{30};
+    HttpClient cli{baseUrl(srv.port()), cfg, lt_.loop()};
+
+    const auto start = std::chrono::steady_clock::now();
+    auto fut = launch<HttpResponse>([&] {
+        // The factory runs synchronously on the loop, i.e. on send()'s
+        // synchronous path — exactly where the mailbox dispatch installs it.
+        const aid::plumbing::DeadlineScope scope{aid::plumbing::DeadlineClock::now() +
+                                                 std::chrono::milliseconds{300}};
+        return cli.get("/hang", Headers{});
+    });
+    ASSERT_EQ(fut.wait_for(std::chrono::seconds{10}), std::future_status::ready)
+        << "the budget, not the 30 s readTimeout, must bound the request";
+    const auto r = fut.get();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{10});
+
+    ASSERT_FALSE(r.has_value());
+    EXPECT_EQ(r.error().code, ErrorCode::DeadlineExceeded);
+    EXPECT_EQ(srv.connectionCount(), 1) << "an exhausted budget must not be retried";
+}
+
+// An already-spent budget short-circuits before any upstream contact.
+TEST_F(HttpClientTest, ExpiredEventDeadlineSkipsTheUpstream) {
+    FakeServer srv{};
+    HttpClient cli{baseUrl(srv.port()), UpstreamConfig{}, lt_.loop()};
+
+    const auto r = runResult<HttpResponse>([&] {
+        const aid::plumbing::DeadlineScope scope{aid::plumbing::DeadlineClock::now() -
+                                                 std::chrono::milliseconds{1}};
+        return cli.get("/stale", Headers{});
+    });
+    ASSERT_FALSE(r.has_value());
+    EXPECT_EQ(r.error().code, ErrorCode::DeadlineExceeded);
+    EXPECT_EQ(srv.connectionCount(), 0);
+}
+
 TEST_F(HttpClientTest, ConnectionRefusedReturnsUpstreamUnavailable) {
     // Port 1 is a privileged port with effectively zero chance of a listener
     // in a normal user-mode test environment.
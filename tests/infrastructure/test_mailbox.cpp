@@ -23,6 +23,7 @@
 #include "aid/crosscutting/Logger.h"
 #include "aid/infrastructure/Mailbox.h"
 #include "aid/infrastructure/Wal.h"
+#include "aid/plumbing/Deadline.h"
 #include "aid/plumbing/Error.h"
 #include "aid/plumbing/Result.h"
 #include "aid/plumbing/Task.h"
@@ -190,6 +191,54 @@ TEST_F(MailboxTest, HappyPath_Single_Incoming) {
     EXPECT_EQ(mb.failedCount(), 0U);
 }
 
+// The per-event-type budget is installed as the ambient deadline for the
+// handler's synchronous start (so HttpClient::send can clamp to it), scoped to
+// that one event: an unbudgeted event type dispatched next sees none.
+TEST_F(MailboxTest, EventBudget_Is_Ambient_During_Dispatch_Only) {
+    LoopThread lt;
+    std::promise<std::optional<aid::plumbing::Deadline>> incomingSaw;
+    std::promise<std::optional<aid::plumbing::Deadline>> hangupSaw;
+
+    auto handlers = noopHandlers();
+    handlers.incoming = [&](const IncomingCall&, bool) -> Task<Result<void>> {
+        incomingSaw.set_value(aid::plumbing::currentDeadline());
+        co_return Result<void>{};
+    };
+    handlers.hangup = [&](const HangupCall&) -> Task<Result<void>> {
+        hangupSaw.set_value(aid::plumbing::currentDeadline());
+        co_return Result<void>{};
+    };
+
+    Mailbox::Budgets budgets;
+    budgets.incoming = std::chrono::milliseconds{5000}; // hangup stays unbudgeted
+    Mailbox mb{lt.loop(), *wal_, aid::crosscutting::Logger::instance(), std::move(handlers),
+               nullptr, budgets};
+
+    const auto before = aid::plumbing::DeadlineClock::now();
+    const auto s1 = wal_->append(R"({"event":"incoming"})", "cid-b1");
+    const auto s2 = wal_->append(R"({"event":"hangup"})", "cid-b2");
+    ASSERT_TRUE(s1.has_value());
+    ASSERT_TRUE(s2.has_value());
+    ASSERT_TRUE(mb.enqueue(cid("call-b"),
+                           IncomingCall{cid("call-b"), PhoneNumber{"+49"}, PhoneNumber{"+50"}},
+                           "cid-b1", *s1)
+                    .has_value());
+    ASSERT_TRUE(
+        mb.enqueue(cid("call-b"), HangupCall{cid("call-b"), PhoneNumber{"+49"}}, "cid-b2", *s2)
+            .has_value());
+
+    auto inFut = incomingSaw.get_future();
+    auto hangFut = hangupSaw.get_future();
+    ASSERT_EQ(inFut.wait_for(std::chrono::seconds{2}), std::future_status::ready);
+    ASSERT_EQ(hangFut.wait_for(std::chrono::seconds{2}), std::future_status::ready);
+
+    const auto seen = inFut.get();
+    ASSERT_TRUE(seen.has_value()) << "incoming handler must run under its budget";
+    EXPECT_GE(*seen, before + std::chrono::milliseconds{5000});
+    EXPECT_LE(*seen, aid::plumbing::DeadlineClock::now() + std::chrono::milliseconds{5000});
+    EXPECT_FALSE(hangFut.get().has_value()) << "the budget must not leak into the next event";
+}
+
 TEST_F(MailboxTest, SameCallid_Strict_Order) {
     LoopThread lt;
     std::mutex orderMtx;
@@ -194,6 +194,32 @@ TEST_F(MembershipReconcilerTest, EmptyDeltasSkipsApply) {
     EXPECT_EQ(applyCalls_.load(std::memory_order_acquire), 0);
 }
 
+// The cadence backs off while polls come back empty, up to kMaxBackoff times
+// the configured interval, and snaps back to it on the first change.
+TEST_F(MembershipReconcilerTest, QuietPollsBackOffAndAChangeResetsTheCadence) {
+    makeReconciler(std::chrono::seconds{30});
+    gateReturns_.store(true, std::memory_order_release);
+    EXPECT_EQ(reconciler_->currentInterval(), std::chrono::seconds{30});
+
+    for (int i = 0; i < 5; ++i)
+        ts_.nextRefreshMembership.push_back(
+            Result<std::vector<MembershipDelta>>{std::vector<MembershipDelta>{}});
+    const std::chrono::seconds expected[] = {std::chrono::seconds{60}, std::chrono::seconds{120},
+                                             std::chrono::seconds{240}, std::chrono::seconds{240},
+                                             std::chrono::seconds{240}};
+    for (const auto& want : expected) {
+        reconciler_->kick();
+        ASSERT_TRUE(barrier());
+        EXPECT_EQ(reconciler_->currentInterval(), want);
+    }
+
+    ts_.nextRefreshMembership.push_back(Result<std::vector<MembershipDelta>>{
+        std::vector<MembershipDelta>{makeDelta("7", {UserHandle{"alice"}}, {})}});
+    reconciler_->kick();
+    ASSERT_TRUE(barrier());
+    EXPECT_EQ(reconciler_->currentInterval(), std::chrono::seconds{30});
+}
+
 // A failed refresh is surfaced (logged) but never crashes and never invents
 // deltas — the safety guard lives in the plugin; here we just don't apply.
 TEST_F(MembershipReconcilerTest, RefreshErrorIsBestEffortNoApply) {
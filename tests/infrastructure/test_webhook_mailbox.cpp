@@ -9,7 +9,9 @@
 #include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -207,6 +209,63 @@ TEST_F(WebhookMailboxTest, BackpressureFullQueueRejectsWithError) {
     })) << "worker must drain the whole backlog after the gate opens";
 }
 
+// With a VersionPeek, webhooks queued behind a busy worker collapse to the
+// newest lockVersion: the stale ones are never handled, and their WAL records
+// are acked together with the survivor.
+TEST_F(WebhookMailboxTest, NewerLockVersionSupersedesQueuedWebhooks) {
+    std::promise<void> gate;
+    auto gateFut = gate.get_future().share();
+    std::atomic<int> entered{0};
+    std::mutex m;
+    std::vector<std::string> seen;
+    auto handler = [gateFut, &entered, &m, &seen](std::string payload,
+                                                  std::string) -> Task<Result<void>> {
+        if (entered.fetch_add(1, std::memory_order_acq_rel) == 0) {
+            // TEST-ONLY synchronous wait — holds the first event in flight.
+            gateFut.wait();
+        }
+        {
+            std::lock_guard lk{m};
+            seen.push_back(std::move(payload));
+        }
+        co_return Result<void>{};
+    };
+    // Same shape the controller's lockVersionOf reads; the payloads here are
+    // the bare version number.
+    auto peek = [](std::string_view body) -> std::optional<std::int64_t> {
+        return std::stoll(std::string{body});
+    };
+    mb_ = std::make_unique<WebhookMailbox>(loop_.loop(), *wal_, Logger::instance(),
+                                           std::move(handler), nullptr,
+                                           std::chrono::milliseconds{0}, std::move(peek));
+
+    const auto waitUntil = [](auto pred) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (!pred() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        return pred();
+    };
+    const auto push = [&](const std::string& body) {
+        auto seq = wal_->append(body, "cid");
+        ASSERT_TRUE(seq.has_value());
+        ASSERT_TRUE(mb_->enqueue(TicketId{"7"}, body, "cid", *seq).has_value());
+    };
+
+    push("1");
+    ASSERT_TRUE(waitUntil([&] { return entered.load(std::memory_order_acquire) == 1; }));
+    push("2");
+    push("4");
+    push("3"); // out of order: older than the queued 4
+    gate.set_value();
+
+    ASSERT_TRUE(waitUntil([&] { return wal_->pendingCount() == 0 && mb_->liveCount() == 0; }))
+        << "every superseded record is acked";
+    std::lock_guard lk{m};
+    EXPECT_EQ(seen, (std::vector<std::string>{"1", "4"}))
+        << "the in-flight event runs; of the queued ones only the newest does";
+}
+
 TEST_F(WebhookMailboxTest, DrainingRejectsNewEnqueue) {
     auto handler = [](std::string, std::string) -> Task<Result<void>> { co_return Result<void>{}; };
     mb_ = std::make_unique<WebhookMailbox>(loop_.loop(), *wal_, Logger::instance(),
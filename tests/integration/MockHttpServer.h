@@ -9,6 +9,7 @@
 
 #include <atomic>
 #include <cctype>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -28,6 +29,13 @@
 //   * records every request (method, target, body) for assertions.
 // One accept thread, one reply per connection (Connection: close). Binds
 // 127.0.0.1:0 so the OS assigns a free port (read back via port()).
+// MockServeMode::Concurrent hands each accepted connection to its own thread, so
+// a responder that sleeps (injected upstream latency) lets the test observe how
+// many requests the client really keeps in flight; the responder must then be
+// thread-safe.
+// delay() injects latency per endpoint: a request matching a rule is held for
+// that long before the responder runs, so a test can make one upstream query
+// slow and the rest fast (pair it with Concurrent, or the slow one blocks all).
 
 namespace aid::tests::integration {
 
@@ -35,6 +43,17 @@ struct MockRequest {
     std::string method;
     std::string target; // request-target: path + optional ?query
     std::string body;
+
+    // The (still URL-encoded) `filters=` query parameter, or "". Responders
+    // classify work_packages queries by it rather than by the whole target,
+    // which also carries a `select=` list naming every field.
+    [[nodiscard]] std::string filters() const {
+        auto pos = target.find("filters=");
+        if (pos == std::string::npos)
+            return {};
+        pos += 8;
+        return target.substr(pos, target.find('&', pos) - pos);
+    }
 };
 
 struct MockResponse {
@@ -45,10 +64,15 @@ struct MockResponse {
 };
 
 using MockResponder = std::function<MockResponse(const MockRequest&)>;
+using MockMatcher = std::function<bool(const MockRequest&)>;
+
+enum class MockServeMode { Sequential, Concurrent };
 
 class MockHttpServer {
 public:
-    explicit MockHttpServer(MockResponder responder) : responder_(std::move(responder)) {
+    explicit MockHttpServer(MockResponder responder,
+                            MockServeMode mode = MockServeMode::Sequential)
+        : responder_(std::move(responder)), mode_(mode) {
         fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
         if (fd_ < 0) {
             ADD_FAILURE() << "socket: " << std::strerror(errno);
@@ -93,6 +117,12 @@ public:
         if (thread_.joinable()) {
             thread_.join();
         }
+        // The accept thread has exited, so the worker list is final.
+        for (auto& w : workers_) {
+            if (w.joinable()) {
+                w.join();
+            }
+        }
     }
 
     [[nodiscard]] std::uint16_t port() const noexcept { return port_; }
@@ -105,6 +135,13 @@ public:
         return completed_.load(std::memory_order_acquire);
     }
 
+    // Hold every request `match` accepts for `latency` before answering it. The
+    // first matching rule wins; call before the client sends anything.
+    void delay(MockMatcher match, std::chrono::milliseconds latency) {
+        std::lock_guard lk{mtx_};
+        delays_.push_back(DelayRule{std::move(match), latency});
+    }
+
     [[nodiscard]] std::vector<MockRequest> requests() const {
         std::lock_guard lk{mtx_};
         return requests_;
@@ -129,12 +166,20 @@ private:
             if (client < 0) {
                 return; // listen socket shut down
             }
-            handle(client);
-            ::close(client);
-            completed_.fetch_add(1, std::memory_order_release);
+            if (mode_ == MockServeMode::Concurrent) {
+                workers_.emplace_back([this, client] { handleAndClose(client); });
+            } else {
+                handleAndClose(client);
+            }
         }
     }
 
+    void handleAndClose(int client) {
+        handle(client);
+        ::close(client);
+        completed_.fetch_add(1, std::memory_order_release);
+    }
+
     void handle(int client) {
         std::string req;
         char buf[2048];
@@ -169,6 +214,9 @@ private:
         }
 
         MockRequest parsed = parseRequest(req);
+        if (const auto latency = delayFor(parsed); latency.count() > 0) {
+            std::this_thread::sleep_for(latency);
+        }
         MockResponse resp = responder_(parsed);
         {
             std::lock_guard lk{mtx_};
@@ -182,6 +230,16 @@ private:
         (void)::write(client, wire.data(), wire.size());
     }
 
+    [[nodiscard]] std::chrono::milliseconds delayFor(const MockRequest& r) const {
+        std::lock_guard lk{mtx_};
+        for (const auto& rule : delays_) {
+            if (rule.match(r)) {
+                return rule.latency;
+            }
+        }
+        return std::chrono::milliseconds{0};
+    }
+
     static MockRequest parseRequest(const std::string& req) {
         MockRequest out;
         const auto sp1 = req.find(' ');
@@ -198,14 +256,22 @@ private:
         return out;
     }
 
+    struct DelayRule {
+        MockMatcher match;
+        std::chrono::milliseconds latency;
+    };
+
     MockResponder responder_;
+    MockServeMode mode_;
     std::thread thread_;
+    std::vector<std::thread> workers_; // Concurrent mode; touched only by thread_
     int fd_{-1};
     std::uint16_t port_{0};
     std::atomic<bool> stop_{false};
     std::atomic<int> completed_{0};
     mutable std::mutex mtx_;
     std::vector<MockRequest> requests_;
+    std::vector<DelayRule> delays_;
 };
 
 } // namespace aid::tests::integration
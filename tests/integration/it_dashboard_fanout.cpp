@@ -0,0 +1,223 @@
+// Dashboard fan-out: proves at the HTTP wire level that a cold dashboard load
+// waits on its SLOWEST upstream query, not on the sum of them. Loads the REAL
+// aid_openproject_plugin.so via PluginLoader and runs GetDashboard against a
+// MockHttpServer that injects a different latency per endpoint: the viewer-login
+// lookup, projects-for-user and the member-projects arm form a dependent chain,
+// while the cross-project handler arm is independent and the slowest of all.
+//
+// Companion to it_paged_fetch.cpp — same harness, one level up: "does the
+// dashboard overlap the queries that do not depend on each other?"
+
+#include <gtest/gtest.h>
+#include <trantor/net/EventLoop.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "FakeAddressBook.h"
+#include "IntegrationHarness.h"
+#include "MockHttpServer.h"
+#include "aid/infrastructure/PluginLoader.h"
+#include "aid/plumbing/Result.h"
+#include "aid/plumbing/Task.h"
+#include "aid/ports/TicketStore.h"
+#include "aid/usecases/GetDashboard.h"
+#include "aid/value-types/Dashboard.h"
+#include "aid/value-types/Ids.h"
+
+#ifndef AID_OPENPROJECT_PLUGIN_PATH
+#error "AID_OPENPROJECT_PLUGIN_PATH must be defined by CMake"
+#endif
+
+namespace {
+
+using aid::UserHandle;
+using aid::fakes::FakeAddressBook;
+using aid::infrastructure::PluginLoader;
+using aid::plumbing::Result;
+using aid::plumbing::Task;
+using aid::tests::integration::LoggerOnce;
+using aid::tests::integration::LoopThread;
+using aid::tests::integration::MockHttpServer;
+using aid::tests::integration::MockRequest;
+using aid::tests::integration::MockResponse;
+using aid::tests::integration::MockServeMode;
+using aid::usecases::GetDashboard;
+
+// The dependent chain (login → projects → member arm) totals 200 ms; the
+// independent handler arm alone takes 300 ms. Run one after another that is
+// 500 ms; overlapped it is bounded by the 300 ms arm.
+constexpr auto kLoginLatency = std::chrono::milliseconds{60};
+constexpr auto kProjectsLatency = std::chrono::milliseconds{60};
+constexpr auto kMemberArmLatency = std::chrono::milliseconds{80};
+constexpr auto kHandlerArmLatency = std::chrono::milliseconds{300};
+
+std::string opConfig(std::uint16_t port) {
+    return std::string{R"({
+        "baseUrl": "http://127.0.0.1:)"} +
+           std::to_string(port) + std::string{R"(",
+        "apiToken": "fanout-token",
+        "statusNew": "1", "statusInProgress": "2", "statusClosed": "3",
+        "typeCall": "7",
+        "projectNames": { "11": "Acme" },
+        "projectWebBaseUrl": "http://127.0.0.1/projects",
+        "customFieldIds": {
+            "callId": "1", "callerNumber": "2", "calledNumber": "3",
+            "callStart": "4", "callEnd": "5", "callLength": "6",
+            "callHandler": "7"
+        }
+    })"};
+}
+
+nlohmann::json halTicket(int id, const std::string& project, const std::string& handlers) {
+    nlohmann::json j;
+    j["id"] = id;
+    j["subject"] = "Call " + std::to_string(id);
+    j["description"]["raw"] = "";
+    j["lockVersion"] = 1;
+    j["updatedAt"] = "2024-01-15T10:30:00Z";
+    j["customField1"] = "fanout-" + std::to_string(id);
+    j["customField2"] = "+491701234567";
+    if (!handlers.empty())
+        j["customField7"] = {{"format", "markdown"}, {"raw", handlers}};
+    j["_links"]["project"]["href"] = "/api/v3/projects/" + project;
+    j["_links"]["status"]["href"] = "/api/v3/statuses/1";
+    j["_links"]["self"]["href"] = "/api/v3/work_packages/" + std::to_string(id);
+    return j;
+}
+
+std::string collectionOf(const nlohmann::json& element) {
+    nlohmann::json env;
+    env["_embedded"]["elements"] = nlohmann::json::array({element});
+    return env.dump();
+}
+
+MockResponse json200(std::string body) {
+    return MockResponse{200, "OK", "application/json", std::move(body)};
+}
+
+bool isUsersLoginLookup(const MockRequest& r) {
+    return r.method == "GET" && r.target.find("/api/v3/users") != std::string::npos &&
+           r.target.find("filters=") != std::string::npos;
+}
+bool isProjectsForUser(const MockRequest& r) {
+    return r.method == "GET" && r.target.find("/api/v3/projects") != std::string::npos;
+}
+bool isWpHandlerArm(const MockRequest& r) {
+    return r.method == "GET" && r.target.find("/work_packages") != std::string::npos &&
+           r.filters().find("customField7") != std::string::npos;
+}
+bool isWpMemberArm(const MockRequest& r) {
+    return r.method == "GET" && r.target.find("/work_packages") != std::string::npos &&
+           r.target.find("filters=") != std::string::npos && !isWpHandlerArm(r);
+}
+
+// Member project 11 holds call 1; alice also handled call 2 in project 99, which
+// she is not a member of.
+MockResponse opResponder(const MockRequest& r) {
+    if (isUsersLoginLookup(r))
+        return json200(R"({"_embedded":{"elements":[{"login":"alice","id":9,)"
+                       R"("_links":{"self":{"href":"/api/v3/users/9"}}}]}})");
+    if (isProjectsForUser(r))
+        return json200(R"({"_embedded":{"elements":[{"id":11,)"
+                       R"("_links":{"self":{"href":"/api/v3/projects/11"}}}]}})");
+    if (isWpHandlerArm(r))
+        return json200(collectionOf(halTicket(2, "99", "alice")));
+    if (isWpMemberArm(r))
+        return json200(collectionOf(halTicket(1, "11", "")));
+    return MockResponse{404, "Not Found", "application/json", "{}"};
+}
+
+// Drive a Task<Result<T>>-returning factory on the domain loop (HttpClient is
+// pinned there) and block for the result. Same shape as it_paged_fetch.cpp.
+template <class T>
+Result<T> runOnLoop(trantor::EventLoop& loop, std::function<Task<Result<T>>()> factory) {
+    struct Inflight {
+        std::mutex m;
+        std::unordered_map<int, std::unique_ptr<Task<void>>> tasks;
+    };
+    auto inflight = std::make_shared<Inflight>();
+    auto prom = std::make_shared<std::promise<Result<T>>>();
+    auto fut = prom->get_future();
+
+    loop.queueInLoop([&loop, factory = std::move(factory), prom, inflight]() mutable {
+        auto coro = [](std::function<Task<Result<T>>()> f,
+                       std::shared_ptr<std::promise<Result<T>>> p, std::shared_ptr<Inflight> inf,
+                       trantor::EventLoop* lp) -> Task<void> {
+            try {
+                auto r = co_await f();
+                p->set_value(std::move(r));
+            } catch (...) {
+                p->set_exception(std::current_exception());
+            }
+            lp->queueInLoop([inf] {
+                std::lock_guard lk{inf->m};
+                inf->tasks.clear();
+            });
+        }(std::move(factory), prom, inflight, &loop);
+        std::lock_guard lk{inflight->m};
+        inflight->tasks.emplace(0, std::make_unique<Task<void>>(std::move(coro)));
+    });
+    return fut.get();
+}
+
+class DashboardFanout : public ::testing::Test {
+protected:
+    static std::unique_ptr<PluginLoader<aid::ports::TicketStore>>
+    loadOpenProject(std::uint16_t port, trantor::EventLoop& loop) {
+        auto loader = std::make_unique<PluginLoader<aid::ports::TicketStore>>();
+        const auto r =
+            loader->loadWithLoop(AID_OPENPROJECT_PLUGIN_PATH, "create_TicketStore",
+                                 "destroy_TicketStore", opConfig(port), &loop, ::geteuid());
+        EXPECT_TRUE(r.has_value()) << (r.has_value() ? std::string{} : r.error().message);
+        return loader;
+    }
+
+    LoggerOnce loggerInit_{};
+};
+
+} // namespace
+
+// A cold load still issues each query exactly once and shows both visibility
+// arms, but the handler arm runs alongside the login → projects → member-arm
+// chain: the load finishes inside the 500 ms the four queries take back to back.
+TEST_F(DashboardFanout, ColdLoadIsBoundedByTheSlowestQuery) {
+    MockHttpServer opSrv(opResponder, MockServeMode::Concurrent);
+    opSrv.delay(isUsersLoginLookup, kLoginLatency);
+    opSrv.delay(isProjectsForUser, kProjectsLatency);
+    opSrv.delay(isWpHandlerArm, kHandlerArmLatency);
+    opSrv.delay(isWpMemberArm, kMemberArmLatency);
+    LoopThread lt;
+    auto opPlugin = loadOpenProject(opSrv.port(), lt.loop());
+    ASSERT_NE(opPlugin->get(), nullptr);
+    auto& store = *opPlugin->get();
+
+    FakeAddressBook ab;
+    GetDashboard uc{store, ab};
+    const auto started = std::chrono::steady_clock::now();
+    auto result = runOnLoop<aid::DashboardView>(
+        lt.loop(), [&] { return uc.run(UserHandle{"alice"}); });
+    const auto elapsed = std::chrono::steady_clock::now() - started;
+
+    ASSERT_TRUE(result.has_value())
+        << (result.has_value() ? std::string{} : result.error().message);
+    ASSERT_EQ(result->tickets.size(), 2U) << "member-project row and cross-project handler row";
+
+    EXPECT_EQ(opSrv.count(isUsersLoginLookup), 1U);
+    EXPECT_EQ(opSrv.count(isProjectsForUser), 1U);
+    EXPECT_EQ(opSrv.count(isWpMemberArm), 1U);
+    EXPECT_EQ(opSrv.count(isWpHandlerArm), 1U);
+
+    EXPECT_GE(elapsed, kHandlerArmLatency) << "the slowest query bounds the load from below";
+    EXPECT_LT(elapsed, kLoginLatency + kProjectsLatency + kMemberArmLatency + kHandlerArmLatency)
+        << "run one after another the four queries would take their sum";
+}
@@ -0,0 +1,213 @@
+// Paged-scan fan-out: proves at the HTTP wire level that the OpenProject plugin
+// fetches the pages of a multi-page work_packages collection CONCURRENTLY (with
+// a bounded fan-out) once page 1 has told it how many there are, and still
+// returns every row in page order. Loads the REAL aid_openproject_plugin.so via
+// PluginLoader and drives openCallsInProject against a MockHttpServer that
+// clamps the page size to 5 (as OpenProject clamps an over-large pageSize) and
+// sleeps on every request to stand in for upstream latency.
+//
+// Companion to it_query_scope.cpp — same harness, different question: "how many
+// round trips does a dashboard-scale scan wait on, one after another?"
+
+#include <gtest/gtest.h>
+#include <trantor/net/EventLoop.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "IntegrationHarness.h"
+#include "MockHttpServer.h"
+#include "aid/infrastructure/PluginLoader.h"
+#include "aid/plumbing/Result.h"
+#include "aid/plumbing/Task.h"
+#include "aid/ports/TicketStore.h"
+#include "aid/value-types/Ids.h"
+#include "aid/value-types/Ticket.h"
+
+#ifndef AID_OPENPROJECT_PLUGIN_PATH
+#error "AID_OPENPROJECT_PLUGIN_PATH must be defined by CMake"
+#endif
+
+namespace {
+
+using aid::infrastructure::PluginLoader;
+using aid::plumbing::Result;
+using aid::plumbing::Task;
+using aid::tests::integration::LoggerOnce;
+using aid::tests::integration::LoopThread;
+using aid::tests::integration::MockHttpServer;
+using aid::tests::integration::MockRequest;
+using aid::tests::integration::MockResponse;
+using aid::tests::integration::MockServeMode;
+
+constexpr int kPages = 10;
+constexpr int kRowsPerPage = 5; // the "server clamp"
+constexpr auto kLatency = std::chrono::milliseconds{100};
+
+std::string opConfig(std::uint16_t port) {
+    return std::string{R"({
+        "baseUrl": "http://127.0.0.1:)"} +
+           std::to_string(port) + std::string{R"(",
+        "apiToken": "paging-token",
+        "statusNew": "1", "statusInProgress": "2", "statusClosed": "3",
+        "typeCall": "7",
+        "projectNames": { "11": "Acme" },
+        "projectWebBaseUrl": "http://127.0.0.1/projects",
+        "customFieldIds": {
+            "callId": "1", "callerNumber": "2", "calledNumber": "3",
+            "callStart": "4", "callEnd": "5", "callLength": "6",
+            "callHandler": "7"
+        }
+    })"};
+}
+
+nlohmann::json halTicket(int id) {
+    nlohmann::json j;
+    j["id"] = id;
+    j["subject"] = "Call " + std::to_string(id);
+    j["description"]["raw"] = "";
+    j["lockVersion"] = 1;
+    j["updatedAt"] = "2024-01-15T10:30:00Z";
+    j["customField1"] = "paging-" + std::to_string(id);
+    j["customField2"] = "+491701234567";
+    j["_links"]["project"]["href"] = "/api/v3/projects/11";
+    j["_links"]["status"]["href"] = "/api/v3/statuses/1";
+    j["_links"]["self"]["href"] = "/api/v3/work_packages/" + std::to_string(id);
+    return j;
+}
+
+// The `offset` (1-based page number) of a paged list request, or 0.
+int pageOf(const std::string& target) {
+    const auto pos = target.find("&offset=");
+    if (pos == std::string::npos)
+        return 0;
+    return std::stoi(target.substr(pos + 8));
+}
+
+// Serves page N of a kPages × kRowsPerPage collection after kLatency, tracking
+// how many requests are being served at the same moment.
+class PagedResponder {
+public:
+    MockResponse operator()(const MockRequest& r) {
+        const int page = pageOf(r.target);
+        if (r.method != "GET" || page < 1) {
+            return MockResponse{404, "Not Found", "application/json", "{}"};
+        }
+        const int now = inFlight_.fetch_add(1) + 1;
+        int seen = maxInFlight_.load();
+        while (now > seen && !maxInFlight_.compare_exchange_weak(seen, now)) {
+        }
+        std::this_thread::sleep_for(kLatency);
+
+        nlohmann::json env;
+        env["total"] = kPages * kRowsPerPage;
+        env["pageSize"] = kRowsPerPage;
+        env["_embedded"]["elements"] = nlohmann::json::array();
+        if (page <= kPages) {
+            const int firstId = (page - 1) * kRowsPerPage + 1;
+            for (int i = 0; i < kRowsPerPage; ++i)
+                env["_embedded"]["elements"].push_back(halTicket(firstId + i));
+        }
+        inFlight_.fetch_sub(1);
+        return MockResponse{200, "OK", "application/json", env.dump()};
+    }
+
+    [[nodiscard]] int maxInFlight() const { return maxInFlight_.load(); }
+
+private:
+    std::atomic<int> inFlight_{0};
+    std::atomic<int> maxInFlight_{0};
+};
+
+// Drive a Task<Result<T>>-returning factory on the domain loop (HttpClient is
+// pinned there) and block for the result. Same shape as it_query_scope.cpp.
+template <class T>
+Result<T> runOnLoop(trantor::EventLoop& loop, std::function<Task<Result<T>>()> factory) {
+    struct Inflight {
+        std::mutex m;
+        std::unordered_map<int, std::unique_ptr<Task<void>>> tasks;
+    };
+    auto inflight = std::make_shared<Inflight>();
+    auto prom = std::make_shared<std::promise<Result<T>>>();
+    auto fut = prom->get_future();
+
+    loop.queueInLoop([&loop, factory = std::move(factory), prom, inflight]() mutable {
+        auto coro = [](std::function<Task<Result<T>>()> f,
+                       std::shared_ptr<std::promise<Result<T>>> p, std::shared_ptr<Inflight> inf,
+                       trantor::EventLoop* lp) -> Task<void> {
+            try {
+                auto r = co_await f();
+                p->set_value(std::move(r));
+            } catch (...) {
+                p->set_exception(std::current_exception());
+            }
+            lp->queueInLoop([inf] {
+                std::lock_guard lk{inf->m};
+                inf->tasks.clear();
+            });
+        }(std::move(factory), prom, inflight, &loop);
+        std::lock_guard lk{inflight->m};
+        inflight->tasks.emplace(0, std::make_unique<Task<void>>(std::move(coro)));
+    });
+    return fut.get();
+}
+
+class PagedFetch : public ::testing::Test {
+protected:
+    static std::unique_ptr<PluginLoader<aid::ports::TicketStore>>
+    loadOpenProject(std::uint16_t port, trantor::EventLoop& loop) {
+        auto loader = std::make_unique<PluginLoader<aid::ports::TicketStore>>();
+        const auto r =
+            loader->loadWithLoop(AID_OPENPROJECT_PLUGIN_PATH, "create_TicketStore",
+                                 "destroy_TicketStore", opConfig(port), &loop, ::geteuid());
+        EXPECT_TRUE(r.has_value()) << (r.has_value() ? std::string{} : r.error().message);
+        return loader;
+    }
+
+    LoggerOnce loggerInit_{};
+};
+
+} // namespace
+
+// A 10-page scan returns all 50 rows in page order, issues exactly one request
+// per page, and overlaps pages 2..10 (bounded) instead of waiting them out one
+// by one — so it finishes well inside the 10 × latency a sequential scan needs.
+TEST_F(PagedFetch, TenPageScanFansOutAndMergesInOrder) {
+    PagedResponder pages;
+    MockHttpServer opSrv([&pages](const MockRequest& r) { return pages(r); },
+                         MockServeMode::Concurrent);
+    LoopThread lt;
+    auto opPlugin = loadOpenProject(opSrv.port(), lt.loop());
+    ASSERT_NE(opPlugin->get(), nullptr);
+    auto& store = *opPlugin->get();
+
+    const auto started = std::chrono::steady_clock::now();
+    auto result = runOnLoop<std::vector<aid::Ticket>>(
+        lt.loop(), [&] { return store.openCallsInProject(aid::ProjectId{"11"}); });
+    const auto elapsed = std::chrono::steady_clock::now() - started;
+
+    ASSERT_TRUE(result.has_value())
+        << (result.has_value() ? std::string{} : result.error().message);
+    ASSERT_EQ(result->size(), static_cast<std::size_t>(kPages * kRowsPerPage));
+    for (std::size_t i = 0; i < result->size(); ++i) {
+        EXPECT_EQ((*result)[i].id.v, std::to_string(i + 1)) << "rows must stay in page order";
+    }
+
+    EXPECT_EQ(opSrv.count([](const MockRequest& r) { return pageOf(r.target) > 0; }),
+              static_cast<std::size_t>(kPages))
+        << "one request per page, no re-fetches";
+    EXPECT_GE(pages.maxInFlight(), 2) << "pages after the first must overlap";
+    EXPECT_LE(pages.maxInFlight(), 4) << "the fan-out must stay bounded";
+    EXPECT_LT(elapsed, kLatency * kPages) << "a sequential scan would take 10 × latency";
+}
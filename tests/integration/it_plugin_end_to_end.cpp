@@ -424,7 +424,7 @@ TEST_F(PluginEndToEnd, DashboardReadResolvesContactThroughRealPlugins) {
             return json200(projectsCollection());
         }
         if (r.method == "GET" && r.target.find("/work_packages") != std::string::npos) {
-            if (r.target.find("assignee") != std::string::npos) {
+            if (r.filters().find("assignee") != std::string::npos) {
                 return json200(emptyCollection()); // assigned-to-viewer query
             }
             // open call tickets in the viewer's projects
@@ -150,7 +150,7 @@ MockResponse opResponder(const MockRequest& r) {
     if (r.method == "GET" && r.target.find("/api/v3/memberships") != std::string::npos)
         return json200(membershipsCollection());
     if (r.method == "GET" && r.target.find("/work_packages") != std::string::npos) {
-        if (r.target.find("customField7") != std::string::npos)
+        if (r.filters().find("customField7") != std::string::npos)
             return json200(emptyCollection()); // dashboard handler arm
         if (r.target.find("filters=") != std::string::npos)
             return json200(halCollectionOf(halTicket(1, "/api/v3/statuses/1"))); // member arm
@@ -179,11 +179,11 @@ bool isMemberships(const MockRequest& r) {
 bool isWpMemberArm(const MockRequest& r) {
     return r.method == "GET" && r.target.find("/work_packages") != std::string::npos &&
            r.target.find("filters=") != std::string::npos &&
-           r.target.find("customField7") == std::string::npos;
+           r.filters().find("customField7") == std::string::npos;
 }
 bool isWpHandlerArm(const MockRequest& r) {
     return r.method == "GET" && r.target.find("/work_packages") != std::string::npos &&
-           r.target.find("customField7") != std::string::npos;
+           r.filters().find("customField7") != std::string::npos;
 }
 // Any filtered work_packages LIST query (the full-fetch fingerprint).
 bool isWpListQuery(const MockRequest& r) {
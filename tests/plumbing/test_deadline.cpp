@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include "aid/plumbing/Deadline.h"
+
+using aid::plumbing::currentDeadline;
+using aid::plumbing::Deadline;
+using aid::plumbing::DeadlineClock;
+using aid::plumbing::DeadlineScope;
+
+namespace {
+
+// Stand-in for the daemon's slot when exercising the plugin bridge.
+thread_local std::int64_t foreignSlot = aid::plumbing::kNoDeadline;
+
+std::int64_t* foreignSlotFn() {
+    return &foreignSlot;
+}
+
+} // namespace
+
+TEST(Deadline, NoneInScopeByDefault) {
+    EXPECT_FALSE(currentDeadline().has_value());
+}
+
+TEST(Deadline, ScopeInstallsAndRestores) {
+    const Deadline d = DeadlineClock::now() + std::chrono::seconds{5};
+    {
+        DeadlineScope scope{d};
+        ASSERT_TRUE(currentDeadline().has_value());
+        EXPECT_EQ(*currentDeadline(), d);
+    }
+    EXPECT_FALSE(currentDeadline().has_value());
+}
+
+TEST(Deadline, ScopesNestAndAnInnerNulloptUnbudgets) {
+    const Deadline outer = DeadlineClock::now() + std::chrono::seconds{5};
+    DeadlineScope a{outer};
+    {
+        DeadlineScope b{std::nullopt};
+        EXPECT_FALSE(currentDeadline().has_value());
+    }
+    ASSERT_TRUE(currentDeadline().has_value());
+    EXPECT_EQ(*currentDeadline(), outer);
+}
+
+TEST(Deadline, BoundSlotIsSharedWithTheBinder) {
+    aid::plumbing::bindDeadlineSlot(&foreignSlotFn);
+    const Deadline d = DeadlineClock::now() + std::chrono::seconds{1};
+    {
+        DeadlineScope scope{d};
+        EXPECT_NE(foreignSlot, aid::plumbing::kNoDeadline);
+        // The module's own slot is untouched while bound.
+        EXPECT_EQ(*aid::plumbing::localDeadlineSlot(), aid::plumbing::kNoDeadline);
+    }
+    EXPECT_EQ(foreignSlot, aid::plumbing::kNoDeadline);
+    aid::plumbing::bindDeadlineSlot(nullptr);
+    EXPECT_FALSE(currentDeadline().has_value());
+}
@@ -60,6 +60,7 @@ TEST(Error, AllErrorCodesHaveNonEmptyName) {
         ErrorCode::LockVersionExhausted,
         ErrorCode::UpstreamUnavailable,
         ErrorCode::UpstreamTimeout,
+        ErrorCode::DeadlineExceeded,
         ErrorCode::Unauthenticated,
         ErrorCode::Forbidden,
         ErrorCode::WalWriteFailed,
@@ -70,9 +70,10 @@ public:
     Task<Result<std::vector<DashboardEntry>>> listDashboard(UserHandle) override {
         co_return Result<std::vector<DashboardEntry>>{std::vector<DashboardEntry>{}};
     }
-    DashboardEntry buildEntry(const Ticket& t, UserHandle) override {
+    DashboardEntry buildEntry(const Ticket& t, UserHandle viewer) override {
         DashboardEntry e;
         e.id = t.id;
+        e.activeCallForViewer = CallId{"call-of-" + viewer.v};
         return e;
     }
     Task<Result<TicketId>> create(const NewTicket&) override {
@@ -127,4 +128,22 @@ TEST(TicketStorePort, CloseReturnsSuccessVoid) {
     EXPECT_TRUE(result.has_value());
 }
 
+TEST(TicketStorePort, DefaultBuildEntriesSplitsBuildEntryPerViewer) {
+    std::unique_ptr<TicketStore> store = std::make_unique<StubTicketStore>();
+    Ticket t;
+    t.id = TicketId{"42"};
+
+    const auto shared = store->buildEntries(t, {UserHandle{"alice"}, UserHandle{"bob"}});
+
+    EXPECT_EQ(shared.entry.id.v, "42");
+    EXPECT_FALSE(shared.entry.activeCallForViewer.has_value()) << "per-viewer, not shared";
+    ASSERT_EQ(shared.viewers.size(), 2U);
+    EXPECT_EQ(shared.viewers[0].viewer, UserHandle{"alice"});
+    EXPECT_EQ(shared.viewers[1].viewer, UserHandle{"bob"});
+    const auto bob = aid::entryFor(shared, shared.viewers[1]);
+    EXPECT_EQ(bob.id.v, "42");
+    ASSERT_TRUE(bob.activeCallForViewer.has_value());
+    EXPECT_EQ(bob.activeCallForViewer->v, "call-of-bob");
+}
+
 } // namespace
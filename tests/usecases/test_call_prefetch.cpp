@@ -0,0 +1,343 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "FakeAddressBook.h"
+#include "FakeClock.h"
+#include "FakeLatency.h"
+#include "FakeTicketStore.h"
+#include "FakeUiNotifier.h"
+#include "aid/plumbing/Deadline.h"
+#include "aid/plumbing/Error.h"
+#include "aid/plumbing/Result.h"
+#include "aid/plumbing/Task.h"
+#include "aid/usecases/CallPrefetch.h"
+#include "aid/usecases/HandleHangup.h"
+#include "aid/value-types/CallEvent.h"
+#include "aid/value-types/Contact.h"
+#include "aid/value-types/Ids.h"
+#include "aid/value-types/Ticket.h"
+
+namespace {
+
+using aid::AcceptedCall;
+using aid::CallId;
+using aid::Contact;
+using aid::HangupCall;
+using aid::IncomingCall;
+using aid::PhoneNumber;
+using aid::ProjectId;
+using aid::Ticket;
+using aid::TicketId;
+using aid::TicketStatus;
+using aid::TransferCall;
+using aid::UserHandle;
+using aid::fakes::FakeAddressBook;
+using aid::fakes::FakeClock;
+using aid::fakes::FakeLatency;
+using aid::fakes::FakeTicketStore;
+using aid::fakes::FakeUiNotifier;
+using aid::plumbing::Deadline;
+using aid::plumbing::DeadlineScope;
+using aid::plumbing::Error;
+using aid::plumbing::ErrorCode;
+using aid::plumbing::Result;
+using aid::plumbing::Task;
+using aid::usecases::CallPrefetch;
+using aid::usecases::HandleHangup;
+using std::chrono::milliseconds;
+
+const CallId kCall{"call-1"};
+const PhoneNumber kRemote{"+491701234567"};
+
+Ticket makeTicket(TicketId id) {
+    Ticket t;
+    t.id = std::move(id);
+    t.projectId = ProjectId{"P1"};
+    t.subject = "Alice";
+    t.status = TicketStatus::InProgress;
+    t.callIds = {kCall};
+    return t;
+}
+
+// Stands in for the mailbox worker reaching the event `delay` after ingest:
+// sleeps, then asks `consume` and records the answer and when it came.
+template <class T, class Consume>
+Task<void> worker(FakeLatency& latency, milliseconds delay, Consume consume,
+                  std::optional<Result<T>>& out, milliseconds& at) {
+    co_await FakeLatency::sleep(&latency, delay);
+    auto query = consume();
+    out.emplace(co_await query);
+    at = latency.now();
+}
+
+// Starts the query `start` returns under `deadline`, as a mailbox dispatch
+// would, awaits it, and records the deadline in scope once it is answered.
+template <class Start>
+Task<void> underDeadline(Deadline deadline, Start start, std::optional<Deadline>& seen) {
+    auto query = [&] {
+        const DeadlineScope scope{deadline};
+        return start();
+    }();
+    (void)co_await query;
+    seen = aid::plumbing::currentDeadline();
+}
+
+class CallPrefetchTest : public ::testing::Test {
+protected:
+    FakeTicketStore ts_;
+    FakeAddressBook ab_;
+    FakeClock clock_;
+    FakeLatency latency_;
+    CallPrefetch prefetch_{ts_, ab_, clock_, milliseconds{2000}};
+
+    void SetUp() override {
+        // Every upstream read takes 100 ms of virtual time.
+        ab_.latency = &latency_;
+        ab_.lookupLatency = milliseconds{100};
+        ts_.latency = &latency_;
+        ts_.callLatency = milliseconds{100};
+    }
+
+    static IncomingCall incoming() { return IncomingCall{kCall, kRemote, PhoneNumber{"+4930"}}; }
+    static AcceptedCall accepted() {
+        AcceptedCall ev;
+        ev.callid = kCall;
+        ev.remote = kRemote;
+        ev.dialed = PhoneNumber{"+4930"};
+        return ev;
+    }
+
+    auto contactOf(PhoneNumber number) {
+        return [this, number] { return prefetch_.lookup(kCall, number); };
+    }
+    auto ticketOf(CallId callid) {
+        return [this, callid] { return prefetch_.findByCallidContains(callid); };
+    }
+};
+
+TEST_F(CallPrefetchTest, LookupJoinsTheReadStartedAtIngest) {
+    Contact c;
+    c.name = "Alice";
+    ab_.nextLookup.push_back(std::optional<Contact>{c});
+
+    prefetch_.begin(incoming());
+    std::optional<Result<std::optional<Contact>>> out;
+    milliseconds at{};
+    auto w = worker<std::optional<Contact>>(latency_, milliseconds{50}, contactOf(kRemote), out, at);
+    latency_.run();
+
+    ASSERT_TRUE(w.done());
+    ASSERT_TRUE(out.has_value() && out->has_value());
+    ASSERT_TRUE((**out).has_value());
+    EXPECT_EQ((**out)->name, "Alice");
+    EXPECT_EQ(ab_.lookupCalls.size(), 1U);
+    EXPECT_EQ(at, milliseconds{100}) << "the worker only waited out the rest of the read";
+}
+
+TEST_F(CallPrefetchTest, QueuedEventFindsItsTicketAlreadyResolved) {
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{makeTicket(TicketId{"T1"})});
+
+    prefetch_.begin(accepted());
+    std::optional<Result<std::optional<Ticket>>> out;
+    milliseconds at{};
+    // 300 ms of earlier events for the same callid run first.
+    auto w = worker<std::optional<Ticket>>(latency_, milliseconds{300}, ticketOf(kCall), out, at);
+    latency_.run();
+
+    ASSERT_TRUE(w.done());
+    ASSERT_TRUE(out.has_value() && out->has_value());
+    ASSERT_TRUE((**out).has_value());
+    EXPECT_EQ((**out)->id, TicketId{"T1"});
+    EXPECT_EQ(ts_.findByCallidContains_args.size(), 1U);
+    EXPECT_EQ(at, milliseconds{300}) << "no read left on the event's own path";
+}
+
+TEST_F(CallPrefetchTest, TicketMissIsAskedAgain) {
+    // The Incoming queued ahead creates the ticket after the prefetch missed.
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{});
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{makeTicket(TicketId{"T1"})});
+
+    prefetch_.begin(accepted());
+    std::optional<Result<std::optional<Ticket>>> out;
+    milliseconds at{};
+    auto w = worker<std::optional<Ticket>>(latency_, milliseconds{200}, ticketOf(kCall), out, at);
+    latency_.run();
+
+    ASSERT_TRUE(w.done());
+    ASSERT_TRUE(out.has_value() && out->has_value());
+    ASSERT_TRUE((**out).has_value());
+    EXPECT_EQ((**out)->id, TicketId{"T1"});
+    EXPECT_EQ(ts_.findByCallidContains_args.size(), 2U);
+}
+
+TEST_F(CallPrefetchTest, ContactErrorIsAskedAgain) {
+    ab_.nextLookup.push_back(
+        aid::plumbing::unexpected{Error{ErrorCode::UpstreamTimeout, "slow", std::nullopt}});
+    ab_.nextLookup.push_back(std::optional<Contact>{});
+
+    prefetch_.begin(incoming());
+    std::optional<Result<std::optional<Contact>>> out;
+    milliseconds at{};
+    auto w = worker<std::optional<Contact>>(latency_, milliseconds{0}, contactOf(kRemote), out, at);
+    latency_.run();
+
+    ASSERT_TRUE(w.done());
+    ASSERT_TRUE(out.has_value() && out->has_value()) << "the retry's answer, not the error";
+    EXPECT_EQ(ab_.lookupCalls.size(), 2U);
+}
+
+TEST_F(CallPrefetchTest, NoMatchingReadQueriesThePort) {
+    ab_.nextLookup.push_back(std::optional<Contact>{});
+    ab_.nextLookup.push_back(std::optional<Contact>{});
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{});
+
+    prefetch_.begin(incoming());
+    std::optional<Result<std::optional<Contact>>> contact;
+    std::optional<Result<std::optional<Ticket>>> ticket;
+    milliseconds at{};
+    auto a = worker<std::optional<Contact>>(latency_, milliseconds{0},
+                                            contactOf(PhoneNumber{"+4940999"}), contact, at);
+    auto b = worker<std::optional<Ticket>>(latency_, milliseconds{0}, ticketOf(CallId{"other"}),
+                                           ticket, at);
+    latency_.run();
+
+    ASSERT_TRUE(a.done() && b.done());
+    ASSERT_EQ(ab_.lookupCalls.size(), 2U);
+    EXPECT_EQ(ab_.lookupCalls[1], PhoneNumber{"+4940999"});
+    ASSERT_EQ(ts_.findByCallidContains_args.size(), 1U);
+    EXPECT_EQ(ts_.findByCallidContains_args[0], CallId{"other"});
+}
+
+TEST_F(CallPrefetchTest, EventsBegunAfterAHangupGetNoPrefetchedTicket) {
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{makeTicket(TicketId{"T1"})});
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{});
+
+    prefetch_.begin(accepted());
+    prefetch_.begin(HangupCall{kCall, kRemote}); // shares the Accepted's read
+    EXPECT_EQ(ts_.findByCallidContains_args.size(), 1U);
+    prefetch_.begin(TransferCall{kCall, UserHandle{"bob"}});
+
+    std::optional<Result<std::optional<Ticket>>> out;
+    milliseconds at{};
+    auto w = worker<std::optional<Ticket>>(latency_, milliseconds{0}, ticketOf(kCall), out, at);
+    latency_.run();
+
+    ASSERT_TRUE(w.done());
+    ASSERT_TRUE(out.has_value() && out->has_value());
+    EXPECT_FALSE((**out).has_value()) << "the store's current answer, not the pre-hangup hit";
+    EXPECT_EQ(ts_.findByCallidContains_args.size(), 2U);
+}
+
+TEST_F(CallPrefetchTest, ExpiredReadsAreNotUsedAndAreSwept) {
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{makeTicket(TicketId{"T1"})});
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{makeTicket(TicketId{"T1"})});
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{});
+
+    prefetch_.begin(accepted());
+    latency_.run();
+    EXPECT_EQ(prefetch_.size(), 1U);
+    clock_.advance(std::chrono::seconds{3});
+
+    std::optional<Result<std::optional<Ticket>>> out;
+    milliseconds at{};
+    auto w = worker<std::optional<Ticket>>(latency_, milliseconds{0}, ticketOf(kCall), out, at);
+    latency_.run();
+    ASSERT_TRUE(w.done());
+    EXPECT_EQ(ts_.findByCallidContains_args.size(), 2U);
+
+    // The next begin() sweeps the stale entry; only the new callid's is left.
+    AcceptedCall other = accepted();
+    other.callid = CallId{"call-2"};
+    prefetch_.begin(other);
+    latency_.run();
+    EXPECT_EQ(prefetch_.size(), 1U);
+}
+
+TEST_F(CallPrefetchTest, ParkedUseCaseResumesUnderItsOwnDeadline) {
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{makeTicket(TicketId{"T1"})});
+
+    prefetch_.begin(accepted());
+    const Deadline deadline = aid::plumbing::DeadlineClock::now() + std::chrono::seconds{5};
+    std::optional<Deadline> seen;
+    auto w = underDeadline(deadline, ticketOf(kCall), seen);
+    ASSERT_FALSE(w.done()) << "parked on the read begin() started";
+    latency_.run();
+
+    ASSERT_TRUE(w.done());
+    EXPECT_EQ(seen, deadline) << "not the unbudgeted prefetch's";
+    EXPECT_EQ(aid::plumbing::currentDeadline(), std::nullopt);
+}
+
+// A slow port and a short budget: the prefetched read gives up when the
+// event's budget runs out, so a use case parked on it is released then —
+// not when the 100 ms read would have answered — and asks the store itself.
+TEST_F(CallPrefetchTest, PrefetchedReadStopsAtTheEventBudget) {
+    CallPrefetch budgeted{ts_, ab_, clock_, milliseconds{2000},
+                          [](const aid::CallEvent&) { return milliseconds{40}; }};
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{makeTicket(TicketId{"T1"})});
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{makeTicket(TicketId{"T1"})});
+
+    budgeted.begin(accepted());
+    std::optional<Result<std::optional<Ticket>>> out;
+    milliseconds at{};
+    auto w = worker<std::optional<Ticket>>(
+        latency_, milliseconds{0}, [&budgeted] { return budgeted.findByCallidContains(kCall); },
+        out, at);
+    latency_.run();
+
+    ASSERT_TRUE(w.done());
+    ASSERT_TRUE(out.has_value() && out->has_value());
+    ASSERT_TRUE((**out).has_value());
+    EXPECT_EQ(ts_.findByCallidContains_args.size(), 2U) << "the timed-out read is not handed out";
+    EXPECT_LE(at, milliseconds{140}) << "released at the budget, then one unbudgeted read";
+}
+
+TEST_F(CallPrefetchTest, DrainCancelsWhileAReadIsInFlight) {
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{});
+    EXPECT_TRUE(prefetch_.drain()) << "nothing begun";
+
+    prefetch_.begin(incoming());
+    prefetch_.begin(accepted());
+    EXPECT_FALSE(prefetch_.drain());
+    EXPECT_EQ(ts_.cancel_calls, 1);
+    EXPECT_EQ(ab_.cancel_calls, 1);
+
+    latency_.run();
+    EXPECT_TRUE(prefetch_.drain());
+    EXPECT_EQ(ts_.cancel_calls, 1) << "no cancel once every read finished";
+    EXPECT_EQ(ab_.cancel_calls, 1);
+}
+
+TEST_F(CallPrefetchTest, IncognitoCallStartsNothing) {
+    ab_.defaultEmpty = true;
+
+    prefetch_.begin(incoming());
+
+    EXPECT_TRUE(ab_.lookupCalls.empty());
+    EXPECT_EQ(prefetch_.size(), 0U);
+}
+
+TEST_F(CallPrefetchTest, HangupUseCaseTakesThePrefetchedTicket) {
+    ts_.latency = nullptr;
+    FakeUiNotifier ui;
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{makeTicket(TicketId{"T1"})});
+    ts_.nextSave.push_back(makeTicket(TicketId{"T1"}));
+    ts_.nextRecipientsFor.push_back(std::vector<UserHandle>{});
+
+    const HangupCall ev{kCall, kRemote};
+    prefetch_.begin(ev);
+    HandleHangup uc{ts_, ui, clock_, &prefetch_};
+    auto task = uc.run(ev);
+
+    ASSERT_TRUE(task.done());
+    ASSERT_EQ(ts_.findByCallidContains_args.size(), 1U) << "the use case asked no second time";
+    ASSERT_EQ(ts_.save_args.size(), 1U);
+    EXPECT_EQ(ts_.save_args[0], TicketId{"T1"});
+}
+
+} // namespace
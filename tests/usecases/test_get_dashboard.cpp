@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <optional>
 #include <string>
 #include <utility>
@@ -161,6 +162,20 @@ TEST_F(GetDashboardTest, NoActiveCall_LeavesActiveNullopt) {
     EXPECT_EQ(r->tickets.size(), 2U);
 }
 
+TEST_F(GetDashboardTest, ListingStamp_IsCarriedIntoTheView) {
+    ts_.nextListDashboard.push_back(std::vector<DashboardEntry>{
+        mkEntry("T1", "https://op.example/projects/alpha/work_packages/1")});
+    ts_.dashboardStamp = aid::DashboardStamp{42, aid::Timestamp{std::chrono::seconds{1700000000}}};
+
+    auto uc = makeUseCase();
+    auto r = sync(uc.run(viewer()));
+
+    ASSERT_TRUE(r.has_value());
+    ASSERT_TRUE(r->stamp.has_value());
+    EXPECT_EQ(r->stamp->version, 42U);
+    EXPECT_EQ(r->stamp->reconciledAt, aid::Timestamp{std::chrono::seconds{1700000000}});
+}
+
 TEST_F(GetDashboardTest, TicketStoreError_PropagatesAsOuterError) {
     ts_.nextListDashboard.push_back(aid::plumbing::unexpected{
         Error{ErrorCode::UpstreamUnavailable, "openproject 503", std::nullopt}});
@@ -289,6 +289,24 @@ TEST_F(HandleAcceptedCallTest, NoUserField_NoExistingAssignee_NothingSet) {
     EXPECT_TRUE(ts_.saved[0].callLength.empty()) << "no handler resolved → no call-log line";
 }
 
+// With no handler to merge, save()'s own post-PATCH result is the authoritative
+// ticket: the delta is emitted from it with no re-fetch round trip.
+TEST_F(HandleAcceptedCallTest, NoUserField_EmitsSavedTicketWithoutRefetch) {
+    auto t = makeTicket(TicketId{"T1"}, TicketStatus::New);
+    ts_.nextFindByCallidContains.push_back(std::optional<Ticket>{t});
+    ts_.nextSave.push_back(t);
+    ts_.nextRecipientsFor.push_back(
+        Result<std::vector<UserHandle>>{std::vector<UserHandle>{UserHandle{"alice"}}});
+
+    auto uc = makeUseCase();
+    auto r = sync(uc.run(ev(std::nullopt)));
+
+    ASSERT_TRUE(r.has_value());
+    EXPECT_TRUE(ts_.fetchById_args.empty()) << "save() result is emitted, not re-fetched";
+    ASSERT_EQ(ui_.ticketUpserts.size(), 1U);
+    EXPECT_EQ(ui_.ticketUpserts[0].second.id, TicketId{"T1"});
+}
+
 TEST_F(HandleAcceptedCallTest, DedupExistingLine_NoAppend) {
     clock_.now_ = aid::Timestamp{} + std::chrono::hours(24 * 365 * 56);
     auto t = makeTicket(TicketId{"T1"}, TicketStatus::InProgress, UserHandle{"alice"});
@@ -8,6 +8,7 @@
 
 #include "FakeAddressBook.h"
 #include "FakeClock.h"
+#include "FakeLatency.h"
 #include "FakeTicketStore.h"
 #include "FakeUiNotifier.h"
 #include "aid/crosscutting/Config.h"
@@ -32,6 +33,7 @@ using aid::TicketStatus;
 using aid::crosscutting::Config;
 using aid::fakes::FakeAddressBook;
 using aid::fakes::FakeClock;
+using aid::fakes::FakeLatency;
 using aid::fakes::FakeTicketStore;
 using aid::fakes::FakeUiNotifier;
 using aid::plumbing::Error;
@@ -343,4 +345,81 @@ TEST_F(HandleIncomingCallTest, AddressBookLookupFailure_Propagates) {
     EXPECT_TRUE(ui_.invalidateScopes.empty());
 }
 
+// ─── Overlapped upstream work ──────────────────────────────────────────
+// Every upstream call takes 100 ms of FakeLatency's virtual time; when the
+// run finishes, now() is the critical path.
+
+TEST_F(HandleIncomingCallTest, Unknown_FallbackQueryOverlapsTheContactLookup) {
+    using std::chrono::milliseconds;
+    FakeLatency latency;
+    ab_.latency = &latency;
+    ab_.lookupLatency = milliseconds{100};
+    ts_.latency = &latency;
+    ts_.callLatency = milliseconds{100};
+
+    ab_.canonicalizeMap["+491701234567"] = "+491701234567";
+    ab_.nextLookup.push_back(std::optional<Contact>{});
+    ts_.nextFindOpenInProjectByCallerNumber.push_back(std::optional<Ticket>{});
+    ts_.nextCreate.push_back(TicketId{"T-new"});
+    ts_.nextFetchById.push_back(makeTicket(TicketId{"T-new"}, ProjectId{"FB"}));
+    ts_.nextRecipientsFor.push_back(std::vector<aid::UserHandle>{});
+
+    auto uc = makeUseCase();
+    const auto call = ev();
+    auto task = uc.run(call);
+    latency.run();
+    auto r = sync(std::move(task));
+
+    ASSERT_TRUE(r.has_value()) << (r ? "" : r.error().message);
+    ASSERT_EQ(ts_.findOpenInProjectByCallerNumber_args.size(), 1U)
+        << "the speculative query is the unknown branch's query";
+    EXPECT_EQ(ts_.findOpenInProjectByCallerNumber_args[0].first, ProjectId{"FB"});
+    ASSERT_EQ(ts_.created.size(), 1U);
+    EXPECT_EQ(ts_.created[0].projectId, ProjectId{"FB"});
+    // (lookup ‖ query) → create → fetchById → recipientsFor; serially 500 ms.
+    EXPECT_EQ(latency.now(), milliseconds{400});
+}
+
+TEST_F(HandleIncomingCallTest, Known_ProjectQueriesOverlapAndTheSpeculativeAnswerIsDiscarded) {
+    using std::chrono::milliseconds;
+    FakeLatency latency;
+    ab_.latency = &latency;
+    ab_.lookupLatency = milliseconds{100};
+    ts_.latency = &latency;
+    ts_.callLatency = milliseconds{100};
+
+    ab_.canonicalizeMap["+491701234567"] = "+491701234567";
+    Contact c;
+    c.name = "Alice";
+    c.projectIds = {ProjectId{"P1"}, ProjectId{"P2"}, ProjectId{"P3"}};
+    ab_.nextLookup.push_back(std::optional<Contact>{c});
+    // The speculative fallback query finds an open ticket; a known caller must
+    // still be routed by its own projects, none of which has one.
+    ts_.nextFindOpenInProjectByCallerNumber.push_back(
+        std::optional<Ticket>{makeTicket(TicketId{"T-fb"}, ProjectId{"FB"})});
+    for (int i = 0; i < 3; ++i) {
+        ts_.nextFindOpenInProjectByCallerNumber.push_back(std::optional<Ticket>{});
+    }
+    ts_.nextCreate.push_back(TicketId{"T-new"});
+    ts_.nextFetchById.push_back(makeTicket(TicketId{"T-new"}, ProjectId{"P1"}, "Alice"));
+    ts_.nextRecipientsFor.push_back(std::vector<aid::UserHandle>{});
+
+    auto uc = makeUseCase();
+    const auto call = ev();
+    auto task = uc.run(call);
+    latency.run();
+    auto r = sync(std::move(task));
+
+    ASSERT_TRUE(r.has_value()) << (r ? "" : r.error().message);
+    ASSERT_EQ(ts_.findOpenInProjectByCallerNumber_args.size(), 4U);
+    EXPECT_EQ(ts_.findOpenInProjectByCallerNumber_args[0].first, ProjectId{"FB"});
+    EXPECT_EQ(ts_.findOpenInProjectByCallerNumber_args[3].first, ProjectId{"P3"});
+    EXPECT_TRUE(ts_.saved.empty()) << "the fallback project's open ticket is not reused";
+    ASSERT_EQ(ts_.created.size(), 1U);
+    EXPECT_EQ(ts_.created[0].projectId, ProjectId{"P1"});
+    // (lookup ‖ query) → (P1 ‖ P2 ‖ P3) → create → fetchById → recipientsFor;
+    // serially 800 ms.
+    EXPECT_EQ(latency.now(), milliseconds{500});
+}
+
 } // namespace